@@ -0,0 +1,176 @@
+#include "arena.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============ ARENA ============
+
+bool initArena(Arena *arena, size_t capacity)
+{
+    memset(arena, 0, sizeof(*arena));
+    arena->base = malloc(capacity);
+    if (arena->base == NULL)
+    {
+        printf("Error al reservar arena de %zu bytes\n", capacity);
+        return false;
+    }
+    arena->capacity = capacity;
+    return true;
+}
+
+void freeArena(Arena *arena)
+{
+    free(arena->base);
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+}
+
+void *arenaAlloc(Arena *arena, size_t size)
+{
+    size_t offset = (arena->used + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+    if (offset + size > arena->capacity)
+    {
+        arena->failures++;
+        return NULL;
+    }
+
+    arena->used = offset + size;
+    if (arena->used > arena->highWater)
+        arena->highWater = arena->used;
+    arena->allocations++;
+    return arena->base + offset;
+}
+
+void arenaReset(Arena *arena)
+{
+    arena->used = 0;
+    arena->resets++;
+}
+
+void printArenaStats(const char *name, const Arena *arena)
+{
+    printf("Arena %s: %zu/%zu KB en uso, máximo %zu KB, %llu pedidos, %llu resets, %llu fallidos\n",
+           name, arena->used / 1024, arena->capacity / 1024, arena->highWater / 1024,
+           (unsigned long long)arena->allocations, (unsigned long long)arena->resets,
+           (unsigned long long)arena->failures);
+}
+
+// ============ ARENA POR HILO ============
+
+static pthread_key_t threadArenaKey;
+static pthread_once_t threadArenaOnce = PTHREAD_ONCE_INIT;
+static _Thread_local Arena *currentThreadArena = NULL;
+
+static void destroyThreadArena(void *arg)
+{
+    Arena *arena = (Arena *)arg;
+    freeArena(arena);
+    free(arena);
+}
+
+static void createThreadArenaKey(void)
+{
+    pthread_key_create(&threadArenaKey, destroyThreadArena);
+}
+
+Arena *threadArena(void)
+{
+    if (currentThreadArena != NULL)
+        return currentThreadArena;
+
+    pthread_once(&threadArenaOnce, createThreadArenaKey);
+
+    Arena *arena = malloc(sizeof(Arena));
+    if (arena == NULL || !initArena(arena, THREAD_ARENA_SIZE))
+    {
+        free(arena);
+        return NULL;
+    }
+    pthread_setspecific(threadArenaKey, arena);
+    currentThreadArena = arena;
+    return arena;
+}
+
+// ============ POOL DE OBJETOS ============
+
+bool initPool(ObjectPool *pool, size_t objectSize, int capacity)
+{
+    memset(pool, 0, sizeof(*pool));
+
+    // Cada slot libre guarda el puntero al siguiente
+    if (objectSize < sizeof(void *))
+        objectSize = sizeof(void *);
+    objectSize = (objectSize + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+    // calloc: en sistemas con memoria virtual las páginas no usadas no se tocan
+    pool->slots = calloc((size_t)capacity, objectSize);
+    if (pool->slots == NULL)
+    {
+        printf("Error al reservar pool de %d objetos de %zu bytes\n", capacity, objectSize);
+        return false;
+    }
+    pool->objectSize = objectSize;
+    pool->capacity = capacity;
+    return true;
+}
+
+void freePool(ObjectPool *pool)
+{
+    free(pool->slots);
+    memset(pool, 0, sizeof(*pool));
+}
+
+void *poolAlloc(ObjectPool *pool)
+{
+    void *object;
+    if (pool->freeList != NULL)
+    {
+        object = pool->freeList;
+        pool->freeList = *(void **)object;
+        memset(object, 0, pool->objectSize);
+    }
+    else if (pool->nextUnused < pool->capacity)
+    {
+        // Slot nuevo: ya está en cero desde calloc
+        object = pool->slots + (size_t)pool->nextUnused++ * pool->objectSize;
+    }
+    else
+    {
+        pool->failures++;
+        return NULL;
+    }
+
+    pool->used++;
+    if (pool->used > pool->highWater)
+        pool->highWater = pool->used;
+    pool->allocations++;
+    return object;
+}
+
+void poolFree(ObjectPool *pool, void *object)
+{
+    if (object == NULL)
+        return;
+    *(void **)object = pool->freeList;
+    pool->freeList = object;
+    pool->used--;
+}
+
+void poolReset(ObjectPool *pool)
+{
+    pool->nextUnused = 0;
+    pool->freeList = NULL;
+    pool->used = 0;
+    pool->resets++;
+}
+
+void printPoolStats(const char *name, const ObjectPool *pool)
+{
+    printf("Pool %s: %d/%d objetos de %zu bytes en uso (%zu KB), máximo %d, %llu pedidos, %llu resets, "
+           "%llu fallidos\n",
+           name, pool->used, pool->capacity, pool->objectSize, (size_t)pool->used * pool->objectSize / 1024,
+           pool->highWater, (unsigned long long)pool->allocations, (unsigned long long)pool->resets,
+           (unsigned long long)pool->failures);
+}
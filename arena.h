@@ -0,0 +1,74 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============ ARENA (BUMP ALLOCATOR) ============
+// Un bloque reservado una sola vez; cada pedido avanza un puntero y todo
+// se libera junto con arenaReset(). Pensada para datos que viven lo que
+// dura una jugada (p. ej. las colocaciones que evalúa el bot): reservar y
+// liberar es sumar y poner a cero un entero, sin malloc ni locks.
+
+#define ARENA_ALIGNMENT 16
+#define THREAD_ARENA_SIZE (1024 * 1024) // Arena de cada hilo (threadArena)
+
+typedef struct
+{
+    uint8_t *base;
+    size_t capacity;
+    size_t used;
+    size_t highWater;     // Máximo `used` alcanzado
+    uint64_t allocations;
+    uint64_t resets;
+    uint64_t failures;    // Pedidos que no entraron
+} Arena;
+
+bool initArena(Arena *arena, size_t capacity);
+void freeArena(Arena *arena);
+void *arenaAlloc(Arena *arena, size_t size); // NULL si no entra
+void arenaReset(Arena *arena);
+void printArenaStats(const char *name, const Arena *arena);
+
+// Arena propia del hilo que llama: se crea en el primer uso y se libera
+// sola cuando el hilo termina. NULL si no se pudo reservar. La usa la
+// búsqueda del bot, que la resetea en cada jugada: no guardar nada ahí
+// entre jugadas.
+Arena *threadArena(void);
+
+// ============ POOL DE OBJETOS ============
+// `capacity` objetos de tamaño fijo reservados de una vez. Los objetos
+// liberados se encadenan en una free list y se reutilizan primero; los
+// slots nunca usados se entregan en orden, así la memoria del pool solo
+// se toca a medida que se necesita. No es thread-safe: cada pool debe
+// usarse desde un solo hilo.
+//
+// Lo usan las sesiones de tetrisd, que se crean y destruyen con cada
+// conexión. El simulador (battle.c, tuner, tournament) no: sus GameState
+// ya van dentro de Battle, de un arreglo o en la pila, uno por partida y
+// reservados una sola vez, así que avanzar la partida no pide memoria y un
+// pool solo agregaría una indirección.
+
+typedef struct
+{
+    uint8_t *slots;
+    size_t objectSize;
+    int capacity;
+    int nextUnused; // Primer slot que nunca se entregó
+    void *freeList;
+    int used;
+    int highWater;
+    uint64_t allocations;
+    uint64_t resets;
+    uint64_t failures; // Pedidos con el pool lleno
+} ObjectPool;
+
+bool initPool(ObjectPool *pool, size_t objectSize, int capacity);
+void freePool(ObjectPool *pool);
+void *poolAlloc(ObjectPool *pool); // Objeto en cero, o NULL si el pool está lleno
+void poolFree(ObjectPool *pool, void *object);
+void poolReset(ObjectPool *pool); // Devuelve todos los objetos de una vez
+void printPoolStats(const char *name, const ObjectPool *pool);
+
+#endif // ARENA_H
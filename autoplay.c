@@ -0,0 +1,146 @@
+#include "autoplay.h"
+#include <stdio.h>
+#include "bot.h"
+#include "finesse.h"
+#include "render.h"
+#include "ui.h"
+
+#define AUTOPLAY_DEFAULT_KEYS_PER_SECOND 8 // Jugador rápido pero humano
+#define AUTOPLAY_MAX_KEYS_PER_SECOND (TARGET_FPS / 2) // Un tick apretada, uno suelta
+
+typedef struct
+{
+    BotMove target;
+    FinessePath path;
+    int nextKey;
+    int plannedPiece; // piecesPlaced cuando se planificó (-1 = sin plan)
+    bool replanned;   // Ya se recalculó el camino de esta pieza
+    int keysPerSecond;
+    int keyTicks; // Ticks entre toques
+    int waitTicks;
+    long keysPressed;
+} Autoplayer;
+
+// Teclas para este tick: cada toque se aprieta un tick y se suelta hasta el
+// siguiente; al terminar el camino se mantiene abajo hasta que se fije
+static unsigned autoplayInputs(Autoplayer *player, const GameState *state)
+{
+    if (state->gameOver)
+        return 0;
+
+    if (player->plannedPiece != state->piecesPlaced)
+    {
+        player->plannedPiece = state->piecesPlaced;
+        player->nextKey = 0;
+        player->replanned = false;
+        player->path.length = 0;
+        if (findBestMove(state, &DEFAULT_BOT_WEIGHTS, &player->target))
+            planFinesse(state, player->target.rotation, player->target.x, player->target.y, &player->path);
+        player->waitTicks = 1; // Soltar el abajo de la pieza anterior
+    }
+
+    if (player->waitTicks > 0)
+    {
+        player->waitTicks--;
+        return 0;
+    }
+
+    // La gravedad puede trabar el camino: recalcular una vez desde donde está
+    if (player->nextKey >= player->path.length && !player->replanned &&
+        !finesseReached(state, player->target.rotation, player->target.x))
+    {
+        player->replanned = true;
+        player->nextKey = 0;
+        if (!findFinessePath(state, player->target.rotation, player->target.x, player->target.y, &player->path))
+            player->path.length = 0;
+    }
+
+    if (player->nextKey < player->path.length)
+    {
+        player->waitTicks = player->keyTicks - 1;
+        player->keysPressed++;
+        return player->path.keys[player->nextKey++];
+    }
+    return INPUT_DOWN;
+}
+
+static void renderAutoplay(SDL_Renderer *renderer, const GameState *state, const Autoplayer *player)
+{
+    SDL_SetRenderDrawColor(renderer, COLOR_BACKGROUND_R, COLOR_BACKGROUND_G, COLOR_BACKGROUND_B, COLOR_BACKGROUND_A);
+    SDL_RenderClear(renderer);
+
+    renderGameInterpolated(renderer, BOARD_OFFSET_X, BOARD_OFFSET_Y, state, state, 0.0f);
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color red = {255, 100, 100, 255};
+    char text[100];
+
+    snprintf(text, sizeof(text), "Autoplay: %d teclas/s (+/-)   Puntos: %d", player->keysPerSecond, state->score);
+    renderText(renderer, text, 10, 10, white);
+    snprintf(text, sizeof(text), "Piezas: %d   Lineas: %d   Teclas por pieza: %.2f", state->piecesPlaced,
+             state->totalLinesCleared,
+             state->piecesPlaced > 0 ? (double)player->keysPressed / state->piecesPlaced : 0.0);
+    renderText(renderer, text, 10, WINDOW_HEIGHT - 40, white);
+
+    if (state->gameOver)
+        renderTextCentered(renderer, "GAME OVER", WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2, red);
+
+    SDL_RenderPresent(renderer);
+}
+
+void runAutoplay(SDL_Renderer *renderer, uint32_t seed)
+{
+    GameState game;
+    Autoplayer player = {0};
+    initGame(&game, seed);
+    player.plannedPiece = -1;
+    player.keysPerSecond = AUTOPLAY_DEFAULT_KEYS_PER_SECOND;
+    player.keyTicks = TARGET_FPS / player.keysPerSecond;
+
+    printf("Autoplay con semilla %u\n", seed);
+
+    bool running = true;
+    Uint32 lastTime = SDL_GetTicks();
+    Uint32 accumulator = 0; // En milésimas de tick
+    SDL_Event event;
+
+    while (running)
+    {
+        while (SDL_PollEvent(&event))
+        {
+            if (event.type == SDL_QUIT ||
+                (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE))
+            {
+                running = false;
+            }
+            else if (event.type == SDL_KEYDOWN)
+            {
+                SDL_Keycode key = event.key.keysym.sym;
+                if ((key == SDLK_PLUS || key == SDLK_EQUALS || key == SDLK_KP_PLUS) &&
+                    player.keysPerSecond < AUTOPLAY_MAX_KEYS_PER_SECOND)
+                    player.keysPerSecond++;
+                else if ((key == SDLK_MINUS || key == SDLK_KP_MINUS) && player.keysPerSecond > 1)
+                    player.keysPerSecond--;
+                player.keyTicks = TARGET_FPS / player.keysPerSecond;
+            }
+        }
+
+        Uint32 now = SDL_GetTicks();
+        accumulator += (now - lastTime) * TARGET_FPS;
+        lastTime = now;
+        if (accumulator > 4 * 1000)
+            accumulator = 4 * 1000;
+
+        while (accumulator >= 1000)
+        {
+            stepGame(&game, autoplayInputs(&player, &game));
+            accumulator -= 1000;
+        }
+
+        renderAutoplay(renderer, &game, &player);
+        SDL_Delay(1);
+    }
+
+    printf("Autoplay terminado: %d piezas, %d líneas, %ld teclas\n", game.piecesPlaced, game.totalLinesCleared,
+           player.keysPressed);
+}
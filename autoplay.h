@@ -0,0 +1,12 @@
+#ifndef AUTOPLAY_H
+#define AUTOPLAY_H
+
+#include <SDL.h>
+#include <stdint.h>
+
+// Autoplay: el bot juega en la ventana tocando las teclas del camino de
+// finesse (ver finesse.h) a un ritmo humano. +/- cambian las teclas por
+// segundo y ESC sale.
+void runAutoplay(SDL_Renderer *renderer, uint32_t seed);
+
+#endif // AUTOPLAY_H
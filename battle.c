@@ -0,0 +1,281 @@
+#include "battle.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "metrics.h"
+
+// Misma tabla que el versus: 2 líneas = 1, 3 = 2, 4 = 4
+static const int GARBAGE_TABLE[5] = {0, 0, 1, 2, 4};
+
+int getCpuCount(void)
+{
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+// ============ FASE 1: TABLEROS EN PARALELO ============
+
+static void stepChunk(BattleChunk *chunk)
+{
+    Battle *battle = chunk->battle;
+
+    for (int p = chunk->first; p < chunk->last; p++)
+    {
+        GameState *game = &battle->games[p];
+        battle->lines[p] = 0;
+        battle->locked[p] = false;
+        if (game->gameOver)
+            continue;
+
+        unsigned inputs = p == battle->humanPlayer ? battle->humanInputs
+                                                   : botInputs(&battle->bots[p], game);
+        int piecesBefore = game->piecesPlaced;
+        battle->lines[p] = stepGame(game, inputs);
+        battle->locked[p] = game->piecesPlaced != piecesBefore;
+
+        // Shard del hilo worker: sin contención entre hilos
+        if (battle->locked[p])
+        {
+            metricsAdd(METRIC_PIECES_PLACED, 1);
+            metricsLinesCleared(battle->lines[p]);
+        }
+        if (game->gameOver)
+            metricsAdd(METRIC_GAMES_FINISHED, 1);
+    }
+}
+
+static void *battleWorker(void *arg)
+{
+    BattleChunk *chunk = (BattleChunk *)arg;
+    Battle *battle = chunk->battle;
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        pthread_mutex_lock(&battle->mutex);
+        while (battle->generation == seenGeneration && !battle->exiting)
+        {
+            pthread_cond_wait(&battle->startCond, &battle->mutex);
+        }
+        if (battle->exiting)
+        {
+            pthread_mutex_unlock(&battle->mutex);
+            break;
+        }
+        seenGeneration = battle->generation;
+        pthread_mutex_unlock(&battle->mutex);
+
+        stepChunk(chunk);
+
+        pthread_mutex_lock(&battle->mutex);
+        if (--battle->pendingChunks == 0)
+            pthread_cond_signal(&battle->doneCond);
+        pthread_mutex_unlock(&battle->mutex);
+    }
+
+    return NULL;
+}
+
+// ============ FASE 2: BASURA Y ELIMINACIONES ============
+
+static int randomAliveOpponent(Battle *battle, int player)
+{
+    if (battle->alive <= 1)
+        return player;
+
+    // Elegir el k-ésimo rival vivo
+    int k = (int)(nextRandom(&battle->rng) % (uint32_t)(battle->alive - 1));
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        if (p == player || battle->placement[p] != 0)
+            continue;
+        if (k-- == 0)
+            return p;
+    }
+    return player;
+}
+
+static void resolveGarbage(Battle *battle)
+{
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        if (battle->lines[p] == 0)
+            continue;
+
+        int attack = GARBAGE_TABLE[battle->lines[p] > 4 ? 4 : battle->lines[p]];
+        int cancelled = attack < battle->pendingGarbage[p] ? attack : battle->pendingGarbage[p];
+        battle->pendingGarbage[p] -= cancelled;
+        attack -= cancelled;
+
+        int target = battle->target[p];
+        if (attack > 0 && target != p)
+            battle->pendingGarbage[target] += attack;
+    }
+
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        if (battle->locked[p] && battle->lines[p] == 0 && battle->pendingGarbage[p] > 0)
+        {
+            int hole = (int)(nextRandom(&battle->rng) % GRID_WIDTH);
+            addGarbageLines(&battle->games[p], battle->pendingGarbage[p], hole);
+            battle->pendingGarbage[p] = 0;
+        }
+    }
+
+    // Eliminados de este tick: se llevan el puesto actual
+    int eliminated = 0;
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        if (battle->placement[p] == 0 && battle->games[p].gameOver)
+        {
+            battle->placement[p] = battle->alive;
+            battle->pendingGarbage[p] = 0;
+            eliminated++;
+        }
+    }
+    battle->alive -= eliminated;
+
+    if (battle->alive == 1)
+    {
+        for (int p = 0; p < BATTLE_PLAYERS; p++)
+        {
+            if (battle->placement[p] == 0)
+                battle->placement[p] = 1;
+        }
+    }
+
+    // Quien se quedó sin rival elige otro
+    if (eliminated > 0)
+    {
+        for (int p = 0; p < BATTLE_PLAYERS; p++)
+        {
+            if (battle->placement[p] == 0 && battle->placement[battle->target[p]] != 0)
+                battle->target[p] = randomAliveOpponent(battle, p);
+        }
+    }
+}
+
+// ============ API ============
+
+Battle *createBattle(uint32_t seed, int humanPlayer, int numThreads)
+{
+    Battle *battle = calloc(1, sizeof(Battle));
+    if (battle == NULL)
+    {
+        printf("Error al reservar memoria para la batalla\n");
+        return NULL;
+    }
+
+    battle->rng = seed != 0 ? seed : 1;
+    battle->humanPlayer = humanPlayer;
+    battle->alive = BATTLE_PLAYERS;
+
+    // Cada jugador con su propia secuencia de piezas
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        initGame(&battle->games[p], nextRandom(&battle->rng));
+        initBot(&battle->bots[p], &DEFAULT_BOT_WEIGHTS);
+    }
+    metricsAdd(METRIC_GAMES_STARTED, BATTLE_PLAYERS);
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        battle->target[p] = randomAliveOpponent(battle, p);
+    }
+
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > BATTLE_MAX_THREADS)
+        numThreads = BATTLE_MAX_THREADS;
+    if (numThreads > BATTLE_PLAYERS)
+        numThreads = BATTLE_PLAYERS;
+
+    for (int i = 0; i < numThreads; i++)
+    {
+        battle->chunks[i].battle = battle;
+        battle->chunks[i].first = i * BATTLE_PLAYERS / numThreads;
+        battle->chunks[i].last = (i + 1) * BATTLE_PLAYERS / numThreads;
+    }
+
+    pthread_mutex_init(&battle->mutex, NULL);
+    pthread_cond_init(&battle->startCond, NULL);
+    pthread_cond_init(&battle->doneCond, NULL);
+
+    battle->numThreads = 1;
+    for (int i = 1; i < numThreads; i++)
+    {
+        if (pthread_create(&battle->threads[i], NULL, battleWorker, &battle->chunks[i]) != 0)
+        {
+            printf("Error al crear hilo de la batalla, se usan %d\n", battle->numThreads);
+            break;
+        }
+        battle->numThreads++;
+    }
+
+    // Si no se pudieron crear todos los hilos, repartir de nuevo
+    if (battle->numThreads != numThreads)
+    {
+        pthread_mutex_lock(&battle->mutex);
+        for (int i = 0; i < battle->numThreads; i++)
+        {
+            battle->chunks[i].first = i * BATTLE_PLAYERS / battle->numThreads;
+            battle->chunks[i].last = (i + 1) * BATTLE_PLAYERS / battle->numThreads;
+        }
+        pthread_mutex_unlock(&battle->mutex);
+    }
+
+    return battle;
+}
+
+void destroyBattle(Battle *battle)
+{
+    if (battle == NULL)
+        return;
+
+    pthread_mutex_lock(&battle->mutex);
+    battle->exiting = true;
+    pthread_cond_broadcast(&battle->startCond);
+    pthread_mutex_unlock(&battle->mutex);
+
+    for (int i = 1; i < battle->numThreads; i++)
+    {
+        pthread_join(battle->threads[i], NULL);
+    }
+
+    pthread_mutex_destroy(&battle->mutex);
+    pthread_cond_destroy(&battle->startCond);
+    pthread_cond_destroy(&battle->doneCond);
+    free(battle);
+}
+
+void stepBattle(Battle *battle, unsigned humanInputs)
+{
+    if (battle->alive <= 1)
+        return;
+
+    battle->humanInputs = humanInputs;
+    battle->tick++;
+
+    if (battle->numThreads > 1)
+    {
+        pthread_mutex_lock(&battle->mutex);
+        battle->pendingChunks = battle->numThreads - 1;
+        battle->generation++;
+        pthread_cond_broadcast(&battle->startCond);
+        pthread_mutex_unlock(&battle->mutex);
+    }
+
+    stepChunk(&battle->chunks[0]);
+
+    if (battle->numThreads > 1)
+    {
+        pthread_mutex_lock(&battle->mutex);
+        while (battle->pendingChunks > 0)
+        {
+            pthread_cond_wait(&battle->doneCond, &battle->mutex);
+        }
+        pthread_mutex_unlock(&battle->mutex);
+    }
+
+    resolveGarbage(battle);
+}
@@ -0,0 +1,64 @@
+#ifndef BATTLE_H
+#define BATTLE_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "bot.h"
+#include "game.h"
+
+// ============ BATALLA DE 99 ============
+// 99 partidas en el mismo proceso (un humano opcional y el resto bots).
+// Las líneas eliminadas se mandan como basura a un rival vivo elegido al
+// azar. Cada tick tiene dos fases:
+//   1. En paralelo: cada hilo avanza su bloque de tableros (inputs + stepGame).
+//   2. En el hilo principal: reparto de basura y eliminaciones.
+// La fase 1 no comparte estado entre tableros y la fase 2 es secuencial,
+// así que el resultado es el mismo con cualquier cantidad de hilos.
+
+#define BATTLE_PLAYERS 99
+#define BATTLE_MAX_THREADS 32
+#define BATTLE_NO_HUMAN -1
+
+typedef struct Battle Battle;
+
+typedef struct
+{
+    Battle *battle;
+    int first; // Tableros [first, last)
+    int last;
+} BattleChunk;
+
+struct Battle
+{
+    GameState games[BATTLE_PLAYERS];
+    Bot bots[BATTLE_PLAYERS];
+    int pendingGarbage[BATTLE_PLAYERS];
+    int target[BATTLE_PLAYERS];    // A quién le manda basura cada jugador
+    int placement[BATTLE_PLAYERS]; // Puesto final (0 = sigue vivo)
+    int lines[BATTLE_PLAYERS];     // Resultado de la fase 1 del último tick
+    bool locked[BATTLE_PLAYERS];
+    int alive;
+    int humanPlayer; // BATTLE_NO_HUMAN = todos bots
+    unsigned humanInputs;
+    uint32_t rng;
+    uint32_t tick;
+
+    // Hilos de la fase 1 (el hilo principal procesa chunks[0])
+    int numThreads;
+    BattleChunk chunks[BATTLE_MAX_THREADS];
+    pthread_t threads[BATTLE_MAX_THREADS];
+    pthread_mutex_t mutex;
+    pthread_cond_t startCond;
+    pthread_cond_t doneCond;
+    uint64_t generation;
+    int pendingChunks;
+    bool exiting;
+};
+
+Battle *createBattle(uint32_t seed, int humanPlayer, int numThreads);
+void destroyBattle(Battle *battle);
+void stepBattle(Battle *battle, unsigned humanInputs);
+int getCpuCount(void);
+
+#endif // BATTLE_H
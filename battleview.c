@@ -0,0 +1,107 @@
+#include "battleview.h"
+#include <stdio.h>
+#include "battle.h"
+#include "render.h"
+#include "ui.h"
+
+#define HUMAN_PLAYER 0
+#define MAIN_BOARD_X 40
+#define MINI_CELL_SIZE 3
+#define MINI_COLUMNS 13
+#define MINI_ORIGIN_X (WINDOW_WIDTH - MINI_COLUMNS * (GRID_WIDTH * MINI_CELL_SIZE + MINI_BOARD_SPACING))
+
+static void renderBattle(SDL_Renderer *renderer, const Battle *battle, double stepMs)
+{
+    SDL_SetRenderDrawColor(renderer, COLOR_BACKGROUND_R, COLOR_BACKGROUND_G, COLOR_BACKGROUND_B, COLOR_BACKGROUND_A);
+    SDL_RenderClear(renderer);
+
+    GameState *human = (GameState *)&battle->games[HUMAN_PLAYER];
+    renderBoardAt(renderer, MAIN_BOARD_X, BOARD_OFFSET_Y, human->grid, human->currentPiece,
+                  human->currentType, human->pieceX, human->pieceY);
+
+    // Basura pendiente: barra roja al costado del tablero
+    if (battle->pendingGarbage[HUMAN_PLAYER] > 0)
+    {
+        int pending = battle->pendingGarbage[HUMAN_PLAYER];
+        int height = (pending > GRID_HEIGHT ? GRID_HEIGHT : pending) * CELL_SIZE;
+        SDL_Rect bar = {MAIN_BOARD_X + GRID_WIDTH * CELL_SIZE + 4,
+                        BOARD_OFFSET_Y + GRID_HEIGHT * CELL_SIZE - height, 8, height};
+        SDL_SetRenderDrawColor(renderer, 240, 0, 0, 255);
+        SDL_RenderFillRect(renderer, &bar);
+    }
+
+    // Los 98 rivales en miniatura, todos en un solo lote
+    renderMiniBoards(renderer, &battle->games[HUMAN_PLAYER + 1], BATTLE_PLAYERS - 1,
+                     MINI_ORIGIN_X, BOARD_OFFSET_Y, MINI_COLUMNS, MINI_CELL_SIZE);
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color red = {255, 100, 100, 255};
+    char text[100];
+
+    snprintf(text, sizeof(text), "Vivos: %d/%d   Puntos: %d", battle->alive, BATTLE_PLAYERS, human->score);
+    renderText(renderer, text, MAIN_BOARD_X, 10, white);
+    snprintf(text, sizeof(text), "Tick: %.2f ms (%d hilos)", stepMs, battle->numThreads);
+    renderText(renderer, text, MINI_ORIGIN_X, 10, white);
+
+    int place = battle->placement[HUMAN_PLAYER];
+    if (place != 0)
+    {
+        snprintf(text, sizeof(text), place == 1 ? "GANASTE!" : "Puesto #%d", place);
+        renderTextCentered(renderer, text, MAIN_BOARD_X + GRID_WIDTH * CELL_SIZE / 2, WINDOW_HEIGHT / 2, red);
+    }
+
+    SDL_RenderPresent(renderer);
+}
+
+void runBattle(SDL_Renderer *renderer, uint32_t seed)
+{
+    Battle *battle = createBattle(seed, HUMAN_PLAYER, getCpuCount());
+    if (battle == NULL)
+        return;
+
+    printf("Batalla de %d jugadores con %d hilos (semilla %u)\n", BATTLE_PLAYERS, battle->numThreads, seed);
+
+    bool running = true;
+    Uint32 lastTime = SDL_GetTicks();
+    Uint32 accumulator = 0; // En milésimas de tick
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    double stepMs = 0.0;
+    SDL_Event event;
+
+    while (running)
+    {
+        while (SDL_PollEvent(&event))
+        {
+            if (event.type == SDL_QUIT ||
+                (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE))
+            {
+                running = false;
+            }
+        }
+
+        Uint32 now = SDL_GetTicks();
+        accumulator += (now - lastTime) * TARGET_FPS;
+        lastTime = now;
+
+        // Si la máquina se atrasa, no intentar recuperar más de 4 ticks por frame
+        if (accumulator > 4 * 1000)
+            accumulator = 4 * 1000;
+
+        unsigned inputs = readHeldInputs();
+        while (accumulator >= 1000)
+        {
+            Uint64 start = SDL_GetPerformanceCounter();
+            stepBattle(battle, inputs);
+            double elapsed = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)frequency;
+            stepMs = stepMs * 0.95 + elapsed * 0.05; // Promedio móvil para el overlay
+            accumulator -= 1000;
+        }
+
+        renderBattle(renderer, battle, stepMs);
+        SDL_Delay(1);
+    }
+
+    printf("Batalla terminada en el tick %u: puesto %d\n", battle->tick,
+           battle->placement[HUMAN_PLAYER] != 0 ? battle->placement[HUMAN_PLAYER] : battle->alive);
+    destroyBattle(battle);
+}
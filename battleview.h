@@ -0,0 +1,10 @@
+#ifndef BATTLEVIEW_H
+#define BATTLEVIEW_H
+
+#include <SDL.h>
+#include <stdint.h>
+
+// Modo batalla: el jugador contra 98 bots (ver battle.h)
+void runBattle(SDL_Renderer *renderer, uint32_t seed);
+
+#endif // BATTLEVIEW_H
@@ -0,0 +1,119 @@
+#include "bitboard.h"
+#include <pthread.h>
+#include "game.h"
+
+// ============ MÁSCARAS DE PIEZAS ============
+
+static PieceMask pieceMasks[NUM_PIECES][4];
+static pthread_once_t pieceMasksOnce = PTHREAD_ONCE_INIT;
+
+// Mismas rotaciones que el motor: PIECES rotada con rotatePiece()
+static void buildPieceMasks(void)
+{
+    for (int type = 0; type < NUM_PIECES; type++)
+    {
+        int shape[4][4];
+        copyPiece(shape, PIECES[type]);
+        for (int rotation = 0; rotation < 4; rotation++)
+        {
+            for (int r = 0; r < 4; r++)
+            {
+                uint8_t bits = 0;
+                for (int c = 0; c < 4; c++)
+                {
+                    if (shape[r][c] == 1)
+                        bits |= (uint8_t)(1u << c);
+                }
+                pieceMasks[type][rotation].rows[r] = bits;
+            }
+            rotatePiece(shape);
+        }
+    }
+}
+
+const PieceMask *getPieceMask(PieceType type, int rotation)
+{
+    pthread_once(&pieceMasksOnce, buildPieceMasks);
+    return &pieceMasks[type][rotation & 3];
+}
+
+// ============ VARIANTES ============
+
+DEFINE_BOARD_KERNELS(TallBoard, tall, uint16_t, 16, 32)
+DEFINE_BOARD_KERNELS(WideBoard, wide, uint32_t, 24, 30)
+DEFINE_BOARD_KERNELS(HugeBoard, huge, uint64_t, 48, 48)
+
+// Adaptadores void * -> tipo concreto y entrada de la tabla
+#define DEFINE_BOARD_DISPATCH(TYPE, PREFIX, NAME, W, H)                                                \
+    static bool PREFIX##CollidesAny(const void *board, const PieceMask *piece, int x, int y)            \
+    {                                                                                                  \
+        return PREFIX##Collides((const TYPE *)board, piece, x, y);                                     \
+    }                                                                                                  \
+    static void PREFIX##LockAny(void *board, const PieceMask *piece, int x, int y)                     \
+    {                                                                                                  \
+        PREFIX##Lock((TYPE *)board, piece, x, y);                                                      \
+    }                                                                                                  \
+    static int PREFIX##ClearLinesAny(void *board)                                                      \
+    {                                                                                                  \
+        return PREFIX##ClearLines((TYPE *)board);                                                      \
+    }                                                                                                  \
+    static int PREFIX##DropYAny(const void *board, const PieceMask *piece, int x, int y)               \
+    {                                                                                                  \
+        return PREFIX##DropY((const TYPE *)board, piece, x, y);                                        \
+    }                                                                                                  \
+    static int PREFIX##ColumnHeightsAny(const void *board, int *heights)                               \
+    {                                                                                                  \
+        return PREFIX##ColumnHeights((const TYPE *)board, heights);                                    \
+    }                                                                                                  \
+    static void PREFIX##FromCellsAny(void *board, const int *cells)                                    \
+    {                                                                                                  \
+        PREFIX##FromCells((TYPE *)board, cells);                                                       \
+    }                                                                                                  \
+    static int PREFIX##PlacePieceAny(void *board, const PieceMask *piece, int x, int y, int *lines)    \
+    {                                                                                                  \
+        TYPE *typed = (TYPE *)board;                                                                   \
+        if (PREFIX##Collides(typed, piece, x, y))                                                      \
+            return -1;                                                                                 \
+        y = PREFIX##DropY(typed, piece, x, y);                                                         \
+        PREFIX##Lock(typed, piece, x, y);                                                              \
+        *lines = PREFIX##ClearLines(typed);                                                            \
+        return y;                                                                                      \
+    }                                                                                                  \
+    static const BoardKernels PREFIX##Kernels = {                                                      \
+        NAME, (W), (H), (int)(sizeof(((TYPE *)0)->rows[0]) * 8), sizeof(TYPE),                         \
+        PREFIX##CollidesAny, PREFIX##LockAny, PREFIX##ClearLinesAny, PREFIX##DropYAny,                 \
+        PREFIX##ColumnHeightsAny, PREFIX##FromCellsAny, PREFIX##PlacePieceAny};
+
+DEFINE_BOARD_DISPATCH(StandardBoard, standard, "estándar", GRID_WIDTH, GRID_HEIGHT)
+DEFINE_BOARD_DISPATCH(TallBoard, tall, "alto", 16, 32)
+DEFINE_BOARD_DISPATCH(WideBoard, wide, "ancho", 24, 30)
+DEFINE_BOARD_DISPATCH(HugeBoard, huge, "gigante", 48, 48)
+
+static const BoardKernels *const BOARD_KERNELS[] = {
+    &standardKernels,
+    &tallKernels,
+    &wideKernels,
+    &hugeKernels,
+};
+
+#define NUM_BOARD_KERNELS ((int)(sizeof(BOARD_KERNELS) / sizeof(BOARD_KERNELS[0])))
+
+const BoardKernels *getBoardKernels(int width, int height)
+{
+    for (int i = 0; i < NUM_BOARD_KERNELS; i++)
+    {
+        if (BOARD_KERNELS[i]->width == width && BOARD_KERNELS[i]->height == height)
+            return BOARD_KERNELS[i];
+    }
+    return NULL;
+}
+
+const BoardKernels *getBoardKernelsByIndex(int index)
+{
+    return index >= 0 && index < NUM_BOARD_KERNELS ? BOARD_KERNELS[index] : NULL;
+}
+
+int getBoardKernelCount(void)
+{
+    return NUM_BOARD_KERNELS;
+}
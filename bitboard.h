@@ -0,0 +1,200 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "constants.h"
+
+// ============ BITBOARDS POR TAMAÑO DE TABLERO ============
+// Cada fila del tablero es un entero (bit c = columna c) y cada pieza son
+// 4 filas de 4 bits. Colisión, fijado, caída y limpieza de líneas pasan a
+// ser AND/OR/shifts sobre filas enteras en lugar de recorrer celdas.
+//
+// DEFINE_BOARD_KERNELS genera el tipo de tablero y sus kernels para un
+// ancho y alto fijos en compilación (los bucles y las máscaras quedan
+// constantes). El tipo de fila se elige según el ancho: uint16_t hasta 16
+// columnas, uint32_t hasta 32 y uint64_t hasta 64.
+// Para elegir el tamaño en runtime está la tabla de getBoardKernels().
+
+#define MAX_BOARD_WIDTH 64
+#define MAX_BOARD_HEIGHT 64
+
+// Forma de una pieza ya rotada: bit c de rows[r] = celda (r, c) de la matriz 4x4
+typedef struct
+{
+    uint8_t rows[4];
+} PieceMask;
+
+// Máscara de PIECES[type] rotada `rotation` veces con rotatePiece()
+const PieceMask *getPieceMask(PieceType type, int rotation);
+
+// La pieza tiene bloques por encima del tablero si se fija en la fila `y`
+static inline bool pieceMaskAboveTop(const PieceMask *piece, int y)
+{
+    for (int r = 0; r < 4 && y + r < 0; r++)
+    {
+        if (piece->rows[r] != 0)
+            return true;
+    }
+    return false;
+}
+
+// Fila de la pieza desplazada a la columna x. Devuelve false si algún
+// bloque queda fuera de las columnas [0, width).
+static inline bool shiftPieceRow(unsigned bits, int x, int width, uint64_t *out)
+{
+    uint64_t shifted;
+    if (x < 0)
+    {
+        if (bits & ((1u << -x) - 1u))
+            return false;
+        shifted = (uint64_t)(bits >> -x);
+    }
+    else
+    {
+        shifted = (uint64_t)bits << x;
+    }
+    if (width < 64 && (shifted >> width) != 0)
+        return false;
+    *out = shifted;
+    return true;
+}
+
+#define BOARD_FULL_ROW(W) ((W) >= 64 ? ~0ULL : ((1ULL << (W)) - 1ULL))
+
+// TYPE: nombre del tipo de tablero, PREFIX: prefijo de las funciones,
+// ROW_T: entero de cada fila, W x H: tamaño
+#define DEFINE_BOARD_KERNELS(TYPE, PREFIX, ROW_T, W, H)                                        \
+    _Static_assert((W) <= (int)(sizeof(ROW_T) * 8), "La fila no alcanza para el ancho");       \
+    _Static_assert((H) <= MAX_BOARD_HEIGHT, "Tablero demasiado alto");                         \
+                                                                                               \
+    typedef struct                                                                             \
+    {                                                                                          \
+        ROW_T rows[H];                                                                         \
+    } TYPE;                                                                                    \
+                                                                                               \
+    static inline bool PREFIX##Collides(const TYPE *board, const PieceMask *piece, int x, int y) \
+    {                                                                                          \
+        for (int r = 0; r < 4; r++)                                                            \
+        {                                                                                      \
+            uint64_t bits;                                                                     \
+            if (piece->rows[r] == 0)                                                           \
+                continue;                                                                      \
+            if (!shiftPieceRow(piece->rows[r], x, (W), &bits) || y + r >= (H))                 \
+                return true;                                                                   \
+            if (y + r >= 0 && (board->rows[y + r] & bits) != 0)                                \
+                return true;                                                                   \
+        }                                                                                      \
+        return false;                                                                          \
+    }                                                                                          \
+                                                                                               \
+    /* Los bloques por encima del tablero se descartan (igual que lockPiece) */                \
+    static inline void PREFIX##Lock(TYPE *board, const PieceMask *piece, int x, int y)         \
+    {                                                                                          \
+        for (int r = 0; r < 4; r++)                                                            \
+        {                                                                                      \
+            uint64_t bits;                                                                     \
+            if (y + r >= 0 && y + r < (H) && shiftPieceRow(piece->rows[r], x, (W), &bits))     \
+                board->rows[y + r] |= (ROW_T)bits;                                             \
+        }                                                                                      \
+    }                                                                                          \
+                                                                                               \
+    static inline int PREFIX##ClearLines(TYPE *board)                                          \
+    {                                                                                          \
+        int write = (H) - 1;                                                                   \
+        for (int read = (H) - 1; read >= 0; read--)                                            \
+        {                                                                                      \
+            if ((uint64_t)board->rows[read] != BOARD_FULL_ROW(W))                              \
+                board->rows[write--] = board->rows[read];                                      \
+        }                                                                                      \
+        int cleared = write + 1;                                                               \
+        for (; write >= 0; write--)                                                            \
+            board->rows[write] = 0;                                                            \
+        return cleared;                                                                        \
+    }                                                                                          \
+                                                                                               \
+    /* Fila donde se detiene la pieza soltada desde y (que no debe colisionar) */              \
+    static inline int PREFIX##DropY(const TYPE *board, const PieceMask *piece, int x, int y)   \
+    {                                                                                          \
+        while (!PREFIX##Collides(board, piece, x, y + 1))                                      \
+            y++;                                                                               \
+        return y;                                                                              \
+    }                                                                                          \
+                                                                                               \
+    /* Altura de cada columna; devuelve los huecos (vacías con un bloque encima) */            \
+    static inline int PREFIX##ColumnHeights(const TYPE *board, int heights[W])                 \
+    {                                                                                          \
+        uint64_t covered = 0;                                                                  \
+        int holes = 0;                                                                         \
+        for (int c = 0; c < (W); c++)                                                          \
+            heights[c] = 0;                                                                    \
+        for (int r = 0; r < (H); r++)                                                          \
+        {                                                                                      \
+            uint64_t row = board->rows[r];                                                     \
+            uint64_t fresh = row & ~covered;                                                   \
+            holes += __builtin_popcountll(covered & ~row);                                     \
+            while (fresh != 0)                                                                 \
+            {                                                                                  \
+                heights[__builtin_ctzll(fresh)] = (H) - r;                                     \
+                fresh &= fresh - 1;                                                            \
+            }                                                                                  \
+            covered |= row;                                                                    \
+        }                                                                                      \
+        return holes;                                                                          \
+    }                                                                                          \
+                                                                                               \
+    /* Desde una grilla de celdas 0/1 (fila por fila, W por fila) */                           \
+    static inline void PREFIX##FromCells(TYPE *board, const int *cells)                        \
+    {                                                                                          \
+        for (int r = 0; r < (H); r++)                                                          \
+        {                                                                                      \
+            ROW_T row = 0;                                                                     \
+            for (int c = 0; c < (W); c++)                                                      \
+            {                                                                                  \
+                if (cells[r * (W) + c] != 0)                                                   \
+                    row |= (ROW_T)((ROW_T)1 << c);                                             \
+            }                                                                                  \
+            board->rows[r] = row;                                                              \
+        }                                                                                      \
+    }
+
+// El tablero del juego (GRID_WIDTH x GRID_HEIGHT): StandardBoard, standardCollides, ...
+// con el entero más chico que alcanza para una fila
+#if GRID_WIDTH <= 16
+typedef uint16_t StandardRow;
+#elif GRID_WIDTH <= 32
+typedef uint32_t StandardRow;
+#else
+typedef uint64_t StandardRow;
+#endif
+DEFINE_BOARD_KERNELS(StandardBoard, standard, StandardRow, GRID_WIDTH, GRID_HEIGHT)
+
+// ============ DESPACHO EN RUNTIME ============
+// Un juego de kernels por tamaño soportado. El tablero se pasa como void *
+// y debe tener boardSize bytes; cada entrada llama a los kernels
+// especializados de su tamaño.
+
+typedef struct
+{
+    const char *name;
+    int width;
+    int height;
+    int rowBits;
+    size_t boardSize;
+    bool (*collides)(const void *board, const PieceMask *piece, int x, int y);
+    void (*lock)(void *board, const PieceMask *piece, int x, int y);
+    int (*clearLines)(void *board);
+    int (*dropY)(const void *board, const PieceMask *piece, int x, int y);
+    int (*columnHeights)(const void *board, int *heights);
+    void (*fromCells)(void *board, const int *cells);
+    // Caída + fijado + limpieza en una sola llamada. Devuelve la fila donde
+    // quedó la pieza o -1 si no entra en (x, y); las líneas van en *lines.
+    int (*placePiece)(void *board, const PieceMask *piece, int x, int y, int *lines);
+} BoardKernels;
+
+const BoardKernels *getBoardKernels(int width, int height); // NULL si no hay variante
+const BoardKernels *getBoardKernelsByIndex(int index);       // NULL al pasarse
+int getBoardKernelCount(void);
+
+#endif // BITBOARD_H
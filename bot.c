@@ -0,0 +1,213 @@
+#include "bot.h"
+#include <string.h>
+#include "arena.h"
+#include "bitboard.h"
+#include "placement.h"
+
+const BotWeights DEFAULT_BOT_WEIGHTS = {{-0.510066f, 0.760666f, -0.35663f, -0.184483f}};
+
+// Features de un bitboard: alturas y huecos salen de standardColumnHeights()
+static void boardFeatures(const StandardBoard *board, int linesCleared, float features[NUM_BOT_FEATURES])
+{
+    int heights[GRID_WIDTH];
+    int holes = standardColumnHeights(board, heights);
+
+    int aggregateHeight = 0;
+    int bumpiness = 0;
+    for (int col = 0; col < GRID_WIDTH; col++)
+    {
+        aggregateHeight += heights[col];
+        if (col > 0)
+            bumpiness += heights[col] > heights[col - 1] ? heights[col] - heights[col - 1]
+                                                          : heights[col - 1] - heights[col];
+    }
+
+    features[FEATURE_HEIGHT] = (float)aggregateHeight;
+    features[FEATURE_LINES] = (float)linesCleared;
+    features[FEATURE_HOLES] = (float)holes;
+    features[FEATURE_BUMPINESS] = (float)bumpiness;
+}
+
+// Features del tablero después de fijar una pieza y eliminar sus líneas
+void computeBoardFeatures(int grid[GRID_HEIGHT][GRID_WIDTH], int linesCleared,
+                          float features[NUM_BOT_FEATURES])
+{
+    StandardBoard board;
+    standardFromCells(&board, &grid[0][0]);
+    boardFeatures(&board, linesCleared, features);
+}
+
+// ============ BÚSQUEDA ============
+// Cada nodo es una colocación de la pieza actual, evaluada al generarla.
+// Los nodos viven en la arena del hilo, que se resetea al empezar cada
+// jugada: la búsqueda no hace ningún malloc/free. Los tableros son
+// bitboards (StandardBoard): colisión, caída y limpieza trabajan con filas
+// enteras.
+
+#define MAX_PLACEMENTS (4 * (GRID_WIDTH + 3))
+#define DEAD_SCORE -1e9f
+
+typedef struct
+{
+    int rotation;
+    int x;
+    int y;
+    float score;
+} SearchNode;
+
+static float scoreFeatures(const float features[NUM_BOT_FEATURES], bool dead, const BotWeights *weights)
+{
+    float score = 0.0f;
+    for (int i = 0; i < NUM_BOT_FEATURES; i++)
+    {
+        score += weights->weights[i] * features[i];
+    }
+    return dead ? score + DEAD_SCORE : score;
+}
+
+// Genera y evalúa todas las colocaciones de `type` sobre `board` partiendo
+// de la fila `startY`.
+//
+// Caídas y features salen de evaluatePlacements() (todas las columnas de
+// una vez). Solo se baja la pieza fila por fila cuando arranca por debajo
+// del perfil del tablero, y solo se fija en el bitboard cuando la
+// colocación elimina líneas o pierde la partida.
+static int expandPlacements(Arena *arena, const StandardBoard *board, PieceType type, int startY,
+                            const BotWeights *weights, SearchNode **out)
+{
+    SearchNode *nodes = arenaAlloc(arena, sizeof(SearchNode) * MAX_PLACEMENTS);
+    if (nodes == NULL)
+        return 0;
+
+    PlacementSet placements;
+    StandardBoard scratch;
+    float features[NUM_BOT_FEATURES];
+    int count = 0;
+    evaluatePlacements(board, type, &placements);
+
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        const PieceMask *piece = getPieceMask(type, rotation);
+        const RotationPlacements *candidates = &placements.rotations[rotation];
+
+        for (int lane = 0; lane < candidates->count; lane++)
+        {
+            int x = candidates->firstX + lane;
+            int y = candidates->landingY[lane];
+            bool fromAbove = startY <= y;
+            if (!fromAbove)
+            {
+                if (standardCollides(board, piece, x, startY))
+                    continue;
+                y = standardDropY(board, piece, x, startY);
+            }
+
+            SearchNode *node = &nodes[count++];
+            node->rotation = rotation;
+            node->x = x;
+            node->y = y;
+            bool dead = pieceMaskAboveTop(piece, y);
+
+            if (fromAbove && !dead && !placementClearsLines(board, piece, x, y))
+            {
+                features[FEATURE_HEIGHT] = (float)candidates->heightSum[lane];
+                features[FEATURE_LINES] = 0.0f;
+                features[FEATURE_HOLES] = (float)candidates->holes[lane];
+                features[FEATURE_BUMPINESS] = (float)placementBumpiness(&placements, rotation, lane);
+                node->score = scoreFeatures(features, false, weights);
+                continue;
+            }
+
+            scratch = *board;
+            standardLock(&scratch, piece, x, y);
+            boardFeatures(&scratch, standardClearLines(&scratch), features);
+            node->score = scoreFeatures(features, dead, weights);
+        }
+    }
+
+    *out = nodes;
+    return count;
+}
+
+// Evalúa todas las rotaciones y columnas de la pieza actual alcanzables
+// desde su fila actual
+bool findBestMove(const GameState *state, const BotWeights *weights, BotMove *best)
+{
+    Arena *arena = threadArena();
+    if (arena == NULL)
+        return false;
+    arenaReset(arena);
+
+    StandardBoard root;
+    standardFromCells(&root, &state->grid[0][0]);
+
+    SearchNode *nodes = NULL;
+    int count = expandPlacements(arena, &root, state->currentType, state->pieceY, weights, &nodes);
+
+    for (int i = 0; i < count; i++)
+    {
+        if (i == 0 || nodes[i].score > best->score)
+        {
+            best->rotation = nodes[i].rotation;
+            best->x = nodes[i].x;
+            best->y = nodes[i].y;
+            best->score = nodes[i].score;
+        }
+    }
+
+    return count > 0;
+}
+
+void initBot(Bot *bot, const BotWeights *weights)
+{
+    memset(bot, 0, sizeof(*bot));
+    bot->weights = *weights;
+    bot->plannedPiece = -1;
+}
+
+// Teclas para este tick. Cada tecla se suelta un tick después de aplicarse
+// (soltar reinicia el autorepeat), así el bot mueve una celda cada 2 ticks.
+unsigned botInputs(Bot *bot, const GameState *state)
+{
+    if (state->gameOver)
+        return 0;
+
+    // Pieza nueva: planificar
+    if (bot->plannedPiece != state->piecesPlaced)
+    {
+        if (!findBestMove(state, &bot->weights, &bot->target))
+        {
+            bot->target.rotation = state->rotation;
+            bot->target.x = state->pieceX;
+        }
+        bot->plannedPiece = state->piecesPlaced;
+    }
+
+    unsigned inputs = 0;
+    if (state->rotation != bot->target.rotation)
+    {
+        if (state->rotateCooldown == 0)
+            inputs |= INPUT_ROTATE;
+    }
+    else if (state->moveCooldown == 0)
+    {
+        if (state->pieceX < bot->target.x)
+            inputs |= INPUT_RIGHT;
+        else if (state->pieceX > bot->target.x)
+            inputs |= INPUT_LEFT;
+        else
+            inputs |= INPUT_DOWN;
+    }
+
+    return inputs;
+}
+
+// Juega la pieza actual directo a su mejor lugar (sin pasar por ticks)
+// Devuelve las líneas eliminadas, o -1 si no había jugada posible
+int botDropPiece(const BotWeights *weights, GameState *state)
+{
+    BotMove move;
+    if (state->gameOver || !findBestMove(state, weights, &move))
+        return -1;
+    return dropPiece(state, move.rotation, move.x);
+}
@@ -0,0 +1,53 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <stdbool.h>
+#include "game.h"
+
+// ============ BOT HEURÍSTICO ============
+// Prueba todas las rotaciones y columnas de la pieza actual, la deja caer,
+// evalúa el tablero resultante con una suma ponderada de features y juega
+// la mejor colocación apretando teclas como un jugador más.
+
+typedef enum
+{
+    FEATURE_HEIGHT = 0, // Suma de alturas de las columnas
+    FEATURE_LINES,      // Líneas eliminadas por la colocación
+    FEATURE_HOLES,      // Celdas vacías con algún bloque encima
+    FEATURE_BUMPINESS,  // Suma de diferencias de altura entre columnas vecinas
+    NUM_BOT_FEATURES
+} BotFeature;
+
+typedef struct
+{
+    float weights[NUM_BOT_FEATURES];
+} BotWeights;
+
+// Pesos por defecto (afinados a mano para este tablero de 10x20)
+extern const BotWeights DEFAULT_BOT_WEIGHTS;
+
+// Colocación elegida: rotaciones desde el spawn y columna final
+typedef struct
+{
+    int rotation;
+    int x;
+    int y;
+    float score;
+} BotMove;
+
+typedef struct
+{
+    BotWeights weights;
+    BotMove target;
+    int plannedPiece; // piecesPlaced cuando se planificó `target` (-1 = sin plan)
+} Bot;
+
+void computeBoardFeatures(int grid[GRID_HEIGHT][GRID_WIDTH], int linesCleared,
+                          float features[NUM_BOT_FEATURES]);
+bool findBestMove(const GameState *state, const BotWeights *weights, BotMove *best);
+
+void initBot(Bot *bot, const BotWeights *weights);
+unsigned botInputs(Bot *bot, const GameState *state);
+int botDropPiece(const BotWeights *weights, GameState *state);
+
+#endif // BOT_H
@@ -1,14 +1,74 @@
 #include "database.h"
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdio.h>
 #include <string.h>
 #include <time.h>
+#include "metrics.h"
 
 static sqlite3 *db = NULL;
+static const char *databasePath = "tetris.db";
+
+// initDatabaseAsync: nada necesita la base hasta guardar el primer puntaje
+// o ver el Top 10, así que se abre mientras se crea la ventana. El hilo
+// avisa apenas la base está abierta y migrada (initPending pasa a false) y
+// después sigue con la retención en su propia conexión.
+static pthread_t initThread;
+static bool initThreadStarted = false;
+static bool initPending = false;
+static pthread_mutex_t initMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t initCond = PTHREAD_COND_INITIALIZER;
+static atomic_bool stopRollUp = false; // closeDatabase no espera a que termine la retención
+
+// `db` lo usan el hilo del juego (Top 10) y el hilo de guardado
+static pthread_mutex_t dbMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Cola de saveScoreAsync/printTopScoresAsync/getTopScoresAsync: la atiende
+// un hilo que se lanza con el primer pedido y se detiene en closeDatabase
+#define DATABASE_QUEUE_SIZE 16
+#define DATABASE_TOP_SCORES 10 // Los que guarda getTopScoresAsync
+
+typedef enum
+{
+    DB_JOB_SAVE_SCORE,
+    DB_JOB_PRINT_TOP_SCORES,
+    DB_JOB_TOP_SCORES
+} DatabaseJobType;
+
+typedef struct
+{
+    DatabaseJobType type;
+    char username[50];
+    int score;
+    int lines;
+    uint32_t tick;
+    char removeOnSave[256];
+} DatabaseJob;
+
+static DatabaseJob jobs[DATABASE_QUEUE_SIZE];
+static int jobHead = 0;
+static int jobCount = 0; // Incluye el que se está atendiendo
+static ScoreSaveResult results[DATABASE_QUEUE_SIZE];
+static int resultCount = 0;
+static Score topScores[DATABASE_TOP_SCORES];
+static int topScoreCount = -1; // -1 = no hay consulta terminada sin leer
+static pthread_t workerThread;
+static bool workerStarted = false;
+static bool workerStopping = false;
+static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t jobCond = PTHREAD_COND_INITIALIZER;
+
+static void stopDatabaseWorker(void);
+
+void setDatabasePath(const char *path)
+{
+    databasePath = path;
+}
 
 // Inicializar la base de datos
 bool initDatabase()
 {
-    int rc = sqlite3_open("tetris.db", &db);
+    int rc = sqlite3_open(databasePath, &db);
 
     if (rc != SQLITE_OK)
     {
@@ -16,6 +76,13 @@ bool initDatabase()
         return false;
     }
 
+    // Otro proceso (tournament, otra ventana) puede estar en medio de una
+    // transacción: esperar un poco en vez de fallar. En una base nueva,
+    // dejar que rollUpScores libere páginas de a poco (en una existente
+    // esto no hace nada hasta el primer VACUUM, ver rollUpScores)
+    sqlite3_busy_timeout(db, 2000);
+    sqlite3_exec(db, "PRAGMA auto_vacuum = INCREMENTAL;", NULL, NULL, NULL);
+
     // Crear tabla de puntajes si no existe (sin tabla de usuarios separada)
     const char *sqlScores =
         "CREATE TABLE IF NOT EXISTS scores ("
@@ -36,12 +103,158 @@ bool initDatabase()
         return false;
     }
 
+    // Resumen de los puntajes viejos: una fila por usuario y día, con el
+    // mejor puntaje (y sus líneas y fecha) y cuántas partidas cayeron en
+    // cada rango de puntos: 0, <1000, <5000, <20000, <100000 y más
+    const char *sqlDaily =
+        "CREATE TABLE IF NOT EXISTS score_daily ("
+        "username TEXT NOT NULL,"
+        "day TEXT NOT NULL,"
+        "games INTEGER NOT NULL,"
+        "total_lines INTEGER NOT NULL,"
+        "total_score INTEGER NOT NULL,"
+        "best_score INTEGER NOT NULL,"
+        "best_lines INTEGER NOT NULL,"
+        "best_date TEXT NOT NULL,"
+        "games_0 INTEGER NOT NULL,"
+        "games_1k INTEGER NOT NULL,"
+        "games_5k INTEGER NOT NULL,"
+        "games_20k INTEGER NOT NULL,"
+        "games_100k INTEGER NOT NULL,"
+        "games_more INTEGER NOT NULL,"
+        "PRIMARY KEY (username, day)"
+        ") WITHOUT ROWID;"
+        "CREATE INDEX IF NOT EXISTS score_daily_best ON score_daily (best_score DESC);"
+        "CREATE INDEX IF NOT EXISTS scores_score ON scores (score DESC);";
+
+    rc2 = sqlite3_exec(db, sqlDaily, NULL, NULL, &errMsg);
+
+    if (rc2 != SQLITE_OK)
+    {
+        printf("Error al crear tabla score_daily: %s\n", errMsg);
+        sqlite3_free(errMsg);
+        return false;
+    }
+
+    // Torneos de bots y el rating final de cada bot en cada torneo
+    const char *sqlTournaments =
+        "CREATE TABLE IF NOT EXISTS tournaments ("
+        "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "format TEXT NOT NULL,"
+        "rounds INTEGER NOT NULL,"
+        "matches INTEGER NOT NULL,"
+        "stopped_early INTEGER NOT NULL,"
+        "date TEXT NOT NULL"
+        ");"
+        "CREATE TABLE IF NOT EXISTS bot_ratings ("
+        "id INTEGER PRIMARY KEY AUTOINCREMENT,"
+        "tournament_id INTEGER NOT NULL REFERENCES tournaments(id),"
+        "name TEXT NOT NULL,"
+        "weights TEXT NOT NULL,"
+        "rating REAL NOT NULL,"
+        "deviation REAL NOT NULL,"
+        "wins INTEGER NOT NULL,"
+        "losses INTEGER NOT NULL,"
+        "draws INTEGER NOT NULL"
+        ");";
+
+    rc2 = sqlite3_exec(db, sqlTournaments, NULL, NULL, &errMsg);
+
+    if (rc2 != SQLITE_OK)
+    {
+        printf("Error al crear tablas de torneos: %s\n", errMsg);
+        sqlite3_free(errMsg);
+        return false;
+    }
+
     return true;
 }
 
+static int rollUpOldScores(sqlite3 *handle, int keepDays, int maxChunks, int pauseMs);
+static void releaseFreePages(sqlite3 *handle, bool allowVacuum);
+
+// Retención al arrancar, con una conexión propia: cada tanda es una
+// transacción corta, así que saveScore y el Top 10 (en la conexión del
+// juego) esperan a lo sumo una tanda, nunca a la retención entera
+static void rollUpAtStartup(void)
+{
+    sqlite3 *handle;
+    if (sqlite3_open(databasePath, &handle) != SQLITE_OK)
+    {
+        printf("Error al abrir base de datos para la retención: %s\n", sqlite3_errmsg(handle));
+        sqlite3_close(handle);
+        return;
+    }
+    sqlite3_busy_timeout(handle, 2000);
+
+    int rolled = rollUpOldScores(handle, SCORE_RETENTION_DAYS, SCORE_RETENTION_STARTUP_CHUNKS, SCORE_RETENTION_PAUSE_MS);
+    if (rolled > 0)
+    {
+        printf("Retención: %d puntajes de hace más de %d días resumidos\n", rolled, SCORE_RETENTION_DAYS);
+        releaseFreePages(handle, false);
+    }
+    sqlite3_close(handle);
+}
+
+static void *initDatabaseThread(void *arg)
+{
+    (void)arg;
+    uint64_t start = metricsNowNs();
+    bool ok = initDatabase();
+    if (!ok)
+    {
+        printf("⚠️  Error al inicializar base de datos.\n");
+        printf("   El juego continuará sin guardar puntajes.\n\n");
+    }
+    metricsObserve(METRIC_DB_INIT_TIME, metricsNowNs() - start);
+
+    // Lista para usar: desde acá nadie espera a este hilo
+    pthread_mutex_lock(&initMutex);
+    initPending = false;
+    pthread_cond_broadcast(&initCond);
+    pthread_mutex_unlock(&initMutex);
+
+    if (ok)
+        rollUpAtStartup();
+    return NULL;
+}
+
+bool initDatabaseAsync()
+{
+    atomic_store(&stopRollUp, false);
+    initPending = true;
+    if (pthread_create(&initThread, NULL, initDatabaseThread, NULL) != 0)
+    {
+        printf("Error al crear el hilo de la base de datos, se abre ahora\n");
+        initDatabaseThread(NULL);
+        return false;
+    }
+    initThreadStarted = true;
+    return true;
+}
+
+// Espera a que initDatabaseAsync abra y migre la base (no a la retención)
+static void waitDatabase(void)
+{
+    pthread_mutex_lock(&initMutex);
+    while (initPending)
+        pthread_cond_wait(&initCond, &initMutex);
+    pthread_mutex_unlock(&initMutex);
+}
+
 // Cerrar la base de datos
 void closeDatabase()
 {
+    waitDatabase();
+    stopDatabaseWorker();
+    if (initThreadStarted)
+    {
+        // La retención corta en la próxima tanda; lo que falte sigue al
+        // próximo arranque
+        atomic_store(&stopRollUp, true);
+        pthread_join(initThread, NULL);
+        initThreadStarted = false;
+    }
     if (db != NULL)
     {
         sqlite3_close(db);
@@ -50,10 +263,12 @@ void closeDatabase()
 }
 
 // Guardar un puntaje
-bool saveScore(const char *username, int score, int lines)
+static bool insertScore(const char *username, int score, int lines)
 {
+    waitDatabase();
     if (db == NULL)
         return false;
+    pthread_mutex_lock(&dbMutex);
 
     // Obtener fecha actual
     time_t t = time(NULL);
@@ -68,6 +283,7 @@ bool saveScore(const char *username, int score, int lines)
     if (rc != SQLITE_OK)
     {
         printf("Error preparando statement: %s\n", sqlite3_errmsg(db));
+        pthread_mutex_unlock(&dbMutex);
         return false;
     }
 
@@ -82,25 +298,44 @@ bool saveScore(const char *username, int score, int lines)
     if (rc != SQLITE_DONE)
     {
         printf("Error al guardar puntaje: %s\n", sqlite3_errmsg(db));
+        pthread_mutex_unlock(&dbMutex);
         return false;
     }
 
+    pthread_mutex_unlock(&dbMutex);
     return true;
 }
 
+bool saveScore(const char *username, int score, int lines)
+{
+    uint64_t start = metricsNowNs();
+    bool saved = insertScore(username, score, lines);
+    metricsObserve(METRIC_SAVE_SCORE_TIME, metricsNowNs() - start);
+    return saved;
+}
+
 // Obtener los mejores puntajes
-int getTopScores(Score *scores, int maxScores)
+static int queryTopScores(Score *scores, int maxScores)
 {
+    waitDatabase();
     if (db == NULL || scores == NULL)
         return 0;
+    pthread_mutex_lock(&dbMutex);
 
     sqlite3_stmt *stmt;
-    const char *sql = "SELECT id, username, score, lines, date FROM scores ORDER BY score DESC LIMIT ?;";
+    // Los dos lados usan su índice por puntaje y traen a lo sumo maxScores
+    const char *sql =
+        "SELECT * FROM (SELECT id, username, score, lines, date FROM scores ORDER BY score DESC LIMIT ?1) "
+        "UNION ALL "
+        "SELECT * FROM (SELECT 0, username, best_score, best_lines, best_date FROM score_daily "
+        "ORDER BY best_score DESC LIMIT ?1) "
+        "ORDER BY score DESC LIMIT ?1;";
 
     int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, NULL);
     if (rc != SQLITE_OK)
     {
         printf("Error preparando statement: %s\n", sqlite3_errmsg(db));
+        pthread_mutex_unlock(&dbMutex);
         return 0;
     }
 
@@ -120,6 +355,15 @@ int getTopScores(Score *scores, int maxScores)
     }
 
     sqlite3_finalize(stmt);
+    pthread_mutex_unlock(&dbMutex);
+    return count;
+}
+
+int getTopScores(Score *scores, int maxScores)
+{
+    uint64_t start = metricsNowNs();
+    int count = queryTopScores(scores, maxScores);
+    metricsObserve(METRIC_TOP_SCORES_TIME, metricsNowNs() - start);
     return count;
 }
 
@@ -150,3 +394,417 @@ void printTopScores()
 
     printf("=====================================\n\n");
 }
+
+// ============ GUARDADO EN SEGUNDO PLANO ============
+
+static void runDatabaseJob(const DatabaseJob *job)
+{
+    if (job->type == DB_JOB_PRINT_TOP_SCORES)
+    {
+        printTopScores();
+        return;
+    }
+    if (job->type == DB_JOB_TOP_SCORES)
+    {
+        Score scores[DATABASE_TOP_SCORES];
+        int count = getTopScores(scores, DATABASE_TOP_SCORES);
+        pthread_mutex_lock(&jobMutex);
+        memcpy(topScores, scores, sizeof(scores));
+        topScoreCount = count;
+        pthread_mutex_unlock(&jobMutex);
+        return;
+    }
+
+    bool saved = saveScore(job->username, job->score, job->lines);
+    if (saved && job->removeOnSave[0] != '\0')
+        remove(job->removeOnSave);
+
+    pthread_mutex_lock(&jobMutex);
+    if (resultCount < DATABASE_QUEUE_SIZE)
+        results[resultCount++] = (ScoreSaveResult){job->score, job->lines, job->tick, saved};
+    pthread_mutex_unlock(&jobMutex);
+}
+
+static void *databaseWorker(void *arg)
+{
+    (void)arg;
+    pthread_mutex_lock(&jobMutex);
+    for (;;)
+    {
+        while (jobCount == 0 && !workerStopping)
+            pthread_cond_wait(&jobCond, &jobMutex);
+        if (jobCount == 0)
+            break; // Se pidió parar y no queda nada
+
+        DatabaseJob job = jobs[jobHead];
+        pthread_mutex_unlock(&jobMutex);
+        runDatabaseJob(&job);
+        pthread_mutex_lock(&jobMutex);
+
+        jobHead = (jobHead + 1) % DATABASE_QUEUE_SIZE;
+        jobCount--;
+        pthread_cond_broadcast(&jobCond); // Para waitScoreSaves
+    }
+    pthread_mutex_unlock(&jobMutex);
+    return NULL;
+}
+
+// Encola el pedido; si no hay hilo o la cola está llena, lo atiende ahora
+static void pushDatabaseJob(const DatabaseJob *job)
+{
+    pthread_mutex_lock(&jobMutex);
+    if (!workerStarted)
+    {
+        workerStopping = false;
+        workerStarted = pthread_create(&workerThread, NULL, databaseWorker, NULL) == 0;
+        if (!workerStarted)
+            printf("Error al crear el hilo de guardado, se guarda ahora\n");
+    }
+    if (!workerStarted || jobCount == DATABASE_QUEUE_SIZE)
+    {
+        pthread_mutex_unlock(&jobMutex);
+        runDatabaseJob(job);
+        return;
+    }
+    jobs[(jobHead + jobCount) % DATABASE_QUEUE_SIZE] = *job;
+    jobCount++;
+    pthread_cond_broadcast(&jobCond);
+    pthread_mutex_unlock(&jobMutex);
+}
+
+static void stopDatabaseWorker(void)
+{
+    pthread_mutex_lock(&jobMutex);
+    bool started = workerStarted;
+    workerStopping = true;
+    pthread_cond_broadcast(&jobCond);
+    pthread_mutex_unlock(&jobMutex);
+
+    // Atiende lo que quedaba en la cola antes de terminar
+    if (started)
+        pthread_join(workerThread, NULL);
+    workerStarted = false;
+}
+
+void saveScoreAsync(const char *username, int score, int lines, uint32_t tick, const char *removeOnSave)
+{
+    DatabaseJob job;
+    memset(&job, 0, sizeof(job));
+    job.type = DB_JOB_SAVE_SCORE;
+    snprintf(job.username, sizeof(job.username), "%s", username);
+    job.score = score;
+    job.lines = lines;
+    job.tick = tick;
+    if (removeOnSave != NULL)
+        snprintf(job.removeOnSave, sizeof(job.removeOnSave), "%s", removeOnSave);
+    pushDatabaseJob(&job);
+}
+
+void printTopScoresAsync()
+{
+    DatabaseJob job;
+    memset(&job, 0, sizeof(job));
+    job.type = DB_JOB_PRINT_TOP_SCORES;
+    pushDatabaseJob(&job);
+}
+
+void getTopScoresAsync()
+{
+    pthread_mutex_lock(&jobMutex);
+    topScoreCount = -1; // Lo que quedó de una consulta anterior ya no sirve
+    pthread_mutex_unlock(&jobMutex);
+
+    DatabaseJob job;
+    memset(&job, 0, sizeof(job));
+    job.type = DB_JOB_TOP_SCORES;
+    pushDatabaseJob(&job);
+}
+
+int takeTopScores(Score *scores, int maxScores)
+{
+    pthread_mutex_lock(&jobMutex);
+    int count = topScoreCount < maxScores ? topScoreCount : maxScores;
+    if (count > 0)
+        memcpy(scores, topScores, (size_t)count * sizeof(Score));
+    topScoreCount = -1;
+    pthread_mutex_unlock(&jobMutex);
+    return count;
+}
+
+void waitScoreSaves()
+{
+    pthread_mutex_lock(&jobMutex);
+    while (jobCount > 0 && workerStarted)
+        pthread_cond_wait(&jobCond, &jobMutex);
+    pthread_mutex_unlock(&jobMutex);
+}
+
+int takeScoreSaveResults(ScoreSaveResult *taken, int maxResults)
+{
+    pthread_mutex_lock(&jobMutex);
+    int count = resultCount < maxResults ? resultCount : maxResults;
+    memcpy(taken, results, (size_t)count * sizeof(ScoreSaveResult));
+    memmove(results, results + count, (size_t)(resultCount - count) * sizeof(ScoreSaveResult));
+    resultCount -= count;
+    pthread_mutex_unlock(&jobMutex);
+    return count;
+}
+
+// ============ RETENCIÓN ============
+
+// Resume en score_daily los primeros SCORE_RETENTION_CHUNK puntajes
+// anteriores a cutoff y los borra, todo en una transacción. Devuelve
+// cuántos resumió (0 = no quedan), o -1 si hubo un error
+static int rollUpChunk(sqlite3 *handle, const char *cutoff)
+{
+    if (sqlite3_exec(handle, "BEGIN IMMEDIATE;", NULL, NULL, NULL) != SQLITE_OK)
+    {
+        printf("Error al empezar la retención: %s\n", sqlite3_errmsg(handle));
+        return -1;
+    }
+
+    // scores crece por id y casi siempre en orden de fecha: los más viejos
+    // están al principio y este recorrido no pasa por los recientes
+    sqlite3_stmt *stmt;
+    const char *sql = "SELECT COUNT(*), MAX(id) FROM (SELECT id FROM scores WHERE date < ?1 ORDER BY id LIMIT ?2);";
+    int rc = sqlite3_prepare_v2(handle, sql, -1, &stmt, NULL);
+    if (rc != SQLITE_OK)
+    {
+        printf("Error preparando statement: %s\n", sqlite3_errmsg(handle));
+        sqlite3_exec(handle, "ROLLBACK;", NULL, NULL, NULL);
+        return -1;
+    }
+    sqlite3_bind_text(stmt, 1, cutoff, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, SCORE_RETENTION_CHUNK);
+    int count = 0;
+    sqlite3_int64 lastId = 0;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        count = sqlite3_column_int(stmt, 0);
+        lastId = sqlite3_column_int64(stmt, 1);
+    }
+    sqlite3_finalize(stmt);
+
+    if (count == 0)
+    {
+        sqlite3_exec(handle, "COMMIT;", NULL, NULL, NULL);
+        return 0;
+    }
+
+    // Con un solo MAX(), SQLite toma lines y date de la fila del máximo.
+    // En el UPDATE las columnas sin excluded. son los valores de antes
+    const char *sqlSteps[] = {
+        "INSERT INTO score_daily (username, day, games, total_lines, total_score, best_score, best_lines, best_date, "
+        "games_0, games_1k, games_5k, games_20k, games_100k, games_more) "
+        "SELECT username, substr(date, 1, 10), COUNT(*), SUM(lines), SUM(score), MAX(score), lines, date, "
+        "SUM(score = 0), SUM(score > 0 AND score < 1000), SUM(score >= 1000 AND score < 5000), "
+        "SUM(score >= 5000 AND score < 20000), SUM(score >= 20000 AND score < 100000), SUM(score >= 100000) "
+        "FROM scores WHERE id <= ?1 AND date < ?2 GROUP BY username, substr(date, 1, 10) "
+        "ON CONFLICT (username, day) DO UPDATE SET "
+        "games = games + excluded.games, "
+        "total_lines = total_lines + excluded.total_lines, "
+        "total_score = total_score + excluded.total_score, "
+        "best_lines = CASE WHEN excluded.best_score > best_score THEN excluded.best_lines ELSE best_lines END, "
+        "best_date = CASE WHEN excluded.best_score > best_score THEN excluded.best_date ELSE best_date END, "
+        "best_score = MAX(best_score, excluded.best_score), "
+        "games_0 = games_0 + excluded.games_0, "
+        "games_1k = games_1k + excluded.games_1k, "
+        "games_5k = games_5k + excluded.games_5k, "
+        "games_20k = games_20k + excluded.games_20k, "
+        "games_100k = games_100k + excluded.games_100k, "
+        "games_more = games_more + excluded.games_more;",
+        "DELETE FROM scores WHERE id <= ?1 AND date < ?2;",
+    };
+
+    for (int i = 0; i < 2; i++)
+    {
+        rc = sqlite3_prepare_v2(handle, sqlSteps[i], -1, &stmt, NULL);
+        if (rc != SQLITE_OK)
+        {
+            printf("Error preparando statement: %s\n", sqlite3_errmsg(handle));
+            sqlite3_exec(handle, "ROLLBACK;", NULL, NULL, NULL);
+            return -1;
+        }
+        sqlite3_bind_int64(stmt, 1, lastId);
+        sqlite3_bind_text(stmt, 2, cutoff, -1, SQLITE_STATIC);
+        rc = sqlite3_step(stmt);
+        sqlite3_finalize(stmt);
+
+        if (rc != SQLITE_DONE)
+        {
+            printf("Error al resumir puntajes: %s\n", sqlite3_errmsg(handle));
+            sqlite3_exec(handle, "ROLLBACK;", NULL, NULL, NULL);
+            return -1;
+        }
+    }
+
+    sqlite3_exec(handle, "COMMIT;", NULL, NULL, NULL);
+    return count;
+}
+
+static int queryPragmaInt(sqlite3 *handle, const char *sql)
+{
+    sqlite3_stmt *stmt;
+    int value = 0;
+    if (sqlite3_prepare_v2(handle, sql, -1, &stmt, NULL) == SQLITE_OK)
+    {
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+            value = sqlite3_column_int(stmt, 0);
+        sqlite3_finalize(stmt);
+    }
+    return value;
+}
+
+// Devuelve al sistema las páginas que quedaron libres, de a 256 por
+// transacción. Una base creada antes de la retención no tiene auto_vacuum
+// incremental: convertirla pide un VACUUM completo, que bloquea la base
+// entera, así que solo se hace si allowVacuum (rollUpScores, a pedido) y
+// nunca al arrancar. Mientras tanto SQLite reusa las páginas libres.
+static void releaseFreePages(sqlite3 *handle, bool allowVacuum)
+{
+    if (queryPragmaInt(handle, "PRAGMA auto_vacuum;") != 2)
+    {
+        if (!allowVacuum)
+            return;
+        sqlite3_exec(handle, "PRAGMA auto_vacuum = INCREMENTAL;", NULL, NULL, NULL);
+        if (sqlite3_exec(handle, "VACUUM;", NULL, NULL, NULL) != SQLITE_OK)
+            printf("Error al compactar la base de datos: %s\n", sqlite3_errmsg(handle));
+        return;
+    }
+
+    while (queryPragmaInt(handle, "PRAGMA freelist_count;") > 0 && !atomic_load(&stopRollUp))
+    {
+        if (sqlite3_exec(handle, "PRAGMA incremental_vacuum(256);", NULL, NULL, NULL) != SQLITE_OK)
+        {
+            printf("Error al liberar páginas: %s\n", sqlite3_errmsg(handle));
+            return;
+        }
+    }
+}
+
+// Resume de a SCORE_RETENTION_CHUNK puntajes, a lo sumo maxChunks tandas
+// (0 = hasta terminar) y con pauseMs entre tandas. Devuelve cuántos
+// resumió, o -1 si hubo un error
+static int rollUpOldScores(sqlite3 *handle, int keepDays, int maxChunks, int pauseMs)
+{
+    // Se corta en el comienzo de un día para resumir días completos
+    time_t t = time(NULL) - (time_t)keepDays * 24 * 60 * 60;
+    struct tm *tm_info = localtime(&t);
+    char cutoff[20];
+    strftime(cutoff, sizeof(cutoff), "%Y-%m-%d 00:00:00", tm_info);
+
+    int total = 0;
+    int rolled = 0;
+    for (int chunk = 0; (maxChunks == 0 || chunk < maxChunks) && !atomic_load(&stopRollUp); chunk++)
+    {
+        rolled = rollUpChunk(handle, cutoff);
+        if (rolled <= 0)
+            break;
+        total += rolled;
+
+        // Sin pausa, el próximo BEGIN IMMEDIATE le gana el lock a quien
+        // esté esperando en su busy_timeout
+        if (pauseMs > 0)
+        {
+            struct timespec pause = {0, (long)pauseMs * 1000000L};
+            nanosleep(&pause, NULL);
+        }
+    }
+    return rolled < 0 ? -1 : total;
+}
+
+int rollUpScores(int keepDays)
+{
+    waitDatabase();
+    if (db == NULL)
+        return -1;
+    pthread_mutex_lock(&dbMutex);
+    int total = rollUpOldScores(db, keepDays, 0, 0);
+    if (total > 0)
+        releaseFreePages(db, true);
+    pthread_mutex_unlock(&dbMutex);
+    return total;
+}
+
+// Guardar un torneo y los ratings de sus bots (en una sola transacción)
+// Devuelve el id del torneo, o -1 si hubo un error
+int saveTournament(const char *format, int rounds, int matches, bool stoppedEarly,
+                   const BotRating *ratings, int count)
+{
+    waitDatabase();
+    if (db == NULL)
+        return -1;
+
+    time_t t = time(NULL);
+    struct tm *tm_info = localtime(&t);
+    char date[20];
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", tm_info);
+
+    sqlite3_exec(db, "BEGIN;", NULL, NULL, NULL);
+
+    sqlite3_stmt *stmt;
+    const char *sql = "INSERT INTO tournaments (format, rounds, matches, stopped_early, date) VALUES (?, ?, ?, ?, ?);";
+
+    int rc = sqlite3_prepare_v2(db, sql, -1, &stmt, NULL);
+    if (rc != SQLITE_OK)
+    {
+        printf("Error preparando statement: %s\n", sqlite3_errmsg(db));
+        sqlite3_exec(db, "ROLLBACK;", NULL, NULL, NULL);
+        return -1;
+    }
+
+    sqlite3_bind_text(stmt, 1, format, -1, SQLITE_STATIC);
+    sqlite3_bind_int(stmt, 2, rounds);
+    sqlite3_bind_int(stmt, 3, matches);
+    sqlite3_bind_int(stmt, 4, stoppedEarly ? 1 : 0);
+    sqlite3_bind_text(stmt, 5, date, -1, SQLITE_STATIC);
+
+    rc = sqlite3_step(stmt);
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        printf("Error al guardar torneo: %s\n", sqlite3_errmsg(db));
+        sqlite3_exec(db, "ROLLBACK;", NULL, NULL, NULL);
+        return -1;
+    }
+
+    int tournamentId = (int)sqlite3_last_insert_rowid(db);
+
+    sql = "INSERT INTO bot_ratings (tournament_id, name, weights, rating, deviation, wins, losses, draws) "
+          "VALUES (?, ?, ?, ?, ?, ?, ?, ?);";
+    rc = sqlite3_prepare_v2(db, sql, -1, &stmt, NULL);
+    if (rc != SQLITE_OK)
+    {
+        printf("Error preparando statement: %s\n", sqlite3_errmsg(db));
+        sqlite3_exec(db, "ROLLBACK;", NULL, NULL, NULL);
+        return -1;
+    }
+
+    rc = SQLITE_DONE;
+    for (int i = 0; i < count && rc == SQLITE_DONE; i++)
+    {
+        sqlite3_bind_int(stmt, 1, tournamentId);
+        sqlite3_bind_text(stmt, 2, ratings[i].name, -1, SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, ratings[i].weights, -1, SQLITE_STATIC);
+        sqlite3_bind_double(stmt, 4, ratings[i].rating);
+        sqlite3_bind_double(stmt, 5, ratings[i].deviation);
+        sqlite3_bind_int(stmt, 6, ratings[i].wins);
+        sqlite3_bind_int(stmt, 7, ratings[i].losses);
+        sqlite3_bind_int(stmt, 8, ratings[i].draws);
+
+        rc = sqlite3_step(stmt);
+        sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE)
+    {
+        printf("Error al guardar ratings: %s\n", sqlite3_errmsg(db));
+        sqlite3_exec(db, "ROLLBACK;", NULL, NULL, NULL);
+        return -1;
+    }
+
+    sqlite3_exec(db, "COMMIT;", NULL, NULL, NULL);
+    return tournamentId;
+}
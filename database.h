@@ -3,6 +3,7 @@
 
 #include <sqlite3.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // Estructura para representar un puntaje
 typedef struct {
@@ -13,11 +14,63 @@ typedef struct {
     char date[20];
 } Score;
 
+// Resultado de un bot en un torneo (ver tools/tournament.c)
+typedef struct {
+    char name[32];
+    char weights[80];  // Pesos como texto, para poder reproducir el bot
+    double rating;     // Glicko
+    double deviation;  // RD: el intervalo de 95% es rating ± 1.96 * RD
+    int wins;
+    int losses;
+    int draws;
+} BotRating;
+
+// Resultado de un saveScoreAsync ya atendido
+typedef struct {
+    int score;
+    int lines;
+    uint32_t tick; // El que se pasó al encolar, para el log de eventos
+    bool saved;
+} ScoreSaveResult;
+
+// Retención: los puntajes de más de SCORE_RETENTION_DAYS días se resumen en
+// score_daily (una fila por usuario y día) y se borran de scores
+#define SCORE_RETENTION_DAYS 30
+#define SCORE_RETENTION_CHUNK 500 // Filas por transacción
+#define SCORE_RETENTION_STARTUP_CHUNKS 40 // Tandas por arranque; lo que falte sigue en el próximo
+#define SCORE_RETENTION_PAUSE_MS 20       // Entre tandas al arrancar, para dejar pasar a los que guardan
+
 // Funciones de base de datos
+void setDatabasePath(const char* path); // Antes de initDatabase; por defecto tetris.db
 bool initDatabase();
+// Abre y migra la base en un hilo aparte; la primera función que la use
+// espera solo a eso. Después el mismo hilo resume puntajes viejos (a lo
+// sumo SCORE_RETENTION_STARTUP_CHUNKS tandas) con su propia conexión.
+// Solo el hilo que la lanzó debe usar la base (y el hilo de guardado).
+bool initDatabaseAsync();
 void closeDatabase();
 bool saveScore(const char* username, int score, int lines);
+// Top de puntajes entre los recientes y los mejores de cada día resumido
+// (los resumidos vienen con id 0)
 int getTopScores(Score* scores, int maxScores);
 void printTopScores();
+// Lo mismo en un hilo de fondo, para no frenar el frame: se atienden en
+// orden. Si se guardó, saveScoreAsync borra removeOnSave (puede ser NULL).
+// closeDatabase atiende lo que quede en la cola antes de cerrar.
+void saveScoreAsync(const char* username, int score, int lines, uint32_t tick, const char* removeOnSave);
+void printTopScoresAsync();
+// Top de puntajes para mostrar: se pide con getTopScoresAsync y se retira
+// con takeTopScores, que devuelve -1 mientras la consulta no terminó
+void getTopScoresAsync();
+int takeTopScores(Score* scores, int maxScores);
+void waitScoreSaves(); // Espera a que se vacíe la cola
+int takeScoreSaveResults(ScoreSaveResult* results, int maxResults);
+// Resume y borra todos los puntajes de antes de hace keepDays días, en
+// transacciones cortas para no trabar a otros escritores, y después libera
+// el espacio (con un VACUUM completo si la base es anterior a la
+// retención). Devuelve cuántos puntajes resumió, o -1 si falló.
+int rollUpScores(int keepDays);
+int saveTournament(const char* format, int rounds, int matches, bool stoppedEarly,
+                   const BotRating* ratings, int count);
 
 #endif
@@ -0,0 +1,240 @@
+#include "eventlog.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DRAIN_SLEEP_NS 2000000 // 2 ms entre pasadas con el ring vacío
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+const char *getEventTypeName(EventType type)
+{
+    static const char *NAMES[NUM_EVENT_TYPES] = {"?", "partida", "lineas", "game_over", "guardada", "puntaje",
+                                                  "retomada"};
+    return type > 0 && type < NUM_EVENT_TYPES ? NAMES[type] : NAMES[0];
+}
+
+void formatEventRecord(const EventRecord *record, char *buffer, size_t size)
+{
+    const int32_t *v = record->values;
+    int n = snprintf(buffer, size, "t=%.6f tick=%u %s", (double)record->timeNs / 1e9, record->tick,
+                     getEventTypeName((EventType)record->type));
+    if (n < 0 || (size_t)n >= size)
+        return;
+    buffer += n;
+    size -= (size_t)n;
+
+    switch (record->type)
+    {
+    case EVENT_GAME_STARTED:
+        snprintf(buffer, size, " usuario=%.*s", EVENT_TEXT_SIZE, record->text);
+        break;
+    case EVENT_LINES_CLEARED:
+        snprintf(buffer, size, " lineas=%d puntos=%d total=%d", v[0], v[1], v[2]);
+        break;
+    case EVENT_GAME_OVER:
+    case EVENT_GAME_SAVED:
+        snprintf(buffer, size, " puntaje=%d lineas=%d", v[0], v[1]);
+        break;
+    case EVENT_SCORE_SAVED:
+        snprintf(buffer, size, " puntaje=%d ok=%d", v[0], v[1]);
+        break;
+    case EVENT_GAME_RESUMED:
+        snprintf(buffer, size, " puntaje=%d resimulados=%d us=%d", v[0], v[1], v[2]);
+        break;
+    default:
+        break;
+    }
+}
+
+// ============ PRODUCTOR ============
+
+// Slot libre para el próximo registro, o NULL si el ring está lleno
+static EventRecord *claimRecord(EventLog *log)
+{
+    if (log->records == NULL)
+        return NULL; // Log no iniciado: no hace nada
+
+    uint64_t head = atomic_load_explicit(&log->head, memory_order_relaxed);
+    if (head - log->cachedTail > log->mask)
+    {
+        // Solo releer el tail del consumidor cuando el ring parece lleno
+        log->cachedTail = atomic_load_explicit(&log->tail, memory_order_acquire);
+        if (head - log->cachedTail > log->mask)
+        {
+            atomic_fetch_add_explicit(&log->dropped, 1, memory_order_relaxed);
+            return NULL;
+        }
+    }
+    return &log->records[head & log->mask];
+}
+
+static void publishRecord(EventLog *log)
+{
+    uint64_t head = atomic_load_explicit(&log->head, memory_order_relaxed);
+    atomic_store_explicit(&log->head, head + 1, memory_order_release);
+}
+
+bool eventLogPush(EventLog *log, EventType type, uint32_t tick, int32_t a, int32_t b, int32_t c)
+{
+    EventRecord *record = claimRecord(log);
+    if (record == NULL)
+        return false;
+
+    record->timeNs = nowNs();
+    record->tick = tick;
+    record->type = (uint16_t)type;
+    record->reserved = 0;
+    memset(record->values, 0, sizeof(record->values));
+    record->values[0] = a;
+    record->values[1] = b;
+    record->values[2] = c;
+    publishRecord(log);
+    return true;
+}
+
+bool eventLogPushText(EventLog *log, EventType type, uint32_t tick, const char *text)
+{
+    EventRecord *record = claimRecord(log);
+    if (record == NULL)
+        return false;
+
+    record->timeNs = nowNs();
+    record->tick = tick;
+    record->type = (uint16_t)type;
+    record->reserved = 0;
+    memset(record->text, 0, sizeof(record->text));
+    strncpy(record->text, text, sizeof(record->text) - 1);
+    publishRecord(log);
+    return true;
+}
+
+// ============ CONSUMIDOR ============
+
+// Escribe todo lo que haya en el ring. Devuelve cuántos registros escribió.
+static uint64_t drainRecords(EventLog *log)
+{
+    uint64_t tail = atomic_load_explicit(&log->tail, memory_order_relaxed);
+    log->cachedHead = atomic_load_explicit(&log->head, memory_order_acquire);
+    uint64_t count = log->cachedHead - tail;
+    char line[160];
+
+    for (uint64_t i = tail; i != log->cachedHead; i++)
+    {
+        const EventRecord *record = &log->records[i & log->mask];
+        if (log->format == EVENT_FORMAT_BINARY)
+            fwrite(record, sizeof(*record), 1, log->file);
+        else
+        {
+            formatEventRecord(record, line, sizeof(line));
+            fprintf(log->file, "%s\n", line);
+        }
+    }
+    if (count > 0)
+    {
+        // Liberar los slots recién después de escribirlos (se leen del ring)
+        atomic_store_explicit(&log->tail, log->cachedHead, memory_order_release);
+        fflush(log->file);
+    }
+    return count;
+}
+
+static void *drainThread(void *arg)
+{
+    EventLog *log = arg;
+    struct timespec pause = {0, DRAIN_SLEEP_NS};
+
+    for (;;)
+    {
+        bool stopping = atomic_load_explicit(&log->stopping, memory_order_acquire);
+        if (drainRecords(log) == 0)
+        {
+            if (stopping)
+                break;
+            nanosleep(&pause, NULL);
+        }
+    }
+    return NULL;
+}
+
+bool eventLogStart(EventLog *log, const char *path, EventLogFormat format, uint32_t capacity)
+{
+    memset(log, 0, sizeof(*log));
+
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+    {
+        printf("Error: la capacidad del log debe ser potencia de 2 (%u)\n", capacity);
+        return false;
+    }
+
+    log->records = aligned_alloc(64, (size_t)capacity * sizeof(EventRecord));
+    if (log->records == NULL)
+    {
+        printf("Error al reservar memoria para el log de eventos\n");
+        return false;
+    }
+    // Tocar todas las páginas ahora y no en el primer evento del juego
+    memset(log->records, 0, (size_t)capacity * sizeof(EventRecord));
+    log->mask = capacity - 1;
+    log->format = format;
+
+    if (path == NULL || strcmp(path, "-") == 0)
+        log->file = stdout;
+    else
+    {
+        log->file = fopen(path, format == EVENT_FORMAT_BINARY ? "wb" : "w");
+        log->ownsFile = true;
+    }
+    if (log->file == NULL)
+    {
+        printf("Error al crear %s: %s\n", path, strerror(errno));
+        free(log->records);
+        log->records = NULL;
+        return false;
+    }
+
+    if (format == EVENT_FORMAT_BINARY)
+    {
+        EventLogFileHeader header = {EVENT_LOG_MAGIC, EVENT_LOG_VERSION, sizeof(EventRecord), 0};
+        fwrite(&header, sizeof(header), 1, log->file);
+    }
+
+    if (pthread_create(&log->thread, NULL, drainThread, log) != 0)
+    {
+        printf("Error al crear el hilo del log de eventos\n");
+        if (log->ownsFile)
+            fclose(log->file);
+        free(log->records);
+        log->records = NULL;
+        return false;
+    }
+    log->started = true;
+    return true;
+}
+
+void eventLogStop(EventLog *log)
+{
+    if (!log->started)
+        return;
+
+    atomic_store_explicit(&log->stopping, true, memory_order_release);
+    pthread_join(log->thread, NULL);
+
+    uint64_t dropped = atomic_load_explicit(&log->dropped, memory_order_relaxed);
+    if (dropped > 0)
+        printf("Log de eventos: %llu eventos descartados (ring lleno)\n", (unsigned long long)dropped);
+
+    if (log->ownsFile)
+        fclose(log->file);
+    else
+        fflush(log->file);
+    free(log->records);
+    log->records = NULL;
+    log->started = false;
+}
@@ -0,0 +1,96 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// ============ LOG DE EVENTOS ESTRUCTURADO ============
+// El hilo del juego empuja registros binarios de tamaño fijo (tick, tipo,
+// payload) en un ring SPSC sin locks, igual que obsring.h pero en memoria
+// del proceso. Un hilo de fondo lo vacía a un archivo como texto o binario.
+// Empujar nunca bloquea ni llama a printf: si el consumidor va atrasado y
+// el ring está lleno el evento se descarta y se cuenta en `dropped`.
+
+#define EVENT_LOG_MAGIC 0x474C5645u // "EVLG"
+#define EVENT_LOG_VERSION 1
+#define EVENT_LOG_CAPACITY 4096 // Potencia de 2
+#define EVENT_TEXT_SIZE 48
+
+typedef enum
+{
+    EVENT_GAME_STARTED = 1, // text = usuario
+    EVENT_LINES_CLEARED,    // values = líneas, puntos, total
+    EVENT_GAME_OVER,        // values = puntaje, líneas
+    EVENT_GAME_SAVED,       // values = puntaje, líneas (salida con ESC o cerrando)
+    EVENT_SCORE_SAVED,      // values = puntaje, 1 si se guardó en la base
+    EVENT_GAME_RESUMED,     // values = puntaje, ticks re-simulados, µs que tardó (ver journal.h)
+    NUM_EVENT_TYPES
+} EventType;
+
+// Registro de tamaño fijo (una línea de caché); layout estable en disco
+typedef struct
+{
+    uint64_t timeNs; // CLOCK_MONOTONIC
+    uint32_t tick;
+    uint16_t type; // EventType
+    uint16_t reserved;
+    union
+    {
+        int32_t values[EVENT_TEXT_SIZE / 4];
+        char text[EVENT_TEXT_SIZE];
+    };
+} EventRecord;
+
+_Static_assert(sizeof(EventRecord) == 64, "El layout de EventRecord es parte del formato");
+
+// Cabecera del archivo binario, seguida de los registros
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t reserved;
+} EventLogFileHeader;
+
+typedef enum
+{
+    EVENT_FORMAT_TEXT = 0,
+    EVENT_FORMAT_BINARY
+} EventLogFormat;
+
+typedef struct
+{
+    EventRecord *records;
+    uint64_t mask;
+    uint64_t cachedHead; // Del consumidor
+    uint64_t cachedTail; // Del productor
+
+    _Alignas(64) _Atomic uint64_t head; // Próximo registro a escribir (productor)
+    _Alignas(64) _Atomic uint64_t tail; // Próximo registro a leer (consumidor)
+    _Alignas(64) _Atomic uint64_t dropped;
+    _Atomic bool stopping;
+
+    FILE *file;
+    bool ownsFile; // false para stdout
+    EventLogFormat format;
+    pthread_t thread;
+    bool started;
+} EventLog;
+
+// path NULL o "-" = stdout. capacity debe ser potencia de 2.
+bool eventLogStart(EventLog *log, const char *path, EventLogFormat format, uint32_t capacity);
+// Vacía lo pendiente, espera al hilo y cierra el archivo
+void eventLogStop(EventLog *log);
+
+// Productor (un solo hilo). false si el ring estaba lleno o el log no se
+// inició (así el juego puede empujar sin preguntar).
+bool eventLogPush(EventLog *log, EventType type, uint32_t tick, int32_t a, int32_t b, int32_t c);
+bool eventLogPushText(EventLog *log, EventType type, uint32_t tick, const char *text);
+
+const char *getEventTypeName(EventType type);
+void formatEventRecord(const EventRecord *record, char *buffer, size_t size);
+
+#endif // EVENTLOG_H
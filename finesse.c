@@ -0,0 +1,277 @@
+#include "finesse.h"
+#include <pthread.h>
+#include <string.h>
+#include "bitboard.h"
+
+// ============ FORMAS ============
+// shapes[type][r] es PIECES[type] rotada r veces, igual que currentPiece
+// después de r rotaciones en stepGame. Para comparar colocaciones cada
+// forma se normaliza quitando filas y columnas vacías de arriba/izquierda.
+
+typedef struct
+{
+    int shape[4][4];
+    uint16_t normalized; // 4x4 bits sin filas/columnas vacías al principio
+    int topRow;
+    int leftCol;
+} FinesseShape;
+
+static FinesseShape shapes[NUM_PIECES][4];
+
+// Tabla del tablero vacío: índice x + 3 (la matriz 4x4 puede empezar en -3)
+#define TABLE_COLUMNS (GRID_WIDTH + 3)
+static FinessePath openField[NUM_PIECES][4][TABLE_COLUMNS];
+static pthread_once_t tableOnce = PTHREAD_ONCE_INIT;
+
+// Límites de la búsqueda (los kicks pueden sacar la matriz del tablero)
+#define BFS_MIN_X -4
+#define BFS_MAX_X (GRID_WIDTH + 4)
+#define BFS_MIN_Y -8
+#define BFS_MAX_Y GRID_HEIGHT
+#define BFS_NODES ((BFS_MAX_X - BFS_MIN_X) * (BFS_MAX_Y - BFS_MIN_Y) * 4)
+
+static void buildShapes(void)
+{
+    for (int type = 0; type < NUM_PIECES; type++)
+    {
+        for (int rotation = 0; rotation < 4; rotation++)
+        {
+            FinesseShape *entry = &shapes[type][rotation];
+            const PieceMask *mask = getPieceMask((PieceType)type, rotation);
+            if (rotation == 0)
+                copyPiece(entry->shape, PIECES[type]);
+            else
+            {
+                copyPiece(entry->shape, shapes[type][rotation - 1].shape);
+                rotatePiece(entry->shape);
+            }
+
+            entry->topRow = 0;
+            while (entry->topRow < 3 && mask->rows[entry->topRow] == 0)
+                entry->topRow++;
+            unsigned columns = mask->rows[0] | mask->rows[1] | mask->rows[2] | mask->rows[3];
+            entry->leftCol = __builtin_ctz(columns);
+
+            entry->normalized = 0;
+            for (int r = entry->topRow; r < 4; r++)
+            {
+                entry->normalized |= (uint16_t)((mask->rows[r] >> entry->leftCol) << ((r - entry->topRow) * 4));
+            }
+        }
+    }
+}
+
+// ============ BFS ============
+
+typedef struct
+{
+    uint16_t normalized;
+    int column; // Columna de tablero del primer bloque (x + leftCol)
+    int row;    // Fila de tablero del primer bloque al caer; -1 = cualquiera
+} FinesseTarget;
+
+typedef struct
+{
+    signed char x;
+    signed char y;
+    signed char rotation;
+    unsigned char key;
+    short parent;
+} FinesseNode;
+
+static int nodeIndex(int x, int y, int rotation)
+{
+    if (x < BFS_MIN_X || x >= BFS_MAX_X || y < BFS_MIN_Y || y >= BFS_MAX_Y)
+        return -1;
+    return ((y - BFS_MIN_Y) * (BFS_MAX_X - BFS_MIN_X) + (x - BFS_MIN_X)) * 4 + rotation;
+}
+
+static FinesseTarget makeTarget(PieceType type, int rotation, int x, int y)
+{
+    const FinesseShape *shape = &shapes[type][rotation & 3];
+    FinesseTarget target;
+    target.normalized = shape->normalized;
+    target.column = x + shape->leftCol;
+    target.row = y >= 0 ? y + shape->topRow : -1;
+    return target;
+}
+
+static bool isTarget(int grid[GRID_HEIGHT][GRID_WIDTH], PieceType type, int x, int y, int rotation,
+                     const FinesseTarget *target)
+{
+    const FinesseShape *shape = &shapes[type][rotation];
+    if (shape->normalized != target->normalized || x + shape->leftCol != target->column)
+        return false;
+    if (target->row < 0)
+        return true;
+
+    int shapeCopy[4][4];
+    copyPiece(shapeCopy, shape->shape);
+    while (!checkCollision(grid, shapeCopy, x, y + 1))
+    {
+        y++;
+    }
+    return y + shape->topRow == target->row;
+}
+
+// Aplica un toque con las reglas de stepGame. false si no tiene efecto.
+static bool applyKey(int grid[GRID_HEIGHT][GRID_WIDTH], PieceType type, unsigned key, int *x, int *y,
+                     int *rotation)
+{
+    int shape[4][4];
+    copyPiece(shape, shapes[type][*rotation].shape);
+
+    if (key == INPUT_LEFT || key == INPUT_RIGHT)
+    {
+        int newX = *x + (key == INPUT_LEFT ? -1 : 1);
+        if (checkCollision(grid, shape, newX, *y))
+            return false;
+        *x = newX;
+        return true;
+    }
+
+    if (!rotatePieceWithKicks(grid, shape, x, y))
+        return false;
+    *rotation = (*rotation + 1) % 4;
+    return true;
+}
+
+static bool searchPath(int grid[GRID_HEIGHT][GRID_WIDTH], PieceType type, int startX, int startY,
+                       int startRotation, const FinesseTarget *target, FinessePath *path)
+{
+    static const unsigned KEYS[3] = {INPUT_ROTATE, INPUT_LEFT, INPUT_RIGHT};
+    FinesseNode nodes[BFS_NODES];
+    short queue[BFS_NODES];
+    bool visited[BFS_NODES];
+    int head = 0;
+    int tail = 0;
+
+    int start = nodeIndex(startX, startY, startRotation);
+    if (start < 0)
+        return false;
+    memset(visited, 0, sizeof(visited));
+    visited[start] = true;
+    nodes[start] = (FinesseNode){(signed char)startX, (signed char)startY, (signed char)startRotation, 0, -1};
+    queue[tail++] = (short)start;
+
+    while (head < tail)
+    {
+        int current = queue[head++];
+        FinesseNode *node = &nodes[current];
+
+        if (isTarget(grid, type, node->x, node->y, node->rotation, target))
+        {
+            int length = 0;
+            for (int i = current; nodes[i].parent >= 0; i = nodes[i].parent)
+                length++;
+            if (length > FINESSE_MAX_KEYS)
+                return false;
+
+            path->length = length;
+            for (int i = current; nodes[i].parent >= 0; i = nodes[i].parent)
+                path->keys[--length] = nodes[i].key;
+            return true;
+        }
+
+        for (int k = 0; k < 3; k++)
+        {
+            int x = node->x;
+            int y = node->y;
+            int rotation = node->rotation;
+            if (!applyKey(grid, type, KEYS[k], &x, &y, &rotation))
+                continue;
+
+            int next = nodeIndex(x, y, rotation);
+            if (next < 0 || visited[next])
+                continue;
+            visited[next] = true;
+            nodes[next] = (FinesseNode){(signed char)x, (signed char)y, (signed char)rotation,
+                                        (unsigned char)KEYS[k], (short)current};
+            queue[tail++] = (short)next;
+        }
+    }
+    return false;
+}
+
+// ============ TABLA DEL TABLERO VACÍO ============
+
+static void buildTable(void)
+{
+    int empty[GRID_HEIGHT][GRID_WIDTH] = {{0}};
+    buildShapes();
+
+    for (int type = 0; type < NUM_PIECES; type++)
+    {
+        for (int rotation = 0; rotation < 4; rotation++)
+        {
+            for (int x = -3; x < GRID_WIDTH; x++)
+            {
+                FinessePath *path = &openField[type][rotation][x + 3];
+                FinesseTarget target = makeTarget((PieceType)type, rotation, x, -1);
+                if (checkCollision(empty, shapes[type][rotation].shape, x, SPAWN_Y) ||
+                    !searchPath(empty, (PieceType)type, SPAWN_X, SPAWN_Y, 0, &target, path))
+                {
+                    path->length = -1;
+                }
+            }
+        }
+    }
+}
+
+const FinessePath *getFinessePath(PieceType type, int rotation, int x)
+{
+    pthread_once(&tableOnce, buildTable);
+    if (type < 0 || type >= NUM_PIECES || x < -3 || x >= GRID_WIDTH)
+        return NULL;
+    const FinessePath *path = &openField[type][rotation & 3][x + 3];
+    return path->length >= 0 ? path : NULL;
+}
+
+int getFinesseKeyCount(PieceType type, int rotation, int x)
+{
+    const FinessePath *path = getFinessePath(type, rotation, x);
+    return path != NULL ? path->length : -1;
+}
+
+bool findFinessePath(const GameState *state, int rotation, int x, int y, FinessePath *path)
+{
+    pthread_once(&tableOnce, buildTable);
+    FinesseTarget target = makeTarget(state->currentType, rotation, x, y);
+    return searchPath((int(*)[GRID_WIDTH])state->grid, state->currentType, state->pieceX, state->pieceY,
+                      state->rotation, &target, path);
+}
+
+bool planFinesse(const GameState *state, int rotation, int x, int y, FinessePath *path)
+{
+    const FinessePath *table = getFinessePath(state->currentType, rotation, x);
+    if (table != NULL && state->rotation == 0 && state->pieceX == SPAWN_X)
+    {
+        // Repetir el camino sobre el tablero real: si cada toque tiene efecto
+        // y termina en la colocación pedida, no hace falta buscar
+        int (*grid)[GRID_WIDTH] = (int(*)[GRID_WIDTH])state->grid;
+        int px = state->pieceX;
+        int py = state->pieceY;
+        int pr = 0;
+        bool valid = true;
+        for (int i = 0; i < table->length && valid; i++)
+        {
+            valid = applyKey(grid, state->currentType, table->keys[i], &px, &py, &pr);
+        }
+
+        FinesseTarget target = makeTarget(state->currentType, rotation, x, y);
+        if (valid && isTarget(grid, state->currentType, px, py, pr, &target))
+        {
+            *path = *table;
+            return true;
+        }
+    }
+    return findFinessePath(state, rotation, x, y, path);
+}
+
+bool finesseReached(const GameState *state, int rotation, int x)
+{
+    pthread_once(&tableOnce, buildTable);
+    const FinesseShape *current = &shapes[state->currentType][state->rotation & 3];
+    const FinesseShape *wanted = &shapes[state->currentType][rotation & 3];
+    return current->normalized == wanted->normalized && state->pieceX + current->leftCol == x + wanted->leftCol;
+}
@@ -0,0 +1,45 @@
+#ifndef FINESSE_H
+#define FINESSE_H
+
+#include <stdbool.h>
+#include "game.h"
+
+// ============ FINESSE: TECLAS MÍNIMAS POR COLOCACIÓN ============
+// Secuencia más corta de toques (INPUT_LEFT, INPUT_RIGHT, INPUT_ROTATE)
+// que lleva la pieza desde donde está hasta una colocación, con las mismas
+// reglas que stepGame (rotación horaria con WALL_KICKS) y sin contar la
+// gravedad. Después de la secuencia solo queda mantener INPUT_DOWN.
+//
+// Para el tablero vacío hay una tabla precalculada por pieza, rotación y
+// columna desde el spawn: planFinesse la usa si la secuencia sigue siendo
+// válida sobre el tablero real y si no hace un BFS sobre la grilla.
+//
+// Dos colocaciones son la misma si dejan los mismos bloques: la O no
+// necesita rotar y la I/S/Z se pueden lograr con cualquiera de sus dos
+// orientaciones equivalentes.
+
+#define FINESSE_MAX_KEYS 32
+
+typedef struct
+{
+    unsigned char keys[FINESSE_MAX_KEYS]; // Un InputFlags por toque
+    int length;
+} FinessePath;
+
+// Camino desde el spawn en el tablero vacío; NULL si la colocación no existe
+const FinessePath *getFinessePath(PieceType type, int rotation, int x);
+
+// Teclas de la tabla (el costo de una colocación en O(1)); -1 si no existe
+int getFinesseKeyCount(PieceType type, int rotation, int x);
+
+// BFS desde la pieza actual de `state` hasta (rotation, x) cayendo en la
+// fila `y` (-1 = cualquiera). false si no se llega.
+bool findFinessePath(const GameState *state, int rotation, int x, int y, FinessePath *path);
+
+// Tabla si la pieza está en el spawn y el camino sirve, BFS si no
+bool planFinesse(const GameState *state, int rotation, int x, int y, FinessePath *path);
+
+// La pieza actual ya deja los mismos bloques que (rotation, x) al caer
+bool finesseReached(const GameState *state, int rotation, int x);
+
+#endif // FINESSE_H
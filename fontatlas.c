@@ -0,0 +1,974 @@
+// Generado por tools/fontbake.c a partir de DejaVuSans.ttf a 22 px. No editar:
+// regenerar con `make font`. La fuente DejaVu se distribuye bajo la
+// licencia de Bitstream Vera, que permite embeberla.
+
+#include "fontatlas.h"
+
+static const unsigned char ALPHA[13824] = {
+    0xa0, 0x8f, 0xd0, 0x0e, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xf4, 0x07, 0x50, 0x5f, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0x20, 0xeb, 0x9e, 0x01, 0x00, 0x00, 0xb0, 0x1e, 0x00, 0x00, 0x00,
+    0x20, 0xd9, 0xde, 0x4a, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0x30, 0x9f, 0x10, 0xbe, 0x00, 0x00,
+    0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x60, 0xdf,
+    0xe0, 0xff, 0xff, 0x0d, 0xfa, 0x09, 0x00, 0x00, 0x80, 0x4f, 0x00, 0x00, 0xc6, 0xee, 0x6c, 0x00,
+    0x00, 0x41, 0xc8, 0xff, 0x06, 0x00, 0x00, 0x84, 0xec, 0xdf, 0x4a, 0x00, 0x00, 0x72, 0xdb, 0xef,
+    0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x7f, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0x0d, 0x00,
+    0x00, 0x00, 0xc7, 0xee, 0x7c, 0x01, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0xd0, 0x0e, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xf8, 0x03, 0xa0, 0x1f, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0xd0, 0x2c, 0xe3, 0x0c, 0x00, 0x00, 0xf5, 0x06, 0x00, 0x00, 0x00,
+    0xe2, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0xb0, 0x2f, 0x00, 0xf7, 0x05, 0x00,
+    0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x60, 0xcf,
+    0xe0, 0xff, 0xff, 0x0d, 0xfa, 0x09, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0x90, 0xff, 0xff, 0xff, 0x09,
+    0x00, 0xf9, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0xfd, 0xff, 0xff,
+    0xff, 0x0b, 0x00, 0x00, 0x00, 0x40, 0xff, 0x7f, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0x0d, 0x00,
+    0x00, 0xd2, 0xff, 0xff, 0xff, 0x08, 0x30, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0xd0, 0x0e, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0xec, 0x00, 0xe0, 0x0c, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0xf6, 0x04, 0x70, 0x4f, 0x00, 0x10, 0xbe, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0x4d, 0x11, 0xb5, 0x02, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0xf4, 0x09, 0x00, 0xe1, 0x0d, 0x00,
+    0xc1, 0x04, 0xf2, 0x02, 0xc4, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x90, 0x7f,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0x09, 0x00, 0x00, 0xf3, 0x09, 0x00, 0xf6, 0x7f, 0x11, 0xf7, 0x5f,
+    0x00, 0xb8, 0x37, 0xfb, 0x06, 0x00, 0x40, 0x7b, 0x13, 0x31, 0xfb, 0x4f, 0x00, 0x8b, 0x24, 0x20,
+    0xf8, 0x7f, 0x00, 0x00, 0x00, 0xd1, 0xbc, 0x7f, 0x00, 0x00, 0xf9, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xfd, 0x5d, 0x01, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x8f, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0xd0, 0x0e, 0xc0, 0x0f, 0x00, 0x00, 0x10, 0xaf, 0x00, 0xf3, 0x08, 0x00, 0x00, 0x30,
+    0xd9, 0xff, 0xad, 0x04, 0x00, 0xfa, 0x00, 0x30, 0x8f, 0x00, 0x90, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0xfb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0xfa, 0x03, 0x00, 0xa0, 0x4f, 0x00,
+    0x71, 0xbe, 0xf4, 0xb4, 0x7e, 0x01, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0xd0, 0x0d,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x05, 0x00, 0xfd, 0x08, 0x00, 0x80, 0xcf,
+    0x00, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x9f, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0xcf, 0x00, 0x00, 0x00, 0xf9, 0xa3, 0x7f, 0x00, 0x00, 0xf9, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x2f, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0xd0, 0x0e, 0xc0, 0x0f, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0xf5,
+    0xff, 0xff, 0xff, 0x3f, 0x00, 0xeb, 0x00, 0x20, 0x9f, 0x00, 0xf3, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xf9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x10, 0xdf, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0x00, 0x71, 0xfe, 0x7e, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x20, 0xff, 0x01, 0x00, 0x10, 0xff,
+    0x02, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaf, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xcf, 0x00, 0x00, 0x40, 0x8f, 0xa0, 0x7f, 0x00, 0x00, 0xf9, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x0b, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0xd0, 0x0e, 0xc0, 0x0f, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0xfd,
+    0x3a, 0x7a, 0x52, 0x3b, 0x00, 0xfa, 0x00, 0x30, 0x7f, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x60, 0x9f, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x71, 0xfe, 0x7e, 0x01, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbf, 0x00, 0x50, 0xcf, 0x00, 0x00, 0x00, 0xfd,
+    0x05, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x8f, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xaf, 0x00, 0x00, 0xd1, 0x0c, 0xa0, 0x7f, 0x00, 0x00, 0xf9, 0xec, 0xdf, 0x3a, 0x00, 0x00,
+    0xf3, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0e, 0x00, 0xdd, 0x00, 0x00, 0x20, 0xef,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0xf7, 0x04, 0x60, 0x4f, 0x70, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe5, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x5f, 0x00, 0x00, 0x00, 0xfc, 0x04,
+    0x70, 0xbe, 0xf4, 0xb4, 0x7e, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x6f, 0x00, 0x70, 0xaf, 0x00, 0x00, 0x00, 0xfb,
+    0x07, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x3f, 0x00, 0x00, 0x00, 0x20,
+    0xf7, 0x2e, 0x00, 0x00, 0xf9, 0x03, 0xa0, 0x7f, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0x07, 0x00,
+    0xf6, 0x0d, 0xd8, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x40, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x0a, 0x30, 0x8f, 0x00, 0x00, 0x20, 0xdf,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0xd1, 0x2c, 0xd3, 0x0c, 0xe2, 0x09, 0xa2, 0xee, 0x1a, 0x00, 0x40,
+    0xcf, 0xe4, 0x6f, 0x00, 0x00, 0xf5, 0x0a, 0x00, 0x00, 0xd0, 0x3f, 0x00, 0x00, 0x00, 0xf9, 0x07,
+    0xc1, 0x05, 0xf2, 0x02, 0xc5, 0x01, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x1f, 0x00, 0x80, 0xaf, 0x00, 0x00, 0x00, 0xfa,
+    0x08, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0x00, 0x00, 0xf8, 0xff,
+    0xaf, 0x03, 0x00, 0x40, 0x8f, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x78, 0x13, 0x41, 0xfc, 0x4f, 0x00,
+    0xf7, 0xbc, 0xff, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x06, 0x70, 0x4f, 0x00, 0x00, 0x00, 0xfc,
+    0x19, 0x7a, 0x00, 0x00, 0x00, 0x20, 0xeb, 0xae, 0x01, 0xeb, 0x01, 0xdd, 0x22, 0xcd, 0x00, 0xe1,
+    0x1e, 0x30, 0xfe, 0x07, 0x00, 0xf7, 0x07, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x08,
+    0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x00, 0x80, 0xaf, 0x00, 0x00, 0x00, 0xfa,
+    0x08, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xbf, 0x00, 0x00, 0x00, 0xf8, 0xff,
+    0xdf, 0x07, 0x00, 0xd1, 0x0c, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xbf, 0x00,
+    0xf7, 0xff, 0x27, 0x31, 0xfc, 0x1e, 0x00, 0x00, 0x00, 0xf1, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0xd2,
+    0xff, 0xcf, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6f, 0x60, 0x5f, 0x00, 0xf5, 0x05, 0xf6,
+    0x09, 0x00, 0xe3, 0x7f, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0xf7, 0x0a,
+    0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x07, 0x00, 0x70, 0xaf, 0x00, 0x00, 0x00, 0xfb,
+    0x07, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xe6, 0x8f, 0x00, 0xf9, 0x03, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00,
+    0xf6, 0x7f, 0x00, 0x00, 0xe1, 0x6f, 0x00, 0x00, 0x00, 0xf7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00,
+    0x95, 0xfe, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xe1, 0x0b, 0x90, 0x1f, 0x00, 0xf2, 0x08, 0xf8,
+    0x07, 0x00, 0x30, 0xfe, 0x48, 0xaf, 0x00, 0x00, 0x00, 0xf1, 0x0f, 0x00, 0x00, 0x00, 0xf7, 0x0a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x50, 0xcf, 0x00, 0x00, 0x00, 0xfd,
+    0x05, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x00, 0xb1, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xff, 0x01, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x01,
+    0xf4, 0x3f, 0x00, 0x00, 0xa0, 0x9f, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xaf, 0x00, 0xf3, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0xb4, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x02, 0xa0, 0x0f, 0x00, 0xf1, 0x0a, 0xf8,
+    0x0a, 0x00, 0x00, 0xe3, 0xef, 0x2e, 0x00, 0x00, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x20, 0xff, 0x01, 0x00, 0x10, 0xff,
+    0x02, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0x10, 0xfb, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfe, 0x03, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x00,
+    0xf1, 0x3f, 0x00, 0x00, 0xa0, 0x8f, 0x00, 0x00, 0x30, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6f, 0x00, 0xf7, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0xfe, 0x01, 0x00, 0x00, 0x30, 0x7f, 0x00, 0x90, 0x1f, 0x00, 0xf2, 0x08, 0xf5,
+    0x3f, 0x00, 0x00, 0x40, 0xff, 0x0a, 0x00, 0x00, 0x00, 0xd0, 0x3f, 0x00, 0x00, 0x00, 0xf9, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x8f, 0x00, 0x00, 0x00, 0xfd, 0x08, 0x00, 0x80, 0xcf,
+    0x00, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x00, 0xc1, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xff, 0x02, 0x00, 0x00, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xbf, 0x00,
+    0xb0, 0x7f, 0x00, 0x00, 0xe1, 0x6f, 0x00, 0x00, 0x90, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x2f, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xd0, 0x0d, 0x00, 0x60, 0x5f, 0x00, 0xf5, 0x05, 0xc0,
+    0xef, 0x27, 0x20, 0xd6, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xa0, 0x6f, 0x00, 0x00, 0x00, 0xfc, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x3f, 0x00, 0x00, 0x00, 0xf6, 0x7f, 0x11, 0xf7, 0x5f,
+    0x00, 0x00, 0x00, 0xfb, 0x06, 0x00, 0x10, 0xfc, 0x0b, 0x00, 0x00, 0x00, 0x50, 0x5a, 0x12, 0x21,
+    0xe7, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x7f, 0x00, 0x40, 0x5b, 0x12, 0x41, 0xfb, 0x5f, 0x00,
+    0x40, 0xff, 0x27, 0x31, 0xfc, 0x1e, 0x00, 0x00, 0xe1, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0c, 0x10, 0xbf, 0x00, 0x00, 0x00, 0x20, 0x6b,
+    0x02, 0x7a, 0xb3, 0xdf, 0x00, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0xdd, 0x22, 0xcd, 0x00, 0x20,
+    0xfd, 0xff, 0xff, 0xff, 0x57, 0xff, 0x04, 0x00, 0x00, 0x60, 0x9f, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0x09,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x50, 0xff, 0xff, 0xff,
+    0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x7f, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00,
+    0x00, 0xf7, 0xff, 0xff, 0xef, 0x04, 0x00, 0x00, 0xf6, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff,
+    0xff, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x20, 0x9f, 0x00, 0x00, 0x00, 0xa2, 0xee, 0x2a, 0x00, 0x00,
+    0x71, 0xec, 0xdf, 0x29, 0x00, 0xf9, 0x2e, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x09, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xee, 0x6c, 0x00,
+    0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x60, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x94, 0xec, 0xef,
+    0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x94, 0xec, 0xdf, 0x39, 0x00, 0x00,
+    0x00, 0x40, 0xeb, 0xdf, 0x29, 0x00, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+    0xec, 0xff, 0x9d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x03, 0x00, 0xa0, 0x4f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x09, 0x00, 0xe1, 0x0d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x2f, 0x00, 0xf7, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x9f, 0x10, 0xbe, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x81, 0xfd, 0xdf, 0x18, 0x00, 0x00, 0x20, 0xd9, 0xef, 0x4b, 0x00, 0x00, 0xf6, 0x0d, 0x60,
+    0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x2c, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0x90, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xed, 0xbe, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x94, 0xec, 0xdf, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xef, 0x00, 0x00,
+    0x00, 0xd0, 0xff, 0xff, 0xef, 0x7c, 0x01, 0x00, 0x00, 0x00, 0xa5, 0xed, 0xde, 0x29, 0x00, 0xd0,
+    0xff, 0xff, 0xde, 0x8b, 0x03, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfd, 0xff, 0xff,
+    0xff, 0x6f, 0x00, 0x00, 0x40, 0xd9, 0xfe, 0xad, 0x05, 0x00, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0x00, 0x20, 0xfd, 0x1b, 0x00, 0x00,
+    0x30, 0xfe, 0xff, 0xff, 0xef, 0x02, 0x00, 0xe4, 0xff, 0xff, 0xff, 0x07, 0x00, 0xf6, 0x0d, 0x60,
+    0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x2f, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0xa0, 0xff, 0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0x6f, 0x00, 0x00,
+    0x00, 0xc3, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x01, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x05, 0x00,
+    0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x08, 0xd0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0x01, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfd, 0xff, 0xff,
+    0xff, 0x6f, 0x00, 0x10, 0xfb, 0xff, 0xff, 0xff, 0xdf, 0x04, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0x00, 0xe3, 0xaf, 0x00, 0x00, 0x00,
+    0xb0, 0xdf, 0x15, 0x51, 0xfd, 0x0b, 0x10, 0xfe, 0x3c, 0x21, 0xf7, 0x4f, 0x00, 0xf6, 0x0d, 0x60,
+    0xdf, 0x00, 0x00, 0x00, 0x30, 0xe8, 0xff, 0x9e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xc6, 0xff, 0xbf, 0x15, 0x00, 0x00, 0x00, 0x60, 0x5a, 0x01, 0xb3, 0xef, 0x00, 0x00,
+    0x60, 0xff, 0x6c, 0x13, 0x20, 0x84, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfb, 0x0b, 0x00,
+    0x00, 0xd0, 0x5f, 0x00, 0x20, 0xf7, 0x8f, 0x00, 0x10, 0xfd, 0x8e, 0x13, 0x20, 0xd6, 0x3f, 0xd0,
+    0x5f, 0x00, 0x21, 0xa4, 0xff, 0x1d, 0x00, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xef, 0x38, 0x01, 0x41, 0xf9, 0x0c, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0x30, 0xfe, 0x09, 0x00, 0x00, 0x00,
+    0xf1, 0x4f, 0x00, 0x00, 0xf4, 0x1f, 0x60, 0xef, 0x01, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x71, 0xfc, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x82, 0xfd, 0xef, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x02, 0x00,
+    0xf5, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x91, 0xcf, 0x00, 0x00, 0x00, 0x10, 0xef, 0xe1, 0x2f, 0x00,
+    0x00, 0xd0, 0x5f, 0x00, 0x00, 0x80, 0xcf, 0x00, 0xa0, 0xef, 0x03, 0x00, 0x00, 0x00, 0x27, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0xe4, 0xaf, 0x00, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xfa, 0x2e, 0x00, 0x00, 0x00, 0x20, 0x09, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0xe4, 0x9f, 0x00, 0x00, 0x00, 0x00,
+    0xf1, 0x1f, 0x00, 0x00, 0xf1, 0x1f, 0x90, 0xaf, 0x00, 0x00, 0x30, 0xff, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xb5, 0xff, 0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xe9, 0xff, 0x7d, 0x02, 0x00, 0x00, 0x00, 0x40, 0xef, 0x00, 0x20,
+    0xee, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x00, 0x00, 0x60, 0x9f, 0x90, 0x7f, 0x00,
+    0x00, 0xd0, 0x5f, 0x00, 0x00, 0x50, 0xdf, 0x00, 0xf2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x60, 0xff, 0x02, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x20, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x40, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0x4f, 0x00, 0x00, 0xf4, 0x0d, 0x90, 0xaf, 0x00, 0x00, 0x30, 0xff, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0xff, 0x7d, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xe4, 0x5f, 0x00, 0x90,
+    0x4f, 0x00, 0x60, 0xfd, 0x7d, 0xe0, 0x09, 0xb0, 0x1e, 0x00, 0x00, 0xc0, 0x4f, 0x30, 0xdf, 0x00,
+    0x00, 0xd0, 0x5f, 0x00, 0x00, 0x80, 0xaf, 0x00, 0xf7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x05, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x70, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0xf5, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xdf, 0x15, 0x51, 0xfd, 0x05, 0x60, 0xef, 0x01, 0x00, 0x70, 0xff, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0xff, 0x7c, 0x02, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x1f, 0x00, 0x00, 0x50, 0xff, 0x05, 0x00, 0xf1,
+    0x0a, 0x00, 0xf8, 0xff, 0xff, 0xe9, 0x09, 0x50, 0x4f, 0x00, 0x00, 0xf3, 0x0d, 0x00, 0xfd, 0x04,
+    0x00, 0xd0, 0x5f, 0x00, 0x20, 0xf6, 0x4f, 0x00, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0xa0, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0xaf, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc5, 0xff, 0xff, 0x5c, 0x00, 0x10, 0xfe, 0x3b, 0x21, 0xf7, 0xff, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xb5, 0xff, 0xbf, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xe9, 0xff, 0x8d, 0x02, 0x00, 0x00, 0xf3, 0x4e, 0x00, 0x00, 0xf5,
+    0x04, 0x20, 0xef, 0x16, 0x51, 0xfe, 0x09, 0x20, 0x6f, 0x00, 0x00, 0xf9, 0x08, 0x00, 0xf7, 0x09,
+    0x00, 0xd0, 0xff, 0xff, 0xff, 0xcf, 0x05, 0x00, 0xfb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x09, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff,
+    0xff, 0x0a, 0xb0, 0x8f, 0x00, 0x00, 0x70, 0xff, 0xff, 0x4f, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xe9, 0xff, 0xff, 0x9e, 0x01, 0x00, 0xf5, 0xff, 0xff, 0xbf, 0xfc, 0x06, 0xf6, 0x0d, 0x60,
+    0xdf, 0x00, 0x00, 0x71, 0xfc, 0xef, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x82, 0xfd, 0xef, 0x49, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x07, 0x00, 0x00, 0xf7,
+    0x01, 0x60, 0x6f, 0x00, 0x00, 0xf6, 0x09, 0x20, 0x6f, 0x00, 0x00, 0xfe, 0x02, 0x00, 0xf2, 0x1e,
+    0x00, 0xd0, 0xff, 0xff, 0xff, 0xef, 0x19, 0x00, 0xfb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x09, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x00, 0xfd, 0xff, 0xff,
+    0xff, 0x0a, 0xb0, 0x8f, 0x00, 0x00, 0x70, 0xff, 0xff, 0x4f, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0xbf, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0xbf, 0x14, 0x41, 0xfc, 0x0b, 0x00, 0x30, 0xea, 0xdf, 0x08, 0xfd, 0x05, 0xf6, 0x0d, 0x60,
+    0xcf, 0x00, 0x00, 0x00, 0x30, 0xe8, 0xff, 0x9e, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xc6, 0xff, 0xbf, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x05, 0x00, 0x00, 0xf8,
+    0x00, 0x80, 0x3f, 0x00, 0x00, 0xf3, 0x09, 0x50, 0x5f, 0x00, 0x50, 0xbf, 0x00, 0x00, 0xb0, 0x6f,
+    0x00, 0xd0, 0x5f, 0x00, 0x10, 0xb4, 0xcf, 0x00, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x08, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0xa0, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x4f, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0xf7, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf4, 0x1e, 0x00, 0x00, 0xe1, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x03, 0xf6, 0x0d, 0x90,
+    0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa0, 0xff, 0x7c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x05, 0x00, 0x00, 0xf7,
+    0x01, 0x60, 0x6f, 0x00, 0x00, 0xf6, 0x09, 0xc0, 0x1e, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xcf,
+    0x00, 0xd0, 0x5f, 0x00, 0x00, 0x10, 0xfe, 0x04, 0xf7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x05, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x70, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x4f, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x70, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0xf7, 0x0b, 0x00, 0x00, 0xb0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x70, 0xdf, 0x00, 0x00, 0x00, 0xd0,
+    0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5,
+    0x04, 0x20, 0xef, 0x15, 0x51, 0xfe, 0x49, 0xfc, 0x07, 0x00, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x02, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xfc, 0x07, 0xf2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0x60, 0xff, 0x02, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x20, 0xff, 0x05, 0x00, 0x00, 0x00, 0xe0, 0x4f, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0xf7, 0x6f, 0x00, 0x00, 0x00, 0x00,
+    0xf6, 0x1e, 0x00, 0x00, 0xe1, 0x6f, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x7f, 0x00, 0x00, 0x00, 0xf2,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1,
+    0x09, 0x00, 0xf8, 0xff, 0xff, 0xe9, 0xff, 0x8f, 0x00, 0x00, 0xf7, 0x0b, 0x00, 0x00, 0x00, 0xfa,
+    0x08, 0xd0, 0x5f, 0x00, 0x00, 0x10, 0xfe, 0x07, 0xa0, 0xef, 0x03, 0x00, 0x00, 0x00, 0x27, 0xd0,
+    0x5f, 0x00, 0x00, 0x00, 0xe4, 0xaf, 0x00, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xfa, 0x2e, 0x00, 0x00, 0x00, 0xe0, 0x4f, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0x70, 0xff, 0x06, 0x00, 0x00, 0x00,
+    0xf2, 0xbf, 0x14, 0x41, 0xfb, 0x2f, 0x00, 0x88, 0x13, 0x51, 0xfd, 0x0d, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00, 0xa0,
+    0x3f, 0x00, 0x60, 0xfd, 0x7d, 0xe0, 0x9d, 0x03, 0x00, 0x00, 0xfd, 0x06, 0x00, 0x00, 0x00, 0xf5,
+    0x0e, 0xd0, 0x5f, 0x00, 0x10, 0xb4, 0xff, 0x02, 0x10, 0xfd, 0x8e, 0x13, 0x20, 0xd6, 0x3f, 0xd0,
+    0x5f, 0x00, 0x20, 0x94, 0xff, 0x1d, 0x00, 0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0xd1, 0xef, 0x38, 0x01, 0x31, 0xf9, 0x4f, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0x00, 0xf7, 0x6f, 0x00, 0x00, 0x00,
+    0x60, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0xf9, 0xff, 0xff, 0xdf, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00, 0x20,
+    0xdf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xef, 0x01, 0x00, 0x00, 0x00, 0xe0,
+    0x4f, 0xd0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff, 0xff, 0x08, 0xd0,
+    0xff, 0xff, 0xff, 0xff, 0xbf, 0x01, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x07, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xd0, 0x5f, 0xd0, 0x5f, 0x00, 0x00, 0x70, 0xff, 0x06, 0x00, 0x00,
+    0x00, 0xa3, 0xfd, 0xdf, 0x3a, 0x00, 0x00, 0x71, 0xec, 0xce, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x00, 0x00,
+    0xf6, 0x4e, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x01, 0x00, 0xa0, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xaf, 0xd0, 0xff, 0xff, 0xff, 0xad, 0x04, 0x00, 0x00, 0x00, 0xa5, 0xed, 0xde, 0x29, 0x00, 0xd0,
+    0xff, 0xff, 0xde, 0x8b, 0x03, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0x08, 0xfd, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xd9, 0xfe, 0xbe, 0x17, 0x00, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xc0,
+    0x6f, 0xd0, 0x5f, 0x00, 0x00, 0xe0, 0x4f, 0xd0, 0x5f, 0x00, 0x00, 0x00, 0xf7, 0x6f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xff, 0x6b, 0x12, 0x20, 0xc6, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xd4, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0xfb, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x95, 0xed, 0xde, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xef, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x9f, 0x00, 0x00, 0x00, 0x90, 0xff, 0x0c, 0xfd, 0x5f,
+    0x00, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0xb6, 0xfe, 0xce, 0x18, 0x00, 0x00, 0xd0, 0xff, 0xff,
+    0xdf, 0x39, 0x00, 0x00, 0x00, 0x60, 0xeb, 0xef, 0x8c, 0x01, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xad,
+    0x04, 0x00, 0x00, 0x00, 0x92, 0xed, 0xde, 0x6b, 0x01, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0xfa, 0x09, 0x00, 0x00, 0x00, 0x00, 0xf9,
+    0x0a, 0xf2, 0x1f, 0x00, 0x00, 0x70, 0xff, 0x03, 0x00, 0x00, 0xf4, 0x0e, 0x00, 0xf4, 0x2e, 0x00,
+    0x00, 0x00, 0xf9, 0x0b, 0x00, 0xfb, 0x09, 0x00, 0x00, 0x00, 0xf3, 0x3f, 0x00, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0d, 0x20, 0xff, 0xff, 0x07, 0xed, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xef, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x0c, 0xfd, 0xdf,
+    0x00, 0x00, 0x00, 0xfc, 0x04, 0x00, 0xc2, 0xff, 0xff, 0xff, 0xef, 0x05, 0x00, 0xd0, 0xff, 0xff,
+    0xff, 0xff, 0x05, 0x00, 0x20, 0xfc, 0xff, 0xff, 0xff, 0x5e, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff,
+    0x8f, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x8f, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0xf4, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xfe,
+    0x04, 0xd0, 0x4f, 0x00, 0x00, 0xb0, 0xff, 0x07, 0x00, 0x00, 0xf8, 0x0a, 0x00, 0x90, 0xbf, 0x00,
+    0x00, 0x50, 0xef, 0x01, 0x00, 0xe1, 0x4f, 0x00, 0x00, 0x00, 0xfc, 0x07, 0x00, 0xfc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0c, 0x20, 0xff, 0xff, 0x07, 0xf8, 0x04, 0x00, 0x00, 0xd0, 0xff, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfc, 0x05, 0x00, 0x00, 0xf5, 0xfc, 0x0c, 0xfd, 0xfe,
+    0x06, 0x00, 0x00, 0xfc, 0x04, 0x10, 0xfd, 0x7e, 0x02, 0x51, 0xfc, 0x5f, 0x00, 0xd0, 0x5f, 0x00,
+    0x41, 0xfd, 0x1e, 0x00, 0xd1, 0xef, 0x27, 0x10, 0xc5, 0xff, 0x05, 0x00, 0xfd, 0x05, 0x10, 0xb3,
+    0xff, 0x02, 0x00, 0xe2, 0xbf, 0x14, 0x20, 0x94, 0x0a, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0xd0, 0x6f, 0x00, 0x00, 0x00, 0x50, 0xef,
+    0x00, 0xa0, 0x8f, 0x00, 0x00, 0xe0, 0xfc, 0x0b, 0x00, 0x00, 0xfc, 0x06, 0x00, 0x10, 0xfd, 0x06,
+    0x00, 0xe1, 0x5f, 0x00, 0x00, 0x50, 0xef, 0x01, 0x00, 0x80, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xef, 0x03, 0x20, 0xdf, 0x00, 0x00, 0xf3, 0x09, 0x00, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xf6, 0x0a, 0x00, 0x00, 0xfb, 0xf6, 0x0c, 0xfd, 0xf8,
+    0x1d, 0x00, 0x00, 0xfc, 0x04, 0xa0, 0xef, 0x02, 0x00, 0x00, 0xb0, 0xef, 0x01, 0xd0, 0x5f, 0x00,
+    0x00, 0xf2, 0x5f, 0x00, 0xfa, 0x2e, 0x00, 0x00, 0x00, 0xfb, 0x1e, 0x00, 0xfd, 0x05, 0x00, 0x10,
+    0xfe, 0x06, 0x00, 0xf6, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0x70, 0xbf, 0x00, 0x00, 0x00, 0xb0, 0x8f,
+    0x00, 0x60, 0xcf, 0x00, 0x00, 0xf3, 0xc8, 0x0e, 0x00, 0x10, 0xff, 0x02, 0x00, 0x00, 0xf4, 0x2e,
+    0x00, 0xfb, 0x09, 0x00, 0x00, 0x00, 0xfa, 0x0a, 0x00, 0xf3, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe2, 0x5f, 0x00, 0x20, 0xdf, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xc4, 0x1f, 0x00, 0x20, 0xcf, 0xf4, 0x0c, 0xfd, 0xb4,
+    0x7f, 0x00, 0x00, 0xfc, 0x04, 0xf2, 0x5f, 0x00, 0x00, 0x00, 0x10, 0xfe, 0x07, 0xd0, 0x5f, 0x00,
+    0x00, 0xd0, 0x7f, 0x20, 0xff, 0x05, 0x00, 0x00, 0x00, 0xe1, 0x7f, 0x00, 0xfd, 0x05, 0x00, 0x00,
+    0xfc, 0x07, 0x00, 0xf8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0x20, 0xff, 0x02, 0x00, 0x00, 0xf2, 0x2f,
+    0x00, 0x20, 0xff, 0x01, 0x00, 0xf7, 0x85, 0x3f, 0x00, 0x40, 0xdf, 0x00, 0x00, 0x00, 0x90, 0xbf,
+    0x60, 0xdf, 0x01, 0x00, 0x00, 0x00, 0xe1, 0x5f, 0x00, 0xfd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xfd, 0x07, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x90, 0x3f, 0x00, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x64, 0x7f, 0x00, 0x70, 0x6f, 0xf4, 0x0c, 0xfd, 0x34,
+    0xef, 0x01, 0x00, 0xfc, 0x04, 0xf7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x0b, 0xd0, 0x5f, 0x00,
+    0x00, 0xd0, 0x7f, 0x70, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x90, 0xcf, 0x00, 0xfd, 0x05, 0x00, 0x10,
+    0xfe, 0x05, 0x00, 0xf6, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0xfb, 0x08, 0x00, 0x00, 0xf7, 0x0c,
+    0x00, 0x00, 0xfd, 0x04, 0x00, 0xfb, 0x41, 0x7f, 0x00, 0x80, 0xaf, 0x00, 0x00, 0x00, 0x10, 0xfd,
+    0xe8, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x50, 0xef, 0x81, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0xaf, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x40, 0x8f, 0x00, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x14, 0xcf, 0x00, 0xd0, 0x1e, 0xf4, 0x0c, 0xfd, 0x04,
+    0xfa, 0x08, 0x00, 0xfc, 0x04, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x0e, 0xd0, 0x5f, 0x00,
+    0x00, 0xf2, 0x5f, 0xa0, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x50, 0xef, 0x00, 0xfd, 0x05, 0x10, 0xb3,
+    0xef, 0x01, 0x00, 0xe1, 0xdf, 0x47, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0xf5, 0x0d, 0x00, 0x00, 0xfd, 0x06,
+    0x00, 0x00, 0xfa, 0x08, 0x00, 0xce, 0x10, 0xbf, 0x00, 0xc0, 0x6f, 0x00, 0x00, 0x00, 0x00, 0xf4,
+    0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfc, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x1c, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0xfa, 0x03, 0xf3, 0x0a, 0xf4, 0x0c, 0xfd, 0x04,
+    0xf2, 0x1e, 0x00, 0xfc, 0x04, 0xfb, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0xd0, 0x5f, 0x00,
+    0x41, 0xfd, 0x1e, 0xb0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0xfd, 0xff, 0xff, 0xff,
+    0x3d, 0x00, 0x00, 0x40, 0xfe, 0xff, 0xdf, 0x29, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0xe0, 0x4f, 0x00, 0x30, 0xef, 0x01,
+    0x00, 0x00, 0xf6, 0x0c, 0x30, 0x9f, 0x00, 0xec, 0x00, 0xf1, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xb0,
+    0xef, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0xef, 0x02, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0xf4, 0x09, 0xf9, 0x04, 0xf4, 0x0c, 0xfd, 0x04,
+    0x90, 0x9f, 0x00, 0xfc, 0x04, 0xfb, 0x08, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x1f, 0xd0, 0xff, 0xff,
+    0xff, 0xff, 0x05, 0xb0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x01, 0xfd, 0xff, 0xff, 0xff,
+    0x05, 0x00, 0x00, 0x00, 0x50, 0xda, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x90, 0xaf, 0x00, 0x90, 0x9f, 0x00,
+    0x00, 0x00, 0xf2, 0x1f, 0x70, 0x5f, 0x00, 0xf8, 0x03, 0xf4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xf3,
+    0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3,
+    0x3f, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0xf5, 0x07, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0xd0, 0x1e, 0xde, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x20, 0xff, 0x02, 0xfc, 0x04, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x0e, 0xd0, 0xff, 0xff,
+    0xdf, 0x3a, 0x00, 0xa0, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x50, 0xef, 0x00, 0xfd, 0x05, 0x10, 0xf7,
+    0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xfc, 0x4f, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x02, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x30, 0xef, 0x01, 0xe1, 0x4f, 0x00,
+    0x00, 0x00, 0xd0, 0x4f, 0xb0, 0x1f, 0x00, 0xf5, 0x07, 0xf8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0xfa, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfe,
+    0x06, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0x80, 0xaf, 0x8f, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x00, 0xf8, 0x0a, 0xfc, 0x04, 0xf7, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x0b, 0xd0, 0x5f, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x90, 0xbf, 0x00, 0xfd, 0x05, 0x00, 0x70,
+    0xef, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x9f, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x10, 0xff, 0x02, 0x00, 0x00, 0x10, 0xff, 0x02, 0x00, 0x00, 0xfc, 0x06, 0xf5, 0x0d, 0x00,
+    0x00, 0x00, 0xa0, 0x8f, 0xe0, 0x0c, 0x00, 0xf1, 0x0b, 0xfc, 0x06, 0x00, 0x00, 0x00, 0x80, 0xcf,
+    0x90, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x9f,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0xb0, 0x1f, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0x20, 0xff, 0x2f, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x00, 0xe1, 0x3f, 0xfc, 0x04, 0xf2, 0x5f, 0x00, 0x00, 0x00, 0x10, 0xfe, 0x07, 0xd0, 0x5f, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xff, 0x05, 0x00, 0x00, 0x00, 0xe1, 0x6f, 0x00, 0xfd, 0x05, 0x00, 0x00,
+    0xfd, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xbf, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x00, 0xfe, 0x05, 0x00, 0x00, 0x40, 0xff, 0x00, 0x00, 0x00, 0xf6, 0x0c, 0xfb, 0x07, 0x00,
+    0x00, 0x00, 0x60, 0xcf, 0xf3, 0x09, 0x00, 0xc0, 0x1e, 0xff, 0x02, 0x00, 0x00, 0x00, 0xf4, 0x2e,
+    0x10, 0xfd, 0x06, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x0b,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x60, 0x6f, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0x00, 0xfc, 0x0c, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x00, 0x70, 0xbf, 0xfc, 0x04, 0xa0, 0xef, 0x02, 0x00, 0x00, 0xb0, 0xef, 0x01, 0xd0, 0x5f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0x2e, 0x00, 0x00, 0x00, 0xfb, 0x1d, 0x00, 0xfd, 0x05, 0x00, 0x00,
+    0xf6, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x9f, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00, 0xa0, 0xbf, 0x00, 0x00, 0x00, 0xf1, 0x4f, 0xff, 0x02, 0x00,
+    0x00, 0x00, 0x20, 0xff, 0xf8, 0x05, 0x00, 0x90, 0x7f, 0xdf, 0x00, 0x00, 0x00, 0x10, 0xfd, 0x06,
+    0x00, 0xf4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x70, 0xdf, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x20, 0xbf, 0x00, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0x05, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x00, 0x10, 0xfe, 0xfe, 0x04, 0x10, 0xfe, 0x7e, 0x02, 0x51, 0xfc, 0x5f, 0x00, 0xd0, 0x5f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe1, 0xef, 0x27, 0x10, 0xc5, 0xef, 0x03, 0x00, 0xfd, 0x05, 0x00, 0x00,
+    0xd0, 0x7f, 0x00, 0xb7, 0x36, 0x02, 0x41, 0xfb, 0x4f, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x00, 0xf3, 0xaf, 0x13, 0x30, 0xf9, 0x4f, 0x00, 0x00, 0x00, 0xa0, 0xef, 0xbf, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfd, 0xfe, 0x01, 0x00, 0x50, 0xef, 0x9f, 0x00, 0x00, 0x00, 0x90, 0xbf, 0x00,
+    0x00, 0x90, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x2e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfd, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x00, 0x00, 0xf6, 0xff, 0x04, 0x00, 0xc2, 0xff, 0xff, 0xff, 0xef, 0x05, 0x00, 0xd0, 0x5f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xfc, 0xff, 0xff, 0xff, 0x3c, 0x00, 0x00, 0xfd, 0x05, 0x00, 0x00,
+    0x60, 0xdf, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x40, 0xff, 0x5f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf9, 0xdf, 0x00, 0x00, 0x10, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xf5, 0x2e, 0x00,
+    0x00, 0x10, 0xfd, 0x06, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1f, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x05, 0x00, 0x40, 0xaf, 0x00,
+    0xfd, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfd, 0x04, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x0c, 0xfd, 0x04,
+    0x00, 0x00, 0xd0, 0xff, 0x04, 0x00, 0x00, 0xb6, 0xfe, 0xce, 0x18, 0x00, 0x00, 0xd0, 0x5f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xeb, 0xff, 0xef, 0x01, 0x00, 0x00, 0xfd, 0x05, 0x00, 0x00,
+    0x00, 0xfd, 0x06, 0x40, 0xc8, 0xfd, 0xde, 0x39, 0x00, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x93, 0xfd, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x0e, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf6, 0x9f, 0x00, 0x00, 0x00, 0xfd, 0x2f, 0x00, 0x00, 0x10, 0xfe, 0x05, 0x00,
+    0x00, 0x00, 0xf4, 0x2e, 0x00, 0x00, 0x00, 0x60, 0xcf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x1f, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xf3, 0x09, 0x00, 0x40, 0xaf, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfe, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x0e, 0x00, 0x40, 0xaf, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x80, 0x4f, 0x00, 0x40, 0xaf, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xaf, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xaf, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xff, 0x0b, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xb0,
+    0x5f, 0x00, 0x00, 0x72, 0xeb, 0xef, 0x4a, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0xc7, 0xee, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x71, 0xec, 0xce, 0x17, 0x00,
+    0x00, 0x00, 0xb3, 0xfe, 0x3f, 0x00, 0x30, 0xeb, 0xce, 0x06, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x60, 0xec, 0xae, 0x02, 0x81, 0xfd, 0x8d, 0x00, 0xf0, 0x0f, 0xc6, 0xee, 0x3b, 0x00, 0x00, 0x20,
+    0xd9, 0xef, 0x5b, 0x00, 0x00, 0xff, 0x60, 0xec, 0xae, 0x03, 0x00, 0x00, 0xa3, 0xee, 0x6c, 0xf0,
+    0x0f, 0xff, 0x60, 0xec, 0x0f, 0x00, 0x92, 0xfd, 0xce, 0x28, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf5, 0xef, 0xbf, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x10,
+    0xec, 0x02, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x06, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2,
+    0xff, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x20, 0xfd, 0xff, 0xff, 0xcf, 0x01,
+    0x00, 0x10, 0xfe, 0xff, 0x3f, 0x00, 0xf4, 0xff, 0xff, 0x9f, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0xf9, 0xff, 0xff, 0x1d, 0xfc, 0xff, 0xff, 0x0a, 0xf0, 0x9f, 0xff, 0xff, 0xff, 0x03, 0x00, 0xe4,
+    0xff, 0xff, 0xff, 0x0a, 0x00, 0xff, 0xf9, 0xff, 0xff, 0x4e, 0x00, 0x40, 0xff, 0xff, 0xff, 0xf9,
+    0x0f, 0xff, 0xf9, 0xff, 0x1f, 0x20, 0xfe, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0xff, 0x26, 0xfd, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd2, 0x0c, 0x00, 0x7a, 0x13, 0x21, 0xf8, 0x1e, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0x5d, 0x11, 0x73, 0x09, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xc0, 0xcf, 0x14, 0x41, 0xfc, 0x09,
+    0x00, 0x60, 0xcf, 0x02, 0x00, 0x10, 0xfe, 0x3b, 0x20, 0xf8, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x7f, 0x12, 0xe4, 0xdf, 0x6e, 0x11, 0xf6, 0x3f, 0xf0, 0xff, 0x28, 0x31, 0xfc, 0x0b, 0x10, 0xfe,
+    0x3c, 0x10, 0xf7, 0x6f, 0x00, 0xff, 0x8f, 0x02, 0xb3, 0xdf, 0x01, 0xe1, 0xbf, 0x03, 0x92, 0xff,
+    0x0f, 0xff, 0x8f, 0x02, 0x00, 0x90, 0xbf, 0x13, 0x31, 0x97, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0xf4, 0x5e, 0x00, 0xc1, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x90, 0x5f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x50, 0xef,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf5, 0x1d, 0x00, 0x00, 0xe2, 0x1f,
+    0x00, 0x90, 0x7f, 0x00, 0x00, 0x60, 0xdf, 0x00, 0x00, 0xa0, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x07, 0x00, 0x70, 0xff, 0x04, 0x00, 0xa0, 0x7f, 0xf0, 0x8f, 0x00, 0x00, 0xf3, 0x0e, 0x60, 0xef,
+    0x01, 0x00, 0x80, 0xdf, 0x00, 0xff, 0x0a, 0x00, 0x10, 0xfe, 0x06, 0xf6, 0x0d, 0x00, 0x00, 0xfa,
+    0x0f, 0xff, 0x09, 0x00, 0x00, 0xa0, 0x4f, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x01,
+    0x40, 0xee, 0x03, 0x00, 0x00, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xeb, 0xff, 0xff, 0x7f, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x90, 0x8f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xf9, 0x07, 0x00, 0x00, 0xb0, 0x4f,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x30, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x02, 0x00, 0x40, 0xef, 0x00, 0x00, 0x70, 0x8f, 0xf0, 0x2f, 0x00, 0x00, 0xe0, 0x1f, 0xa0, 0x8f,
+    0x00, 0x00, 0x10, 0xff, 0x02, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x09, 0xfa, 0x07, 0x00, 0x00, 0xf4,
+    0x0f, 0xff, 0x02, 0x00, 0x00, 0x70, 0xaf, 0x01, 0x00, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0x01,
+    0xe3, 0x2d, 0x00, 0x00, 0x00, 0x90, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0x7f, 0xf0, 0x0f, 0xc6, 0xee, 0x3a, 0x00, 0xb0, 0x5f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xee, 0x6c, 0xf0, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x5f,
+    0x80, 0xff, 0xff, 0xff, 0x0a, 0xb0, 0x5f, 0x00, 0x00, 0x10, 0xff, 0xf0, 0x0f, 0xc6, 0xee, 0x3b,
+    0x00, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0xa0, 0xcf, 0x01, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0xb0, 0x5f,
+    0x00, 0x00, 0x00, 0xfe, 0x03, 0xff, 0x01, 0x00, 0x00, 0xf5, 0x0b, 0xfb, 0x05, 0x00, 0x00, 0xf1,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0x10, 0xfb, 0xcf, 0x59, 0x01, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xef, 0x26, 0x01, 0x80, 0x7f, 0xf0, 0x9f, 0xff, 0xff, 0xef, 0x04, 0xb0, 0x5f,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xf9, 0x0f, 0xfb, 0xff, 0xff, 0xff, 0xff, 0x5f,
+    0x80, 0xff, 0xff, 0xff, 0x0a, 0xb0, 0x5f, 0x00, 0x00, 0x10, 0xff, 0xf0, 0x9f, 0xff, 0xff, 0xff,
+    0x03, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x10, 0xfb, 0x0a, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0xb0, 0x5f,
+    0x00, 0x00, 0x00, 0xfe, 0x03, 0xff, 0x01, 0x00, 0x00, 0xf6, 0x0b, 0xfb, 0x05, 0x00, 0x00, 0xf1,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x40, 0xb8, 0xfe, 0x6e, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x7f, 0x00, 0x00, 0xa0, 0x7f, 0xf0, 0xff, 0x28, 0x30, 0xfb, 0x1d, 0x90, 0x8f,
+    0x00, 0x00, 0x00, 0x00, 0xe1, 0xbf, 0x03, 0x92, 0xff, 0x0f, 0xfa, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0xa0, 0x7f, 0x00, 0x00, 0x30, 0xff, 0xf0, 0xff, 0x28, 0x31, 0xfc,
+    0x0b, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0xd2, 0x8f, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0xa0, 0x8f,
+    0x00, 0x00, 0x10, 0xff, 0x02, 0xff, 0x03, 0x00, 0x00, 0xf8, 0x09, 0xfa, 0x07, 0x00, 0x00, 0xf4,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfe, 0x02, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa0, 0x6f, 0x00, 0x00, 0xf3, 0x7f, 0xf0, 0xaf, 0x00, 0x00, 0xe1, 0x6f, 0x50, 0xef,
+    0x01, 0x00, 0x00, 0x00, 0xf6, 0x0d, 0x00, 0x00, 0xfa, 0x0f, 0xf5, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x60, 0xdf, 0x00, 0x00, 0xa0, 0xff, 0xf0, 0x8f, 0x00, 0x00, 0xf3,
+    0x0e, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x30, 0xfe, 0x07, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0x60, 0xef,
+    0x01, 0x00, 0x80, 0xdf, 0x00, 0xff, 0x0a, 0x00, 0x10, 0xfe, 0x06, 0xf6, 0x0d, 0x00, 0x00, 0xfa,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x05, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xdf, 0x14, 0x52, 0xfe, 0x7f, 0xf0, 0x3f, 0x00, 0x00, 0x80, 0x9f, 0x00, 0xfc,
+    0x5d, 0x01, 0x73, 0x09, 0xfa, 0x07, 0x00, 0x00, 0xf4, 0x0f, 0xc0, 0xcf, 0x25, 0x20, 0x83, 0x0b,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x10, 0xfe, 0x3b, 0x20, 0xf8, 0xff, 0xf0, 0x2f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0xe4, 0x5f, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0x10, 0xfe,
+    0x3c, 0x10, 0xf7, 0x6f, 0x00, 0xff, 0x8f, 0x02, 0xb3, 0xdf, 0x01, 0xe1, 0xbf, 0x03, 0x92, 0xff,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0xa0, 0x48, 0x02, 0x61, 0xfe, 0x04, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0xfd, 0xff, 0xff, 0xae, 0x7f, 0xf0, 0x1f, 0x00, 0x00, 0x50, 0xbf, 0x00, 0xd2,
+    0xff, 0xff, 0xff, 0x0b, 0xfb, 0x05, 0x00, 0x00, 0xf1, 0x0f, 0x20, 0xfc, 0xff, 0xff, 0xff, 0x0e,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x9f, 0xef, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0xff, 0x05, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0xe4,
+    0xff, 0xff, 0xff, 0x0a, 0x00, 0xff, 0xf9, 0xff, 0xff, 0x4e, 0x00, 0x40, 0xff, 0xff, 0xff, 0xf9,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xaf, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa2, 0xfe, 0x9d, 0x82, 0x7f, 0xf0, 0x1f, 0x00, 0x00, 0x60, 0xbf, 0x00, 0x10,
+    0xc7, 0xee, 0x8c, 0x02, 0xfb, 0x05, 0x00, 0x00, 0xf1, 0x0f, 0x00, 0x61, 0xeb, 0xdf, 0x7c, 0x02,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0x30, 0xeb, 0xce, 0x16, 0xdf, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0xf9, 0x2d, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xff,
+    0x00, 0x00, 0x30, 0xcf, 0x00, 0x00, 0x60, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x20,
+    0xd9, 0xef, 0x5b, 0x00, 0x00, 0xff, 0x70, 0xfc, 0xae, 0x03, 0x00, 0x00, 0xb3, 0xee, 0x6c, 0xf0,
+    0x0f, 0xff, 0x00, 0x00, 0x00, 0x20, 0xb7, 0xfd, 0xbd, 0x05, 0x00, 0x00, 0xfe, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x80, 0x9f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfa, 0x07, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xbf, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x90, 0xdf, 0x02, 0x00, 0x00, 0xfe, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x17, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xaf, 0x00, 0x00, 0xe1, 0x6f, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf6, 0x0d, 0x00, 0x00, 0xfa, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x8f, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0xf8, 0x2d, 0x00, 0x00, 0xfe, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x28, 0x30, 0xfb, 0x1d, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xe1, 0xbf, 0x03, 0x92, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0x94, 0x14, 0x30, 0xfa, 0x2f, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x80, 0xef, 0x03, 0x00, 0xfe, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfd, 0xff, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x9f, 0xff, 0xff, 0xef, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xf9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xff, 0xff, 0x06, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0xf7, 0x3e, 0x00, 0xfe, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xc7, 0xef, 0x3a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xee, 0x6c, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0x6f, 0x00, 0x00, 0x00, 0x60, 0xdb, 0xef, 0x4a, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xe0,
+    0x1f, 0xe0, 0x1f, 0x00, 0x00, 0xfe, 0x01, 0xff, 0x00, 0x00, 0x60, 0xef, 0x03, 0xfe, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x71, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x60, 0xdf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf0, 0x0e, 0xf2, 0x0e, 0x00, 0x00, 0x00, 0xfe, 0x03, 0xe0, 0x1f, 0x00,
+    0x50, 0xff, 0x04, 0x00, 0xf1, 0x0e, 0x00, 0xf9, 0x0b, 0x00, 0x00, 0xf9, 0x0b, 0x20, 0xef, 0x00,
+    0x00, 0x00, 0xe0, 0x2f, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0x04,
+    0xf3, 0x09, 0xf4, 0xce, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf0, 0x0e, 0xc0, 0x5f, 0x00, 0x00, 0x40, 0xcf, 0x00, 0xa0, 0x5f, 0x00,
+    0x90, 0xff, 0x08, 0x00, 0xf5, 0x0a, 0x00, 0xc0, 0x7f, 0x00, 0x60, 0xdf, 0x01, 0x00, 0xfb, 0x05,
+    0x00, 0x00, 0xf5, 0x0b, 0x00, 0xfc, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x70, 0xff, 0xff, 0x04,
+    0xf3, 0x09, 0xf4, 0xff, 0x6f, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0xbe, 0x47, 0x01, 0x72, 0x2d, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf0, 0x0e, 0x60, 0xaf, 0x00, 0x00, 0xa0, 0x6f, 0x00, 0x60, 0x8f, 0x00,
+    0xc0, 0xee, 0x0c, 0x00, 0xf8, 0x06, 0x00, 0x20, 0xfe, 0x03, 0xe2, 0x3f, 0x00, 0x00, 0xf5, 0x0b,
+    0x00, 0x00, 0xfb, 0x05, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x1d, 0x00, 0x00, 0xb0, 0x9f, 0x01, 0x00,
+    0xf3, 0x09, 0x00, 0x91, 0xbf, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf0, 0x0e, 0x10, 0xff, 0x01, 0x00, 0xf1, 0x1f, 0x00, 0x20, 0xcf, 0x00,
+    0xf1, 0xaa, 0x1f, 0x00, 0xfc, 0x02, 0x00, 0x00, 0xf5, 0x2d, 0xfc, 0x07, 0x00, 0x00, 0xd0, 0x2f,
+    0x00, 0x20, 0xef, 0x00, 0x00, 0x00, 0x00, 0x10, 0xdd, 0x02, 0x00, 0x00, 0xd0, 0x2f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x20, 0xdf, 0x00, 0x00, 0xa0, 0x5d, 0x11, 0x62, 0xd9, 0xee, 0x7c, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0xfa, 0x06, 0x00, 0xf6, 0x0a, 0x00, 0x00, 0xfd, 0x01,
+    0xf5, 0x66, 0x5f, 0x10, 0xdf, 0x00, 0x00, 0x00, 0x90, 0xef, 0xbf, 0x00, 0x00, 0x00, 0x70, 0x8f,
+    0x00, 0x80, 0x8f, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x3e, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x10, 0xdf, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf0, 0x0e, 0x00, 0xf4, 0x0c, 0x00, 0xfc, 0x04, 0x00, 0x00, 0xfa, 0x05,
+    0xf9, 0x22, 0x9f, 0x50, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x1e, 0x00, 0x00, 0x00, 0x20, 0xef,
+    0x00, 0xe0, 0x2f, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x04, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x10, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf1, 0x0e, 0x00, 0xd0, 0x3f, 0x20, 0xef, 0x00, 0x00, 0x00, 0xf6, 0x09,
+    0xdd, 0x00, 0xdd, 0x90, 0x5f, 0x00, 0x00, 0x00, 0x40, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xfa,
+    0x05, 0xf5, 0x0b, 0x00, 0x00, 0x00, 0xa0, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x10, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf2, 0x0d, 0x00, 0x00, 0xf3, 0x0e, 0x00, 0x80, 0x8f, 0x80, 0x8f, 0x00, 0x00, 0x00, 0xf2, 0x2d,
+    0x9f, 0x00, 0xf9, 0xd2, 0x1f, 0x00, 0x00, 0x00, 0xe1, 0x9f, 0xdf, 0x01, 0x00, 0x00, 0x00, 0xf4,
+    0x0b, 0xfb, 0x05, 0x00, 0x00, 0x00, 0xf8, 0x06, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x0f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x2f, 0x00, 0x00, 0xf8, 0x0e, 0x00, 0x20, 0xef, 0xd0, 0x3f, 0x00, 0x00, 0x00, 0xd0, 0x8f,
+    0x5f, 0x00, 0xf5, 0xf8, 0x0d, 0x00, 0x00, 0x00, 0xfb, 0x08, 0xf9, 0x0a, 0x00, 0x00, 0x00, 0xd0,
+    0x4f, 0xef, 0x00, 0x00, 0x00, 0x70, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfa, 0x0c, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0xfc, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0xbf, 0x13, 0x82, 0xff, 0x0e, 0x00, 0x00, 0xfc, 0xf9, 0x0c, 0x00, 0x00, 0x00, 0x90, 0xff,
+    0x1f, 0x00, 0xf1, 0xff, 0x09, 0x00, 0x00, 0x80, 0xcf, 0x00, 0xd1, 0x7f, 0x00, 0x00, 0x00, 0x70,
+    0xef, 0x8f, 0x00, 0x00, 0x00, 0xf5, 0x09, 0x00, 0x00, 0x00, 0x40, 0xff, 0xcf, 0x02, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0xc2, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0xff, 0xff, 0xff, 0xf8, 0x0e, 0x00, 0x00, 0xf6, 0xff, 0x06, 0x00, 0x00, 0x00, 0x50, 0xff,
+    0x0c, 0x00, 0xc0, 0xff, 0x05, 0x00, 0x00, 0xf4, 0x2e, 0x00, 0x30, 0xff, 0x03, 0x00, 0x00, 0x10,
+    0xfe, 0x2f, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x40, 0xff, 0xcf, 0x02, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0xc2, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb4, 0xee, 0x5c, 0xf0, 0x0e, 0x00, 0x00, 0xe1, 0xff, 0x01, 0x00, 0x00, 0x00, 0x10, 0xff,
+    0x08, 0x00, 0x80, 0xff, 0x01, 0x00, 0x10, 0xfe, 0x05, 0x00, 0x00, 0xf6, 0x1d, 0x00, 0x00, 0x00,
+    0xf9, 0x0b, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x20, 0xfb, 0x0c, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0xfc, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x0f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x10, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2,
+    0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x10, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x1f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x10, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xcf,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x2f, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x20, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x9f, 0x01, 0x00,
+    0xf3, 0x09, 0x00, 0x91, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x04,
+    0xf3, 0x09, 0xf4, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xfe, 0x04,
+    0xf3, 0x09, 0xf4, 0xce, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const FontAtlas FONT_ATLAS = {
+    256, 108, 21, 27,
+    {
+        {0, 0, 0, 0, 0, 0, 7}, // ' '
+        {1, 0, 3, 16, 3, 16, 9}, // '!'
+        {5, 0, 6, 6, 2, 16, 10}, // '"'
+        {12, 0, 16, 15, 1, 15, 18}, // '#'
+        {29, 0, 12, 20, 1, 17, 14}, // '$'
+        {42, 0, 19, 16, 1, 16, 21}, // '%'
+        {62, 0, 16, 16, 1, 16, 17}, // '&'
+        {79, 0, 2, 6, 2, 16, 6}, // '\''
+        {82, 0, 6, 20, 1, 17, 9}, // '('
+        {89, 0, 6, 20, 1, 17, 9}, // ')'
+        {96, 0, 11, 10, 0, 16, 11}, // '*'
+        {108, 0, 15, 14, 2, 14, 18}, // '+'
+        {124, 0, 4, 5, 1, 3, 7}, // ','
+        {129, 0, 6, 2, 1, 7, 8}, // '-'
+        {136, 0, 3, 3, 2, 3, 7}, // '.'
+        {140, 0, 8, 18, 0, 16, 7}, // '/'
+        {149, 0, 12, 16, 1, 16, 14}, // '0'
+        {162, 0, 10, 16, 2, 16, 14}, // '1'
+        {173, 0, 11, 16, 1, 16, 14}, // '2'
+        {185, 0, 12, 16, 1, 16, 14}, // '3'
+        {198, 0, 12, 16, 1, 16, 14}, // '4'
+        {211, 0, 12, 16, 1, 16, 14}, // '5'
+        {224, 0, 12, 16, 1, 16, 14}, // '6'
+        {237, 0, 12, 16, 1, 16, 14}, // '7'
+        {0, 21, 12, 16, 1, 16, 14}, // '8'
+        {13, 21, 12, 16, 1, 16, 14}, // '9'
+        {26, 21, 3, 11, 2, 11, 7}, // ':'
+        {30, 21, 4, 13, 1, 11, 7}, // ';'
+        {35, 21, 15, 12, 2, 13, 18}, // '<'
+        {51, 21, 15, 7, 2, 11, 18}, // '='
+        {67, 21, 15, 12, 2, 13, 18}, // '>'
+        {83, 21, 10, 16, 1, 16, 12}, // '?'
+        {94, 21, 20, 19, 1, 15, 22}, // '@'
+        {115, 21, 15, 16, 0, 16, 15}, // 'A'
+        {131, 21, 12, 16, 2, 16, 15}, // 'B'
+        {144, 21, 14, 16, 1, 16, 15}, // 'C'
+        {159, 21, 14, 16, 2, 16, 17}, // 'D'
+        {174, 21, 11, 16, 2, 16, 14}, // 'E'
+        {186, 21, 10, 16, 2, 16, 13}, // 'F'
+        {197, 21, 15, 16, 1, 16, 17}, // 'G'
+        {213, 21, 13, 16, 2, 16, 17}, // 'H'
+        {227, 21, 3, 16, 2, 16, 6}, // 'I'
+        {231, 21, 7, 20, -2, 16, 6}, // 'J'
+        {239, 21, 13, 16, 2, 16, 14}, // 'K'
+        {0, 42, 11, 16, 2, 16, 12}, // 'L'
+        {12, 42, 15, 16, 2, 16, 19}, // 'M'
+        {28, 42, 13, 16, 2, 16, 16}, // 'N'
+        {42, 42, 16, 16, 1, 16, 17}, // 'O'
+        {59, 42, 11, 16, 2, 16, 13}, // 'P'
+        {71, 42, 16, 19, 1, 16, 17}, // 'Q'
+        {88, 42, 13, 16, 2, 16, 15}, // 'R'
+        {102, 42, 12, 16, 1, 16, 14}, // 'S'
+        {115, 42, 15, 16, -1, 16, 13}, // 'T'
+        {131, 42, 14, 16, 1, 16, 16}, // 'U'
+        {146, 42, 15, 16, 0, 16, 15}, // 'V'
+        {162, 42, 22, 16, 0, 16, 22}, // 'W'
+        {185, 42, 15, 16, 0, 16, 15}, // 'X'
+        {201, 42, 15, 16, -1, 16, 13}, // 'Y'
+        {217, 42, 15, 16, 0, 16, 15}, // 'Z'
+        {233, 42, 6, 20, 1, 17, 9}, // '['
+        {240, 42, 8, 18, 0, 16, 7}, // '\\'
+        {249, 42, 5, 20, 2, 17, 9}, // ']'
+        {0, 63, 15, 6, 2, 16, 18}, // '^'
+        {16, 63, 13, 2, -1, -3, 11}, // '_'
+        {30, 63, 6, 4, 1, 18, 11}, // '`'
+        {37, 63, 11, 12, 1, 12, 13}, // 'a'
+        {49, 63, 11, 17, 2, 17, 14}, // 'b'
+        {61, 63, 10, 12, 1, 12, 12}, // 'c'
+        {72, 63, 11, 17, 1, 17, 14}, // 'd'
+        {84, 63, 12, 12, 1, 12, 14}, // 'e'
+        {97, 63, 9, 17, 0, 17, 8}, // 'f'
+        {107, 63, 11, 17, 1, 12, 14}, // 'g'
+        {119, 63, 11, 17, 2, 17, 14}, // 'h'
+        {131, 63, 3, 17, 2, 17, 6}, // 'i'
+        {135, 63, 6, 22, -1, 17, 6}, // 'j'
+        {142, 63, 11, 17, 2, 17, 13}, // 'k'
+        {154, 63, 3, 17, 2, 17, 6}, // 'l'
+        {158, 63, 18, 12, 2, 12, 21}, // 'm'
+        {177, 63, 11, 12, 2, 12, 14}, // 'n'
+        {189, 63, 12, 12, 1, 12, 13}, // 'o'
+        {202, 63, 11, 17, 2, 12, 14}, // 'p'
+        {214, 63, 11, 17, 1, 12, 14}, // 'q'
+        {226, 63, 8, 12, 2, 12, 9}, // 'r'
+        {235, 63, 10, 12, 1, 12, 11}, // 's'
+        {246, 63, 9, 15, 0, 15, 9}, // 't'
+        {0, 86, 11, 12, 1, 12, 14}, // 'u'
+        {12, 86, 13, 12, 0, 12, 13}, // 'v'
+        {26, 86, 18, 12, 0, 12, 18}, // 'w'
+        {45, 86, 13, 12, 0, 12, 13}, // 'x'
+        {59, 86, 13, 17, 0, 12, 13}, // 'y'
+        {73, 86, 11, 12, 0, 12, 12}, // 'z'
+        {85, 86, 10, 20, 2, 17, 14}, // '{'
+        {96, 86, 3, 22, 2, 17, 7}, // '|'
+        {100, 86, 10, 20, 2, 17, 14}, // '}'
+        {111, 86, 15, 5, 2, 10, 18}, // '~'
+    },
+    ALPHA,
+};
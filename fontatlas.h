@@ -0,0 +1,37 @@
+#ifndef FONTATLAS_H
+#define FONTATLAS_H
+
+// ============ FUENTE EMBEBIDA ============
+// Atlas de glifos ASCII (32 a 126) rasterizado de antemano por
+// tools/fontbake.c y compilado dentro del ejecutable como un array de C
+// (fontatlas.c, generado: no editar a mano). ui.c lo sube como una sola
+// textura, así el texto sale igual en cualquier máquina sin SDL_ttf ni
+// archivos de fuentes. Regenerar con `make font`.
+
+#define FONT_ATLAS_FIRST 32
+#define FONT_ATLAS_COUNT 95
+
+typedef struct
+{
+    unsigned short x; // Posición en el atlas
+    unsigned short y;
+    unsigned char width;
+    unsigned char height;
+    signed char left;  // Desde el origen del glifo hasta el primer pixel
+    signed char top;   // Desde la línea base hasta el borde de arriba
+    unsigned char advance;
+} FontGlyph;
+
+typedef struct
+{
+    int width; // Tamaño del atlas en pixels
+    int height;
+    int ascent; // Pixels sobre la línea base
+    int lineHeight;
+    FontGlyph glyphs[FONT_ATLAS_COUNT];
+    const unsigned char *alpha; // 4 bits de alfa por pixel, dos pixels por byte
+} FontAtlas;
+
+extern const FontAtlas FONT_ATLAS;
+
+#endif // FONTATLAS_H
@@ -0,0 +1,401 @@
+#include "game.h"
+#include <stdlib.h> // Para rand()
+#include <string.h> // Para memset()
+
+// ============ FUNCIONES DE COLISIÓN ============
+// Verifica si una pieza puede estar en una posición dada
+bool checkCollision(int grid[GRID_HEIGHT][GRID_WIDTH], int piece[4][4], int x, int y)
+{
+    for (int row = 0; row < 4; row++)
+    {
+        for (int col = 0; col < 4; col++)
+        {
+            if (piece[row][col] == 1)
+            {
+                int gridRow = y + row;
+                int gridCol = x + col;
+
+                // Verificar límites de la grilla
+                if (gridCol < 0 || gridCol >= GRID_WIDTH)
+                    return true; // Colisión con bordes laterales
+
+                if (gridRow >= GRID_HEIGHT)
+                    return true; // Colisión con el fondo
+
+                // Verificar colisión con piezas ya colocadas
+                if (gridRow >= 0 && grid[gridRow][gridCol] == 1)
+                    return true;
+            }
+        }
+    }
+    return false; // No hay colisión
+}
+
+// Fija la pieza actual en la grilla
+void lockPiece(int grid[GRID_HEIGHT][GRID_WIDTH], int piece[4][4], int x, int y)
+{
+    for (int row = 0; row < 4; row++)
+    {
+        for (int col = 0; col < 4; col++)
+        {
+            if (piece[row][col] == 1)
+            {
+                int gridRow = y + row;
+                int gridCol = x + col;
+
+                if (gridRow >= 0 && gridRow < GRID_HEIGHT &&
+                    gridCol >= 0 && gridCol < GRID_WIDTH)
+                {
+                    grid[gridRow][gridCol] = 1;
+                }
+            }
+        }
+    }
+}
+
+// Verifica si una fila está completa (todas las celdas ocupadas)
+bool isLineComplete(int grid[GRID_HEIGHT][GRID_WIDTH], int row)
+{
+    for (int col = 0; col < GRID_WIDTH; col++)
+    {
+        if (grid[row][col] == 0)
+            return false; // Hay una celda vacía
+    }
+    return true; // Todas las celdas están ocupadas
+}
+
+// Elimina una fila y hace caer las de arriba
+void clearLine(int grid[GRID_HEIGHT][GRID_WIDTH], int lineRow)
+{
+    // Mover todas las filas de arriba hacia abajo
+    for (int row = lineRow; row > 0; row--)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            grid[row][col] = grid[row - 1][col];
+        }
+    }
+    // La fila superior queda vacía
+    for (int col = 0; col < GRID_WIDTH; col++)
+    {
+        grid[0][col] = 0;
+    }
+}
+
+// Verifica y elimina todas las líneas completas
+int clearCompleteLines(int grid[GRID_HEIGHT][GRID_WIDTH])
+{
+    int linesCleared = 0;
+
+    // Revisar de abajo hacia arriba
+    for (int row = GRID_HEIGHT - 1; row >= 0; row--)
+    {
+        if (isLineComplete(grid, row))
+        {
+            clearLine(grid, row);
+            linesCleared++;
+            row++; // Volver a revisar esta fila (porque ahora tiene contenido nuevo)
+        }
+    }
+
+    return linesCleared;
+}
+
+// Genera un tipo de pieza aleatorio
+PieceType getRandomPiece()
+{
+    return (PieceType)(rand() % NUM_PIECES);
+}
+
+// Copia una pieza del array PIECES a currentPiece
+void copyPiece(int dest[4][4], const int src[4][4])
+{
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            dest[i][j] = src[i][j];
+        }
+    }
+}
+
+// Rota una pieza 90 grados en sentido horario
+// Algoritmo: transponer + invertir cada fila
+void rotatePiece(int piece[4][4])
+{
+    // Crear una copia temporal
+    int temp[4][4];
+
+    // Transponer la matriz (intercambiar filas por columnas)
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            temp[i][j] = piece[j][i];
+        }
+    }
+
+    // Invertir cada fila para completar la rotación
+    for (int i = 0; i < 4; i++)
+    {
+        for (int j = 0; j < 4; j++)
+        {
+            piece[i][j] = temp[i][4 - 1 - j];
+        }
+    }
+}
+
+// Rota una pieza con wall kicks (ajustes de posición)
+// Devuelve true si se pudo rotar, false si no
+bool rotatePieceWithKicks(int grid[GRID_HEIGHT][GRID_WIDTH],
+                          int currentPiece[4][4],
+                          int *x, int *y)
+{
+    // 1. Crear una copia y rotarla
+    int rotated[4][4];
+    copyPiece(rotated, currentPiece);
+    rotatePiece(rotated);
+
+    // 2. Probar la rotación en la posición actual (sin kick)
+    if (!checkCollision(grid, rotated, *x, *y))
+    {
+        copyPiece(currentPiece, rotated);
+        return true;
+    }
+
+    // 3. Probar diferentes kicks (ajustes de posición)
+    // Orden de prioridad: izquierda, derecha, arriba, combinaciones
+    for (int i = 0; i < NUM_WALL_KICKS; i++)
+    {
+        int newX = *x + WALL_KICKS[i][0];
+        int newY = *y + WALL_KICKS[i][1];
+
+        if (!checkCollision(grid, rotated, newX, newY))
+        {
+            copyPiece(currentPiece, rotated);
+            *x = newX;
+            *y = newY;
+            return true;
+        }
+    }
+
+    // No se pudo rotar en ninguna posición
+    return false;
+}
+
+// ============ PARTIDA HEADLESS ============
+
+// Generador xorshift32: rápido, sin estado global y reproducible por semilla
+uint32_t nextRandom(uint32_t *rngState)
+{
+    uint32_t x = *rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rngState = x;
+    return x;
+}
+
+// Saca la siguiente pieza de la cola y la pone arriba del tablero
+// Devuelve false si la nueva pieza ya colisiona (Game Over)
+static bool spawnNextPiece(GameState *state)
+{
+    state->currentType = state->nextQueue[0];
+    for (int i = 0; i < NEXT_QUEUE_SIZE - 1; i++)
+    {
+        state->nextQueue[i] = state->nextQueue[i + 1];
+    }
+    state->nextQueue[NEXT_QUEUE_SIZE - 1] = (PieceType)(nextRandom(&state->rngState) % NUM_PIECES);
+
+    copyPiece(state->currentPiece, PIECES[state->currentType]);
+    state->rotation = 0;
+    state->pieceX = SPAWN_X;
+    state->pieceY = SPAWN_Y;
+
+    return !checkCollision(state->grid, state->currentPiece, state->pieceX, state->pieceY);
+}
+
+// Inicializa una partida vacía a partir de una semilla
+void initGame(GameState *state, uint32_t seed)
+{
+    memset(state, 0, sizeof(*state));
+
+    // xorshift no admite estado 0
+    state->rngState = seed != 0 ? seed : 0x9E3779B9u;
+
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+    {
+        state->nextQueue[i] = (PieceType)(nextRandom(&state->rngState) % NUM_PIECES);
+    }
+    spawnNextPiece(state);
+}
+
+// Fija la pieza actual, elimina líneas, suma puntos y genera la siguiente
+// Devuelve la cantidad de líneas eliminadas
+static int lockCurrentPiece(GameState *state)
+{
+    lockPiece(state->grid, state->currentPiece, state->pieceX, state->pieceY);
+    state->piecesPlaced++;
+
+    state->lastClearMask = 0;
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        if (isLineComplete(state->grid, row))
+            state->lastClearMask |= 1u << row;
+    }
+
+    int linesCleared = clearCompleteLines(state->grid);
+    if (linesCleared > 0)
+    {
+        state->totalLinesCleared += linesCleared;
+        state->score += linesCleared * linesCleared * POINTS_MULTIPLIER;
+    }
+
+    if (!spawnNextPiece(state))
+    {
+        state->gameOver = true;
+    }
+
+    return linesCleared;
+}
+
+// Avanza la partida un tick con las teclas mantenidas en `inputs`
+// Misma lógica que el game loop de main.c, pero con delays en ticks
+// Devuelve las líneas eliminadas en este tick
+int stepGame(GameState *state, unsigned inputs)
+{
+    if (state->gameOver)
+        return 0;
+
+    state->tick++;
+    int linesCleared = 0;
+
+    // 1. Input (con autorepeat igual a MOVE_DELAY / ROTATE_DELAY)
+    if (state->moveCooldown > 0)
+        state->moveCooldown--;
+    if (state->rotateCooldown > 0)
+        state->rotateCooldown--;
+
+    if (!(inputs & (INPUT_LEFT | INPUT_RIGHT | INPUT_DOWN)))
+        state->moveCooldown = 0; // Soltar la tecla permite repetir enseguida
+    if (!(inputs & INPUT_ROTATE))
+        state->rotateCooldown = 0;
+
+    if (state->moveCooldown == 0 && (inputs & (INPUT_LEFT | INPUT_RIGHT | INPUT_DOWN)))
+    {
+        if ((inputs & INPUT_LEFT) &&
+            !checkCollision(state->grid, state->currentPiece, state->pieceX - 1, state->pieceY))
+        {
+            state->pieceX--;
+        }
+        if ((inputs & INPUT_RIGHT) &&
+            !checkCollision(state->grid, state->currentPiece, state->pieceX + 1, state->pieceY))
+        {
+            state->pieceX++;
+        }
+        if ((inputs & INPUT_DOWN) &&
+            !checkCollision(state->grid, state->currentPiece, state->pieceX, state->pieceY + 1))
+        {
+            state->pieceY++;
+        }
+        state->moveCooldown = MOVE_TICKS;
+    }
+
+    if (state->rotateCooldown == 0 && (inputs & INPUT_ROTATE))
+    {
+        if (rotatePieceWithKicks(state->grid, state->currentPiece, &state->pieceX, &state->pieceY))
+        {
+            state->rotation = (state->rotation + 1) % 4;
+        }
+        state->rotateCooldown = ROTATE_TICKS;
+    }
+
+    // 2. Gravedad
+    state->fallCounter++;
+    if (state->fallCounter >= GRAVITY_TICKS)
+    {
+        state->fallCounter = 0;
+
+        if (!checkCollision(state->grid, state->currentPiece, state->pieceX, state->pieceY + 1))
+        {
+            state->pieceY++;
+        }
+        else
+        {
+            linesCleared = lockCurrentPiece(state);
+        }
+    }
+
+    return linesCleared;
+}
+
+// Coloca la pieza actual directo en su lugar final, como un hard drop:
+// `rotation` rotaciones desde la forma de spawn y columna `x`. Sirve para
+// bots y herramientas que juegan de a piezas en lugar de a ticks.
+// Devuelve las líneas eliminadas, o -1 si la posición no es válida.
+int dropPiece(GameState *state, int rotation, int x)
+{
+    if (state->gameOver)
+        return -1;
+
+    int shape[4][4];
+    copyPiece(shape, PIECES[state->currentType]);
+    for (int i = 0; i < rotation % 4; i++)
+    {
+        rotatePiece(shape);
+    }
+    if (checkCollision(state->grid, shape, x, state->pieceY))
+        return -1;
+
+    copyPiece(state->currentPiece, shape);
+    state->rotation = rotation % 4;
+    state->pieceX = x;
+    while (!checkCollision(state->grid, state->currentPiece, state->pieceX, state->pieceY + 1))
+    {
+        state->pieceY++;
+    }
+    state->fallCounter = 0;
+
+    return lockCurrentPiece(state);
+}
+
+// Sube la grilla `count` filas y agrega filas de basura abajo, llenas salvo
+// la columna `holeCol`. Si hay bloques que salen por arriba, o la pieza
+// actual no entra ni subiéndola, la partida termina.
+void addGarbageLines(GameState *state, int count, int holeCol)
+{
+    if (state->gameOver || count <= 0)
+        return;
+    if (count > GRID_HEIGHT)
+        count = GRID_HEIGHT;
+
+    for (int row = 0; row < count; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            if (state->grid[row][col] == 1)
+                state->gameOver = true;
+        }
+    }
+
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            if (row < GRID_HEIGHT - count)
+                state->grid[row][col] = state->grid[row + count][col];
+            else
+                state->grid[row][col] = col == holeCol ? 0 : 1;
+        }
+    }
+
+    // La pieza que cae sube junto con la grilla si hace falta
+    for (int lift = 0; lift < count; lift++)
+    {
+        if (!checkCollision(state->grid, state->currentPiece, state->pieceX, state->pieceY))
+            return;
+        state->pieceY--;
+    }
+    if (checkCollision(state->grid, state->currentPiece, state->pieceX, state->pieceY))
+        state->gameOver = true;
+}
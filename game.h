@@ -0,0 +1,75 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "constants.h"
+
+// ============ MOTOR HEADLESS ============
+// Lógica pura del juego (sin ventana ni SDL_GetTicks).
+// El tiempo avanza en ticks fijos de 1/TARGET_FPS segundos, por lo que
+// una partida es 100% reproducible a partir de su semilla y sus inputs.
+
+#define NEXT_QUEUE_SIZE 5 // Piezas visibles en la cola de "siguientes"
+
+// Delays de main.c convertidos a ticks
+#define GRAVITY_TICKS (FALL_DELAY * TARGET_FPS / 1000) // 30 ticks = 500 ms
+#define MOVE_TICKS (MOVE_DELAY * TARGET_FPS / 1000)    // 6 ticks = 100 ms
+#define ROTATE_TICKS (ROTATE_DELAY * TARGET_FPS / 1000) // 9 ticks = 150 ms
+
+// Teclas mantenidas durante un tick (bitmask)
+typedef enum
+{
+    INPUT_LEFT = 1 << 0,
+    INPUT_RIGHT = 1 << 1,
+    INPUT_DOWN = 1 << 2,
+    INPUT_ROTATE = 1 << 3
+} InputFlags;
+
+// Estado completo de una partida
+typedef struct
+{
+    int grid[GRID_HEIGHT][GRID_WIDTH]; // 0 = vacía, 1 = ocupada
+    int currentPiece[4][4];            // Forma de la pieza actual (ya rotada)
+    PieceType currentType;
+    int rotation; // Rotaciones aplicadas a la pieza actual (0-3)
+    int pieceX;
+    int pieceY;
+    PieceType nextQueue[NEXT_QUEUE_SIZE];
+
+    int score;
+    int totalLinesCleared;
+    int piecesPlaced;
+    uint32_t lastClearMask; // Filas completas en el último lock (bit r = fila r)
+    bool gameOver;
+
+    uint32_t tick;     // Ticks simulados desde el inicio
+    uint32_t rngState; // Estado del generador de piezas (xorshift32)
+    int fallCounter;   // Ticks desde la última caída
+    int moveCooldown;  // Ticks hasta el próximo movimiento lateral/abajo
+    int rotateCooldown;
+} GameState;
+
+// Funciones de colisión y grilla
+bool checkCollision(int grid[GRID_HEIGHT][GRID_WIDTH], int piece[4][4], int x, int y);
+void lockPiece(int grid[GRID_HEIGHT][GRID_WIDTH], int piece[4][4], int x, int y);
+bool isLineComplete(int grid[GRID_HEIGHT][GRID_WIDTH], int row);
+void clearLine(int grid[GRID_HEIGHT][GRID_WIDTH], int lineRow);
+int clearCompleteLines(int grid[GRID_HEIGHT][GRID_WIDTH]);
+
+// Funciones de piezas
+PieceType getRandomPiece();
+void copyPiece(int dest[4][4], const int src[4][4]);
+void rotatePiece(int piece[4][4]);
+bool rotatePieceWithKicks(int grid[GRID_HEIGHT][GRID_WIDTH],
+                          int currentPiece[4][4],
+                          int *x, int *y);
+
+// Funciones de partida
+void initGame(GameState *state, uint32_t seed);
+int stepGame(GameState *state, unsigned inputs);
+int dropPiece(GameState *state, int rotation, int x);
+void addGarbageLines(GameState *state, int count, int holeCol);
+uint32_t nextRandom(uint32_t *rngState);
+
+#endif // GAME_H
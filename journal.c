@@ -0,0 +1,333 @@
+#include "journal.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    char username[52];
+} JournalHeader;
+
+typedef enum
+{
+    JOURNAL_SNAPSHOT = 1,
+    JOURNAL_INPUTS = 2
+} JournalRecordType;
+
+typedef struct
+{
+    uint8_t type;
+    uint8_t reserved;
+    uint16_t length; // Bytes del payload
+    uint32_t checksum;
+} JournalRecordHeader;
+
+// Estado de la partida en 80 bytes: la grilla como bits por fila y la pieza
+// como tipo + rotación (currentPiece siempre es PIECES[tipo] rotada)
+typedef struct
+{
+    uint16_t rows[GRID_HEIGHT];
+    uint32_t tick;
+    uint32_t rngState;
+    int32_t score;
+    int32_t totalLinesCleared;
+    int32_t piecesPlaced;
+    uint32_t lastClearMask;
+    int8_t pieceX;
+    int8_t pieceY;
+    uint8_t currentType;
+    uint8_t rotation;
+    uint8_t nextQueue[NEXT_QUEUE_SIZE];
+    uint8_t fallCounter;
+    uint8_t moveCooldown;
+    uint8_t rotateCooldown;
+    uint8_t gameOver;
+    uint8_t reserved[3];
+} JournalSnapshot;
+
+_Static_assert(GRID_WIDTH <= 16, "Las filas del snapshot son de 16 bits");
+_Static_assert(sizeof(JournalSnapshot) == 80, "El layout del snapshot es parte del formato");
+
+static uint32_t journalChecksum(const uint8_t *data, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+        hash = (hash ^ data[i]) * 16777619u;
+    return hash;
+}
+
+static void packSnapshot(const GameState *state, JournalSnapshot *snapshot)
+{
+    memset(snapshot, 0, sizeof(*snapshot));
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            if (state->grid[row][col] != 0)
+                snapshot->rows[row] |= (uint16_t)(1u << col);
+        }
+    }
+    snapshot->tick = state->tick;
+    snapshot->rngState = state->rngState;
+    snapshot->score = state->score;
+    snapshot->totalLinesCleared = state->totalLinesCleared;
+    snapshot->piecesPlaced = state->piecesPlaced;
+    snapshot->lastClearMask = state->lastClearMask;
+    snapshot->pieceX = (int8_t)state->pieceX;
+    snapshot->pieceY = (int8_t)state->pieceY;
+    snapshot->currentType = (uint8_t)state->currentType;
+    snapshot->rotation = (uint8_t)state->rotation;
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+        snapshot->nextQueue[i] = (uint8_t)state->nextQueue[i];
+    snapshot->fallCounter = (uint8_t)state->fallCounter;
+    snapshot->moveCooldown = (uint8_t)state->moveCooldown;
+    snapshot->rotateCooldown = (uint8_t)state->rotateCooldown;
+    snapshot->gameOver = state->gameOver ? 1 : 0;
+}
+
+static bool unpackSnapshot(const JournalSnapshot *snapshot, GameState *state)
+{
+    if (snapshot->currentType >= NUM_PIECES || snapshot->rotation > 3)
+        return false;
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+    {
+        if (snapshot->nextQueue[i] >= NUM_PIECES)
+            return false;
+    }
+
+    memset(state, 0, sizeof(*state));
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+            state->grid[row][col] = (snapshot->rows[row] >> col) & 1;
+    }
+    state->currentType = (PieceType)snapshot->currentType;
+    state->rotation = snapshot->rotation;
+    copyPiece(state->currentPiece, PIECES[state->currentType]);
+    for (int i = 0; i < state->rotation; i++)
+        rotatePiece(state->currentPiece);
+    state->pieceX = snapshot->pieceX;
+    state->pieceY = snapshot->pieceY;
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+        state->nextQueue[i] = (PieceType)snapshot->nextQueue[i];
+    state->score = snapshot->score;
+    state->totalLinesCleared = snapshot->totalLinesCleared;
+    state->piecesPlaced = snapshot->piecesPlaced;
+    state->lastClearMask = snapshot->lastClearMask;
+    state->gameOver = snapshot->gameOver != 0;
+    state->tick = snapshot->tick;
+    state->rngState = snapshot->rngState;
+    state->fallCounter = snapshot->fallCounter;
+    state->moveCooldown = snapshot->moveCooldown;
+    state->rotateCooldown = snapshot->rotateCooldown;
+    return true;
+}
+
+static bool writeRecord(FILE *file, JournalRecordType type, const void *payload, uint16_t length)
+{
+    JournalRecordHeader header = {(uint8_t)type, 0, length, journalChecksum(payload, length)};
+    return fwrite(&header, sizeof(header), 1, file) == 1 && fwrite(payload, 1, length, file) == length;
+}
+
+// ============ ESCRITURA ============
+
+static bool appendSnapshot(Journal *journal, const GameState *state)
+{
+    JournalSnapshot snapshot;
+    packSnapshot(state, &snapshot);
+    if (!writeRecord(journal->file, JOURNAL_SNAPSHOT, &snapshot, sizeof(snapshot)) || fflush(journal->file) != 0)
+    {
+        printf("Error al escribir %s, la partida deja de autoguardarse\n", journal->path);
+        fclose(journal->file);
+        journal->file = NULL;
+        return false;
+    }
+    journal->pendingCount = 0; // Ya están dentro del snapshot
+    journal->bytesWritten += sizeof(JournalRecordHeader) + sizeof(snapshot);
+    journal->snapshots++;
+    return true;
+}
+
+// El archivo nuevo se arma aparte y reemplaza al anterior con rename: si
+// se reanudó una partida, su journal sigue intacto hasta que el nuevo está
+// completo. Solo pasa al empezar la partida, no en cada tick.
+bool journalBegin(Journal *journal, const char *path, const char *username, const GameState *state)
+{
+    memset(journal, 0, sizeof(*journal));
+    snprintf(journal->path, sizeof(journal->path), "%s", path);
+    snprintf(journal->username, sizeof(journal->username), "%s", username);
+
+    char tmpPath[sizeof(journal->path) + 4];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", journal->path);
+    journal->file = fopen(tmpPath, "wb");
+    if (journal->file == NULL)
+    {
+        printf("Error al crear %s\n", tmpPath);
+        return false;
+    }
+
+    JournalHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic = JOURNAL_MAGIC;
+    header.version = JOURNAL_VERSION;
+    memcpy(header.username, journal->username, sizeof(header.username));
+    if (fwrite(&header, sizeof(header), 1, journal->file) != 1 || !appendSnapshot(journal, state))
+    {
+        printf("Error al escribir %s\n", tmpPath);
+        if (journal->file != NULL)
+            fclose(journal->file);
+        journal->file = NULL;
+        remove(tmpPath);
+        return false;
+    }
+    journal->bytesWritten += sizeof(header);
+    fclose(journal->file); // Windows no renombra archivos abiertos
+
+#ifdef _WIN32
+    remove(journal->path); // rename no reemplaza un archivo existente en Windows
+#endif
+    if (rename(tmpPath, journal->path) != 0)
+    {
+        printf("Error al reemplazar %s\n", journal->path);
+        journal->file = NULL;
+        remove(tmpPath);
+        return false;
+    }
+    journal->file = fopen(journal->path, "ab");
+    if (journal->file == NULL)
+    {
+        printf("Error al abrir %s\n", journal->path);
+        return false;
+    }
+    return true;
+}
+
+void journalFlush(Journal *journal)
+{
+    if (journal->file == NULL || journal->pendingCount == 0)
+        return;
+    if (!writeRecord(journal->file, JOURNAL_INPUTS, journal->pending, (uint16_t)journal->pendingCount) ||
+        fflush(journal->file) != 0)
+    {
+        printf("Error al escribir %s, la partida deja de autoguardarse\n", journal->path);
+        fclose(journal->file);
+        journal->file = NULL;
+    }
+    else
+        journal->bytesWritten += sizeof(JournalRecordHeader) + (uint64_t)journal->pendingCount;
+    journal->pendingCount = 0;
+}
+
+void journalRecord(Journal *journal, unsigned inputs, const GameState *state)
+{
+    if (journal->file == NULL)
+        return;
+    journal->pending[journal->pendingCount++] = (uint8_t)inputs;
+
+    if (state->tick % JOURNAL_SNAPSHOT_TICKS == 0)
+        appendSnapshot(journal, state);
+    else if (journal->pendingCount == JOURNAL_FLUSH_TICKS)
+        journalFlush(journal);
+}
+
+void journalClose(Journal *journal)
+{
+    journalFlush(journal);
+    if (journal->file != NULL)
+    {
+        fclose(journal->file);
+        journal->file = NULL;
+    }
+}
+
+bool journalHandOff(Journal *journal, const char *pendingPath)
+{
+    journalClose(journal);
+    if (journal->path[0] == '\0')
+        return false;
+#ifdef _WIN32
+    remove(pendingPath); // rename no reemplaza un archivo existente en Windows
+#endif
+    if (rename(journal->path, pendingPath) != 0)
+    {
+        printf("Error al renombrar %s\n", journal->path);
+        return false;
+    }
+    return true;
+}
+
+void journalDiscard(Journal *journal)
+{
+    if (journal->file != NULL)
+    {
+        fclose(journal->file);
+        journal->file = NULL;
+    }
+    if (journal->path[0] != '\0')
+        remove(journal->path);
+    journal->pendingCount = 0;
+}
+
+// ============ LECTURA ============
+
+// Lee el siguiente registro completo y con el checksum correcto
+static bool readRecord(FILE *file, JournalRecordHeader *record, uint8_t *payload)
+{
+    return fread(record, sizeof(*record), 1, file) == 1 && fread(payload, 1, record->length, file) == record->length &&
+           journalChecksum(payload, record->length) == record->checksum;
+}
+
+bool journalResume(const char *path, char *username, size_t usernameSize, GameState *state, int *replayedTicks)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return false;
+
+    // 1. Buscar el último snapshot válido. El primer registro cortado o con
+    //    checksum distinto marca el final de lo que llegó a escribirse.
+    JournalHeader header;
+    JournalRecordHeader record;
+    JournalSnapshot snapshot = {0};
+    uint8_t payload[65535];
+    bool found = false;
+    long replayFrom = 0;
+    if (fread(&header, sizeof(header), 1, file) == 1 && header.magic == JOURNAL_MAGIC &&
+        header.version == JOURNAL_VERSION)
+    {
+        while (readRecord(file, &record, payload))
+        {
+            if (record.type == JOURNAL_SNAPSHOT && record.length == sizeof(snapshot))
+            {
+                memcpy(&snapshot, payload, sizeof(snapshot));
+                replayFrom = ftell(file);
+                found = true;
+            }
+            else if (record.type != JOURNAL_INPUTS)
+                break;
+        }
+    }
+    if (!found || !unpackSnapshot(&snapshot, state))
+    {
+        printf("Error: %s está dañado, se descarta\n", path);
+        fclose(file);
+        return false;
+    }
+
+    // 2. Re-simular las tandas de inputs que siguen a ese snapshot
+    *replayedTicks = 0;
+    fseek(file, replayFrom, SEEK_SET);
+    while (!state->gameOver && readRecord(file, &record, payload) && record.type == JOURNAL_INPUTS)
+    {
+        for (int i = 0; i < record.length && !state->gameOver; i++)
+        {
+            stepGame(state, payload[i]);
+            (*replayedTicks)++;
+        }
+    }
+    fclose(file);
+
+    header.username[sizeof(header.username) - 1] = '\0';
+    snprintf(username, usernameSize, "%s", header.username);
+    return true;
+}
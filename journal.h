@@ -0,0 +1,71 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "game.h"
+
+// ============ AUTOGUARDADO DE LA PARTIDA EN CURSO ============
+// Si el proceso muere en medio de una partida, el puntaje no se pierde.
+// Un archivo por partida, al que solo se le agrega al final:
+//
+//   [JournalHeader: magic, versión, usuario]
+//   [snapshot] [inputs] [inputs] ... [snapshot] [inputs] ...
+//
+// Cada registro lleva tipo, largo y FNV-1a del payload. El snapshot es el
+// estado compacto de la partida (80 bytes) y se agrega cada
+// JOURNAL_SNAPSHOT_TICKS; los inputs son un byte por tick y se escriben de
+// a tandas, un fflush cada JOURNAL_FLUSH_TICKS. Sin fsync: lo que llegó al
+// kernel sobrevive a que el proceso muera (no a un corte de luz). Durante
+// la partida nunca se abre ni se renombra nada, así que un tick cuesta lo
+// mismo que un write de pocos bytes cada medio segundo.
+//
+// Al terminar, el journal se renombra a JOURNAL_PENDING_PATH hasta que el
+// puntaje llegue a la base; si el proceso muere antes, se guarda al
+// próximo arranque.
+//
+// Al arrancar, si quedó un journal de una partida sin terminar, se
+// restaura el último snapshot y se re-simulan los inputs que lo siguen con
+// stepGame (el motor es determinista): a lo sumo 10 s de partida. Un
+// registro cortado al final se ignora.
+
+#define JOURNAL_PATH "partida.journal"
+#define JOURNAL_PENDING_PATH "partida.journal.guardando" // Partida terminada, esperando a la base
+#define JOURNAL_MAGIC 0x4C4E4A54u // "TJNL"
+#define JOURNAL_VERSION 1
+#define JOURNAL_FLUSH_TICKS (TARGET_FPS / 2)     // A lo sumo medio segundo de inputs sin escribir
+#define JOURNAL_SNAPSHOT_TICKS (TARGET_FPS * 10) // Snapshot nuevo cada 10 s de partida
+
+typedef struct
+{
+    FILE *file;
+    char path[256];
+    char username[52];
+    uint8_t pending[JOURNAL_FLUSH_TICKS]; // Inputs todavía no escritos
+    int pendingCount;
+    uint64_t bytesWritten;
+    int snapshots;
+} Journal;
+
+// Empieza el journal de una partida con su estado inicial (o el reanudado)
+bool journalBegin(Journal *journal, const char *path, const char *username, const GameState *state);
+// Después de cada stepGame: las teclas de ese tick y el estado resultante
+void journalRecord(Journal *journal, unsigned inputs, const GameState *state);
+void journalFlush(Journal *journal);
+// Escribe lo pendiente y cierra, dejando el archivo para reanudar después
+void journalClose(Journal *journal);
+// La partida terminó y su puntaje se guardó: borra el archivo
+void journalDiscard(Journal *journal);
+// La partida terminó y su puntaje se está guardando en segundo plano:
+// cierra y renombra el archivo a pendingPath, así la próxima partida puede
+// empezar su journal. Quien guarda el puntaje borra pendingPath después.
+bool journalHandOff(Journal *journal, const char *pendingPath);
+
+// Reconstruye la partida sin terminar de `path`. Devuelve false si no hay
+// journal o si está dañado. Si la partida terminó pero el puntaje no llegó
+// a guardarse, el estado vuelve con gameOver para que se guarde ahora.
+bool journalResume(const char *path, char *username, size_t usernameSize, GameState *state, int *replayedTicks);
+
+#endif // JOURNAL_H
@@ -0,0 +1,90 @@
+#include "latency.h"
+#include <stdio.h>
+#include <string.h>
+
+void initLatencyRecorder(LatencyRecorder *recorder)
+{
+    memset(recorder, 0, sizeof(*recorder));
+}
+
+// Si la acción ya estaba pendiente se mide desde la primera tecla
+void latencyInput(LatencyRecorder *recorder, LatencyAction action, uint32_t timestampMs)
+{
+    PendingInput *pending = &recorder->pending[action];
+    if (pending->pending)
+    {
+        recorder->histograms[action].merged++;
+        return;
+    }
+    pending->pending = true;
+    pending->applied = false;
+    pending->timestampMs = timestampMs;
+}
+
+void latencyApplied(LatencyRecorder *recorder, LatencyAction action)
+{
+    if (recorder->pending[action].pending)
+        recorder->pending[action].applied = true;
+}
+
+void latencyPresented(LatencyRecorder *recorder, uint32_t nowMs)
+{
+    for (int action = 0; action < NUM_LATENCY_ACTIONS; action++)
+    {
+        PendingInput *pending = &recorder->pending[action];
+        LatencyHistogram *histogram = &recorder->histograms[action];
+        if (!pending->pending)
+            continue;
+
+        uint32_t elapsed = nowMs - pending->timestampMs;
+        if (pending->applied)
+        {
+            histogram->buckets[elapsed < LATENCY_BUCKETS ? elapsed : LATENCY_BUCKETS - 1]++;
+            histogram->count++;
+            if (elapsed > histogram->maxMs)
+                histogram->maxMs = elapsed;
+            pending->pending = false;
+        }
+        else if (elapsed > LATENCY_TIMEOUT_MS)
+        {
+            histogram->ignored++;
+            pending->pending = false;
+        }
+    }
+}
+
+// Límite superior del bucket donde cae el percentil
+uint32_t latencyPercentile(const LatencyHistogram *histogram, int percent)
+{
+    if (histogram->count == 0)
+        return 0;
+
+    uint64_t wanted = ((uint64_t)histogram->count * (uint64_t)percent + 99) / 100;
+    uint64_t seen = 0;
+    for (uint32_t ms = 0; ms < LATENCY_BUCKETS; ms++)
+    {
+        seen += histogram->buckets[ms];
+        if (seen >= wanted)
+            return ms;
+    }
+    return LATENCY_BUCKETS - 1;
+}
+
+const char *getLatencyActionName(LatencyAction action)
+{
+    static const char *NAMES[NUM_LATENCY_ACTIONS] = {"mover", "rotar", "bajar"};
+    return NAMES[action];
+}
+
+void printLatencyReport(const LatencyRecorder *recorder)
+{
+    printf("\n=== LATENCIA INPUT -> PANTALLA (ms) ===\n");
+    printf("%-6s %7s %5s %5s %5s %5s %9s\n", "accion", "teclas", "p50", "p95", "p99", "max", "sin efecto");
+    for (int action = 0; action < NUM_LATENCY_ACTIONS; action++)
+    {
+        const LatencyHistogram *histogram = &recorder->histograms[action];
+        printf("%-6s %7u %5u %5u %5u %5u %9u\n", getLatencyActionName((LatencyAction)action), histogram->count,
+               latencyPercentile(histogram, 50), latencyPercentile(histogram, 95),
+               latencyPercentile(histogram, 99), histogram->maxMs, histogram->ignored);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// ============ LATENCIA INPUT -> PANTALLA ============
+// Cada tecla se anota con el timestamp de su evento (event.key.timestamp,
+// en ms de SDL_GetTicks). Cuando la simulación aplica el cambio que pidió
+// (la pieza se movió, rotó o bajó) queda marcada, y el primer
+// SDL_RenderPresent que la incluye cierra la medición en el histograma
+// de su acción. Los tiempos van en ms y no dependen de SDL.
+
+typedef enum
+{
+    LATENCY_MOVE = 0, // Izquierda / derecha
+    LATENCY_ROTATE,
+    LATENCY_DROP, // Abajo (soft drop)
+    NUM_LATENCY_ACTIONS
+} LatencyAction;
+
+#define LATENCY_BUCKETS 250    // 1 ms por bucket; el último junta todo lo mayor
+#define LATENCY_TIMEOUT_MS 500 // Teclas sin efecto (contra una pared) se descartan
+
+typedef struct
+{
+    uint32_t buckets[LATENCY_BUCKETS];
+    uint32_t count;
+    uint32_t maxMs;
+    uint32_t ignored; // Sin efecto antes de LATENCY_TIMEOUT_MS
+    uint32_t merged;  // Repetidas mientras la anterior seguía pendiente
+} LatencyHistogram;
+
+typedef struct
+{
+    bool pending;
+    bool applied; // La simulación ya la aplicó; falta que se vea
+    uint32_t timestampMs;
+} PendingInput;
+
+typedef struct
+{
+    LatencyHistogram histograms[NUM_LATENCY_ACTIONS];
+    PendingInput pending[NUM_LATENCY_ACTIONS];
+} LatencyRecorder;
+
+void initLatencyRecorder(LatencyRecorder *recorder);
+void latencyInput(LatencyRecorder *recorder, LatencyAction action, uint32_t timestampMs);
+void latencyApplied(LatencyRecorder *recorder, LatencyAction action);
+void latencyPresented(LatencyRecorder *recorder, uint32_t nowMs); // Justo después de SDL_RenderPresent
+
+uint32_t latencyPercentile(const LatencyHistogram *histogram, int percent);
+const char *getLatencyActionName(LatencyAction action);
+void printLatencyReport(const LatencyRecorder *recorder);
+
+#endif // LATENCY_H
@@ -0,0 +1,114 @@
+#include "latencyview.h"
+#include <stdio.h>
+#include <string.h>
+#include "ui.h"
+
+#define INJECT_INTERVAL_MS 120 // Una tecla cada 120 ms (~8 por segundo)
+#define INJECT_HOLD_MS 30      // Cuánto queda apretada
+#define INJECT_TAIL_MS 600     // Espera al final para cerrar las mediciones
+
+static const SDL_Keycode INJECT_KEYS[] = {SDLK_LEFT, SDLK_RIGHT, SDLK_UP, SDLK_DOWN};
+
+static LatencyAction inputToAction(unsigned input)
+{
+    if (input == INPUT_ROTATE)
+        return LATENCY_ROTATE;
+    if (input == INPUT_DOWN)
+        return LATENCY_DROP;
+    return LATENCY_MOVE;
+}
+
+static void pushKey(Uint32 type, SDL_Keycode key)
+{
+    SDL_Event event = {0};
+    event.type = type;
+    event.key.state = type == SDL_KEYDOWN ? SDL_PRESSED : SDL_RELEASED;
+    event.key.keysym.sym = key;
+    event.key.keysym.scancode = SDL_GetScancodeFromKey(key);
+    SDL_PushEvent(&event); // Le pone el timestamp de SDL_GetTicks()
+}
+
+void initLatencyRun(LatencyRun *run, const LatencyConfig *config)
+{
+    memset(run, 0, sizeof(*run));
+    run->config = *config;
+    run->rng = config->seed != 0 ? config->seed : 1;
+    run->nextInjectMs = SDL_GetTicks() + INJECT_INTERVAL_MS;
+    initLatencyRecorder(&run->recorder);
+    printf("Modo latencia (semilla %u)%s\n", config->seed, config->injectCount > 0 ? ", inyectando teclas" : "");
+}
+
+bool latencyInject(LatencyRun *run, Uint32 nowMs)
+{
+    if (run->config.injectCount <= 0)
+        return true;
+
+    // Una flecha al azar cada INJECT_INTERVAL_MS
+    if (run->releaseKey != 0 && nowMs >= run->releaseAtMs)
+    {
+        pushKey(SDL_KEYUP, run->releaseKey);
+        run->releaseKey = 0;
+    }
+    if (run->injected < run->config.injectCount && run->releaseKey == 0 && nowMs >= run->nextInjectMs)
+    {
+        run->releaseKey = INJECT_KEYS[nextRandom(&run->rng) % 4];
+        pushKey(SDL_KEYDOWN, run->releaseKey);
+        run->releaseAtMs = nowMs + INJECT_HOLD_MS;
+        run->nextInjectMs = nowMs + INJECT_INTERVAL_MS;
+        run->injected++;
+    }
+    return run->injected < run->config.injectCount || run->releaseKey != 0 ||
+           nowMs < run->nextInjectMs + INJECT_TAIL_MS;
+}
+
+void latencyKeyDown(LatencyRun *run, unsigned input, Uint32 timestampMs)
+{
+    if (input != 0)
+        latencyInput(&run->recorder, inputToAction(input), timestampMs);
+}
+
+void latencyTick(LatencyRun *run, const GameState *before, const GameState *after, unsigned inputs)
+{
+    if (after->pieceX != before->pieceX)
+        latencyApplied(&run->recorder, LATENCY_MOVE);
+    if (after->rotation != before->rotation)
+        latencyApplied(&run->recorder, LATENCY_ROTATE);
+    if ((inputs & INPUT_DOWN) && (after->pieceY != before->pieceY || after->piecesPlaced != before->piecesPlaced))
+        latencyApplied(&run->recorder, LATENCY_DROP);
+}
+
+void renderLatencyOverlay(SDL_Renderer *renderer, const LatencyRun *run)
+{
+    SDL_Color white = {255, 255, 255, 255};
+    char text[120];
+    for (int action = 0; action < NUM_LATENCY_ACTIONS; action++)
+    {
+        const LatencyHistogram *histogram = &run->recorder.histograms[action];
+        snprintf(text, sizeof(text), "%s: %u teclas  p50 %u ms  p99 %u ms", getLatencyActionName((LatencyAction)action),
+                 histogram->count, latencyPercentile(histogram, 50), latencyPercentile(histogram, 99));
+        renderText(renderer, text, 10, 10 + action * 22, white);
+    }
+    if (run->config.injectCount > 0)
+    {
+        snprintf(text, sizeof(text), "Inyectadas: %d/%d", run->injected, run->config.injectCount);
+        renderText(renderer, text, 10, WINDOW_HEIGHT - 40, white);
+    }
+}
+
+bool finishLatencyRun(const LatencyRun *run)
+{
+    printLatencyReport(&run->recorder);
+
+    bool passed = true;
+    for (int action = 0; action < NUM_LATENCY_ACTIONS && run->config.maxP99Ms > 0; action++)
+    {
+        uint32_t p99 = latencyPercentile(&run->recorder.histograms[action], 99);
+        if (p99 > (uint32_t)run->config.maxP99Ms)
+        {
+            printf("FALLA: p99 de %s = %u ms (límite %d ms)\n", getLatencyActionName((LatencyAction)action), p99,
+                   run->config.maxP99Ms);
+            passed = false;
+        }
+    }
+    return passed;
+}
@@ -0,0 +1,48 @@
+#ifndef LATENCYVIEW_H
+#define LATENCYVIEW_H
+
+#include <SDL.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "game.h"
+#include "latency.h"
+
+// Modo de medición de latencia (ver latency.h) sobre el loop real del
+// juego: runScreens anota cada tecla en el handler de la partida, marca la
+// muestra en tickGame cuando stepGame la aplica y la cierra después del
+// SDL_RenderPresent. Con injectCount > 0 no hace falta jugar: un inyector
+// empuja eventos de teclado sintéticos con SDL_PushEvent a la misma cola
+// que lee el loop y al terminar se imprimen los histogramas, así corre en
+// CI con SDL_VIDEODRIVER=dummy.
+typedef struct
+{
+    uint32_t seed;
+    int injectCount; // Teclas a inyectar (0 = juega una persona)
+    int maxP99Ms;    // 0 = sin límite
+} LatencyConfig;
+
+typedef struct
+{
+    LatencyConfig config;
+    LatencyRecorder recorder;
+    uint32_t rng;
+    int injected;
+    Uint32 nextInjectMs;
+    Uint32 releaseAtMs;
+    SDL_Keycode releaseKey; // Tecla inyectada que todavía está apretada
+} LatencyRun;
+
+void initLatencyRun(LatencyRun *run, const LatencyConfig *config);
+// Una vez por frame: empuja la próxima tecla si toca. false cuando ya
+// inyectó todas y esperó a que se cierren las últimas mediciones.
+bool latencyInject(LatencyRun *run, Uint32 nowMs);
+
+// Hooks del loop: tecla apretada (no repetida) y un tick de stepGame
+void latencyKeyDown(LatencyRun *run, unsigned input, Uint32 timestampMs);
+void latencyTick(LatencyRun *run, const GameState *before, const GameState *after, unsigned inputs);
+
+void renderLatencyOverlay(SDL_Renderer *renderer, const LatencyRun *run);
+// Imprime los histogramas. false si alguna acción superó maxP99Ms
+bool finishLatencyRun(const LatencyRun *run);
+
+#endif // LATENCYVIEW_H
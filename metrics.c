@@ -0,0 +1,449 @@
+#include "metrics.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#define RENDER_BUFFER_SIZE 16384
+#define POLL_INTERVAL_MS 200 // Cada cuánto miran los exportadores si hay que parar
+
+// ============ SHARDS ============
+// Un solo hilo escribe cada shard: load + store relajados (un add normal
+// en x86/ARM) en vez de un fetch_add con lock. Los lectores pueden ver un
+// valor apenas atrasado, nunca uno roto.
+
+typedef struct
+{
+    _Alignas(64) _Atomic uint64_t counters[NUM_METRIC_COUNTERS];
+    _Atomic uint64_t buckets[NUM_METRIC_HISTOGRAMS][METRIC_MAX_BUCKETS + 1];
+    _Atomic uint64_t sums[NUM_METRIC_HISTOGRAMS];
+} MetricsShard;
+
+static MetricsShard shards[METRIC_MAX_SHARDS];
+static MetricsShard overflowShard; // Compartido (con fetch_add) si se acaban los shards
+static _Atomic int shardCount;
+static int freeShards[METRIC_MAX_SHARDS];
+static int freeCount;
+static pthread_mutex_t shardMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t shardKey;
+static pthread_once_t keyOnce = PTHREAD_ONCE_INIT;
+
+static _Thread_local MetricsShard *localShard;
+static _Thread_local bool localShared;
+
+typedef struct
+{
+    const char *name;
+    const char *help;
+    uint64_t bounds[METRIC_MAX_BUCKETS]; // Límite superior de cada bucket en ns
+} HistogramInfo;
+
+#define MS 1000000ULL
+#define US 1000ULL
+
+static const HistogramInfo HISTOGRAMS[NUM_METRIC_HISTOGRAMS] = {
+    {"tetris_frame_seconds", "Duración de cada frame del juego",
+     {1 * MS, 2 * MS, 4 * MS, 8 * MS, 12 * MS, 16 * MS, 17 * MS, 20 * MS, 25 * MS, 33 * MS, 50 * MS, 100 * MS}},
+    {"tetris_db_save_score_seconds", "Latencia de saveScore",
+     {50 * US, 100 * US, 250 * US, 500 * US, 1 * MS, 2500 * US, 5 * MS, 10 * MS, 25 * MS, 50 * MS, 100 * MS,
+      250 * MS}},
+    {"tetris_db_top_scores_seconds", "Latencia de getTopScores",
+     {50 * US, 100 * US, 250 * US, 500 * US, 1 * MS, 2500 * US, 5 * MS, 10 * MS, 25 * MS, 50 * MS, 100 * MS,
+      250 * MS}},
+    {"tetris_db_init_seconds", "Apertura y migración de tetris.db",
+     {1 * MS, 2500 * US, 5 * MS, 10 * MS, 25 * MS, 50 * MS, 100 * MS, 250 * MS, 500 * MS, 1000 * MS, 2500 * MS,
+      5000 * MS}},
+    {"tetris_startup_first_frame_seconds", "Desde que arranca el juego hasta el primer frame",
+     {10 * MS, 25 * MS, 50 * MS, 100 * MS, 150 * MS, 200 * MS, 300 * MS, 500 * MS, 750 * MS, 1000 * MS, 2000 * MS,
+      5000 * MS}},
+};
+
+static void releaseShard(void *arg)
+{
+    // Los valores quedan en el shard: el próximo dueño sigue sumando encima
+    pthread_mutex_lock(&shardMutex);
+    freeShards[freeCount++] = (int)((MetricsShard *)arg - shards);
+    pthread_mutex_unlock(&shardMutex);
+}
+
+static void createShardKey(void)
+{
+    pthread_key_create(&shardKey, releaseShard);
+}
+
+static MetricsShard *acquireShard(void)
+{
+    pthread_once(&keyOnce, createShardKey);
+
+    int index = -1;
+    pthread_mutex_lock(&shardMutex);
+    if (freeCount > 0)
+        index = freeShards[--freeCount];
+    else if (atomic_load_explicit(&shardCount, memory_order_relaxed) < METRIC_MAX_SHARDS)
+        index = atomic_fetch_add_explicit(&shardCount, 1, memory_order_release);
+    pthread_mutex_unlock(&shardMutex);
+
+    if (index < 0)
+    {
+        localShared = true;
+        localShard = &overflowShard;
+    }
+    else
+    {
+        localShard = &shards[index];
+        pthread_setspecific(shardKey, localShard);
+    }
+    return localShard;
+}
+
+static inline void bump(_Atomic uint64_t *value, uint64_t amount)
+{
+    if (localShared)
+        atomic_fetch_add_explicit(value, amount, memory_order_relaxed);
+    else
+        atomic_store_explicit(value, atomic_load_explicit(value, memory_order_relaxed) + amount,
+                              memory_order_relaxed);
+}
+
+void metricsAdd(MetricCounter counter, uint64_t amount)
+{
+    MetricsShard *shard = localShard != NULL ? localShard : acquireShard();
+    bump(&shard->counters[counter], amount);
+}
+
+void metricsLinesCleared(int lines)
+{
+    if (lines >= 1 && lines <= 4)
+        metricsAdd((MetricCounter)(METRIC_LINES_1 + lines - 1), 1);
+}
+
+void metricsObserve(MetricHistogram histogram, uint64_t ns)
+{
+    MetricsShard *shard = localShard != NULL ? localShard : acquireShard();
+    const uint64_t *bounds = HISTOGRAMS[histogram].bounds;
+    int bucket = 0;
+    while (bucket < METRIC_MAX_BUCKETS && ns > bounds[bucket])
+        bucket++;
+    bump(&shard->buckets[histogram][bucket], 1);
+    bump(&shard->sums[histogram], ns);
+}
+
+uint64_t metricsNowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t startupNs;
+
+void metricsStartupBegin(void)
+{
+    startupNs = metricsNowNs();
+}
+
+void metricsFirstFrame(void)
+{
+    static bool recorded = false;
+    if (recorded || startupNs == 0)
+        return;
+    recorded = true;
+    uint64_t elapsed = metricsNowNs() - startupNs;
+    metricsObserve(METRIC_FIRST_FRAME_TIME, elapsed);
+    printf("Primer frame a los %.1f ms del arranque\n", (double)elapsed / 1e6);
+}
+
+// ============ LECTURA ============
+
+static uint64_t sumShards(size_t offset)
+{
+    int count = atomic_load_explicit(&shardCount, memory_order_acquire);
+    uint64_t total = atomic_load_explicit((_Atomic uint64_t *)((char *)&overflowShard + offset), memory_order_relaxed);
+    for (int i = 0; i < count; i++)
+    {
+        total += atomic_load_explicit((_Atomic uint64_t *)((char *)&shards[i] + offset), memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t metricsCounterValue(MetricCounter counter)
+{
+    return sumShards(offsetof(MetricsShard, counters) + (size_t)counter * sizeof(uint64_t));
+}
+
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t length;
+} TextBuffer;
+
+static void appendf(TextBuffer *buffer, const char *format, ...)
+{
+    if (buffer->length >= buffer->size)
+        return;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(buffer->data + buffer->length, buffer->size - buffer->length, format, args);
+    va_end(args);
+    if (n > 0)
+        buffer->length = buffer->length + (size_t)n < buffer->size ? buffer->length + (size_t)n : buffer->size - 1;
+}
+
+static void appendCounter(TextBuffer *buffer, const char *name, const char *help, MetricCounter counter)
+{
+    appendf(buffer, "# HELP %s %s\n# TYPE %s counter\n%s %llu\n", name, help, name, name,
+            (unsigned long long)metricsCounterValue(counter));
+}
+
+size_t metricsRender(char *data, size_t size)
+{
+    TextBuffer buffer = {data, size, 0};
+    if (size == 0)
+        return 0;
+    data[0] = '\0';
+
+    appendCounter(&buffer, "tetris_games_started_total", "Partidas empezadas", METRIC_GAMES_STARTED);
+    appendCounter(&buffer, "tetris_games_finished_total", "Partidas terminadas", METRIC_GAMES_FINISHED);
+    appendCounter(&buffer, "tetris_pieces_placed_total", "Piezas fijadas (rate() = piezas por segundo)",
+                  METRIC_PIECES_PLACED);
+    appendCounter(&buffer, "tetris_frames_total", "Frames dibujados", METRIC_FRAMES);
+
+    appendf(&buffer, "# HELP tetris_line_clears_total Jugadas que eliminan líneas, por cantidad\n"
+                     "# TYPE tetris_line_clears_total counter\n");
+    for (int lines = 1; lines <= 4; lines++)
+    {
+        appendf(&buffer, "tetris_line_clears_total{lines=\"%d\"} %llu\n", lines,
+                (unsigned long long)metricsCounterValue((MetricCounter)(METRIC_LINES_1 + lines - 1)));
+    }
+
+    for (int h = 0; h < NUM_METRIC_HISTOGRAMS; h++)
+    {
+        const HistogramInfo *info = &HISTOGRAMS[h];
+        appendf(&buffer, "# HELP %s %s\n# TYPE %s histogram\n", info->name, info->help, info->name);
+
+        uint64_t cumulative = 0;
+        for (int b = 0; b <= METRIC_MAX_BUCKETS; b++)
+        {
+            cumulative += sumShards(offsetof(MetricsShard, buckets) +
+                                    ((size_t)h * (METRIC_MAX_BUCKETS + 1) + (size_t)b) * sizeof(uint64_t));
+            if (b < METRIC_MAX_BUCKETS)
+                appendf(&buffer, "%s_bucket{le=\"%g\"} %llu\n", info->name, (double)info->bounds[b] / 1e9,
+                        (unsigned long long)cumulative);
+            else
+                appendf(&buffer, "%s_bucket{le=\"+Inf\"} %llu\n", info->name, (unsigned long long)cumulative);
+        }
+        uint64_t sum = sumShards(offsetof(MetricsShard, sums) + (size_t)h * sizeof(uint64_t));
+        appendf(&buffer, "%s_sum %.9f\n%s_count %llu\n", info->name, (double)sum / 1e9, info->name,
+                (unsigned long long)cumulative);
+    }
+    return buffer.length;
+}
+
+// ============ EXPORTADORES ============
+
+static _Atomic bool stopping;
+static pthread_t serverThread;
+static pthread_t writerThread;
+static bool serverRunning;
+static bool writerRunning;
+static int listenFd = -1;
+static char *writerPath;
+static int writerInterval;
+
+// Un cliente que corta a mitad de la respuesta no tiene que matar al juego
+// con SIGPIPE: Linux lo evita por send, macOS por socket (SO_NOSIGPIPE)
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL
+#else
+#define SEND_FLAGS 0
+#endif
+
+static void sendAll(int fd, const char *data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t sent = send(fd, data, length, SEND_FLAGS);
+        if (sent <= 0)
+            return;
+        data += sent;
+        length -= (size_t)sent;
+    }
+}
+
+static void serveClient(int fd, char *body)
+{
+    // Un solo read alcanza para la línea del pedido
+    struct timeval timeout = {1, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    char request[1024];
+    ssize_t received = recv(fd, request, sizeof(request) - 1, 0);
+    if (received <= 0)
+        return;
+    request[received] = '\0';
+
+    char header[160];
+    if (strncmp(request, "GET /metrics", 12) == 0 || strncmp(request, "GET / ", 6) == 0)
+    {
+        size_t length = metricsRender(body, RENDER_BUFFER_SIZE);
+        int n = snprintf(header, sizeof(header),
+                         "HTTP/1.1 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\n"
+                         "Content-Length: %zu\r\nConnection: close\r\n\r\n",
+                         length);
+        sendAll(fd, header, (size_t)n);
+        sendAll(fd, body, length);
+    }
+    else
+    {
+        const char *notFound = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        sendAll(fd, notFound, strlen(notFound));
+    }
+}
+
+static void *serverLoop(void *arg)
+{
+    (void)arg;
+    char *body = malloc(RENDER_BUFFER_SIZE);
+    struct pollfd pfd = {listenFd, POLLIN, 0};
+
+    while (body != NULL && !atomic_load_explicit(&stopping, memory_order_acquire))
+    {
+        if (poll(&pfd, 1, POLL_INTERVAL_MS) <= 0)
+            continue;
+        int fd = accept(listenFd, NULL, NULL);
+        if (fd < 0)
+            continue;
+#ifndef MSG_NOSIGNAL
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+        serveClient(fd, body);
+        close(fd);
+    }
+    free(body);
+    return NULL;
+}
+
+bool metricsStartServer(int port)
+{
+    if (port <= 0 || serverRunning)
+        return false;
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0)
+    {
+        printf("Error al crear socket de métricas: %s\n", strerror(errno));
+        return false;
+    }
+    int one = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(listenFd, 16) != 0)
+    {
+        printf("Error al escuchar métricas en el puerto %d: %s\n", port, strerror(errno));
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    atomic_store(&stopping, false);
+    if (pthread_create(&serverThread, NULL, serverLoop, NULL) != 0)
+    {
+        printf("Error al crear el hilo de métricas\n");
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    serverRunning = true;
+    printf("Métricas en http://127.0.0.1:%d/metrics\n", port);
+    return true;
+}
+
+// Escribe a un temporal y lo renombra: quien lee nunca ve un archivo a medias
+static void writeMetricsFile(char *body)
+{
+    char tmpPath[512];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", writerPath);
+    FILE *file = fopen(tmpPath, "w");
+    if (file == NULL)
+        return;
+    size_t length = metricsRender(body, RENDER_BUFFER_SIZE);
+    bool ok = fwrite(body, 1, length, file) == length;
+    ok = fclose(file) == 0 && ok;
+    if (ok)
+        rename(tmpPath, writerPath);
+}
+
+static void *writerLoop(void *arg)
+{
+    (void)arg;
+    char *body = malloc(RENDER_BUFFER_SIZE);
+    struct timespec pause = {0, POLL_INTERVAL_MS * 1000000L};
+    int waitedMs = 0;
+
+    while (body != NULL && !atomic_load_explicit(&stopping, memory_order_acquire))
+    {
+        nanosleep(&pause, NULL);
+        waitedMs += POLL_INTERVAL_MS;
+        if (waitedMs >= writerInterval * 1000)
+        {
+            writeMetricsFile(body);
+            waitedMs = 0;
+        }
+    }
+    if (body != NULL)
+        writeMetricsFile(body); // Último estado al cerrar
+    free(body);
+    return NULL;
+}
+
+bool metricsStartFileWriter(const char *path, int intervalSeconds)
+{
+    if (path == NULL || writerRunning)
+        return false;
+
+    writerPath = strdup(path);
+    writerInterval = intervalSeconds > 0 ? intervalSeconds : 1;
+    atomic_store(&stopping, false);
+    if (writerPath == NULL || pthread_create(&writerThread, NULL, writerLoop, NULL) != 0)
+    {
+        printf("Error al crear el hilo de métricas\n");
+        free(writerPath);
+        writerPath = NULL;
+        return false;
+    }
+    writerRunning = true;
+    return true;
+}
+
+void metricsStop(void)
+{
+    atomic_store_explicit(&stopping, true, memory_order_release);
+    if (serverRunning)
+    {
+        pthread_join(serverThread, NULL);
+        close(listenFd);
+        listenFd = -1;
+        serverRunning = false;
+    }
+    if (writerRunning)
+    {
+        pthread_join(writerThread, NULL);
+        free(writerPath);
+        writerPath = NULL;
+        writerRunning = false;
+    }
+}
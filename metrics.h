@@ -0,0 +1,66 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============ MÉTRICAS (CONTADORES E HISTOGRAMAS) ============
+// Cada hilo escribe en su propio shard (una línea de caché por contador
+// de hilo, sin atomics de lectura-modificación-escritura) y quien exporta
+// suma todos los shards. Así registrar cuesta un par de instrucciones aun
+// con todos los workers de la batalla contando a millones por segundo.
+//
+// Los histogramas tienen buckets fijos en nanosegundos y se exportan en
+// segundos. La exportación es texto de Prometheus, por HTTP en
+// 127.0.0.1 (GET /metrics) y/o a un archivo cada tantos segundos.
+
+typedef enum
+{
+    METRIC_GAMES_STARTED = 0,
+    METRIC_GAMES_FINISHED,
+    METRIC_PIECES_PLACED,
+    METRIC_LINES_1, // Jugadas que eliminan 1, 2, 3 y 4 líneas
+    METRIC_LINES_2,
+    METRIC_LINES_3,
+    METRIC_LINES_4,
+    METRIC_FRAMES,
+    NUM_METRIC_COUNTERS
+} MetricCounter;
+
+typedef enum
+{
+    METRIC_FRAME_TIME = 0,
+    METRIC_SAVE_SCORE_TIME,
+    METRIC_TOP_SCORES_TIME,
+    METRIC_DB_INIT_TIME,     // Abrir y migrar tetris.db (en segundo plano)
+    METRIC_FIRST_FRAME_TIME, // Desde que arranca main hasta el primer frame
+    NUM_METRIC_HISTOGRAMS
+} MetricHistogram;
+
+#define METRIC_MAX_BUCKETS 12 // Sin contar +Inf
+#define METRIC_MAX_SHARDS 256 // Hilos vivos a la vez; los shards se reciclan al terminar un hilo
+
+void metricsAdd(MetricCounter counter, uint64_t amount);
+void metricsObserve(MetricHistogram histogram, uint64_t ns);
+
+// Suma METRIC_LINES_n según `lines` (0 no cuenta)
+void metricsLinesCleared(int lines);
+
+uint64_t metricsNowNs(void);
+
+// Tiempo hasta el primer frame: metricsStartupBegin al entrar a main y
+// metricsFirstFrame después de cada SDL_RenderPresent (solo cuenta el primero)
+void metricsStartupBegin(void);
+void metricsFirstFrame(void);
+uint64_t metricsCounterValue(MetricCounter counter);
+
+// Texto de Prometheus de todas las métricas; devuelve la longitud
+size_t metricsRender(char *buffer, size_t size);
+
+// Exportadores (cada uno en su hilo). port 0 = sin HTTP.
+bool metricsStartServer(int port);
+bool metricsStartFileWriter(const char *path, int intervalSeconds);
+void metricsStop(void);
+
+#endif // METRICS_H
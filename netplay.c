@@ -0,0 +1,173 @@
+#include "netplay.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "protocol.h"
+
+// Paquete: magic, primer frame, cantidad, ack, inputs[cantidad]
+#define NET_HEADER_SIZE 13
+
+uint64_t netNowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+bool openNetPeer(NetPeer *peer, int localPort, const char *remoteHost, int remotePort)
+{
+    memset(peer, 0, sizeof(*peer));
+
+    peer->fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (peer->fd < 0)
+    {
+        printf("Error al crear socket UDP: %s\n", strerror(errno));
+        return false;
+    }
+    fcntl(peer->fd, F_SETFL, fcntl(peer->fd, F_GETFL) | O_NONBLOCK);
+
+    struct sockaddr_in local = {0};
+    local.sin_family = AF_INET;
+    local.sin_port = htons((uint16_t)localPort);
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(peer->fd, (struct sockaddr *)&local, sizeof(local)) != 0)
+    {
+        printf("Error al usar el puerto UDP %d: %s\n", localPort, strerror(errno));
+        close(peer->fd);
+        return false;
+    }
+
+    struct addrinfo hints = {0};
+    struct addrinfo *result = NULL;
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    if (getaddrinfo(remoteHost, NULL, &hints, &result) != 0 || result == NULL)
+    {
+        printf("Error: no se pudo resolver %s\n", remoteHost);
+        close(peer->fd);
+        return false;
+    }
+    memcpy(&peer->remote, result->ai_addr, sizeof(peer->remote));
+    peer->remote.sin_port = htons((uint16_t)remotePort);
+    freeaddrinfo(result);
+
+    return true;
+}
+
+void closeNetPeer(NetPeer *peer)
+{
+    if (peer->fd >= 0)
+    {
+        close(peer->fd);
+        peer->fd = -1;
+    }
+}
+
+void setNetSim(NetPeer *peer, int delayMs, int jitterMs, int lossPercent, uint32_t seed)
+{
+    peer->simEnabled = delayMs > 0 || jitterMs > 0 || lossPercent > 0;
+    peer->sim.delayMs = delayMs;
+    peer->sim.jitterMs = jitterMs;
+    peer->sim.lossPercent = lossPercent;
+    peer->sim.rng = seed != 0 ? seed : 1;
+}
+
+static void sendRaw(NetPeer *peer, const uint8_t *data, int size)
+{
+    sendto(peer->fd, data, (size_t)size, 0, (struct sockaddr *)&peer->remote, sizeof(peer->remote));
+}
+
+// Con el simulador activo los paquetes esperan en una cola hasta su hora
+static void sendPacket(NetPeer *peer, const uint8_t *data, int size, uint64_t nowMs)
+{
+    if (!peer->simEnabled)
+    {
+        sendRaw(peer, data, size);
+        return;
+    }
+
+    NetSim *sim = &peer->sim;
+    sim->sent++;
+    if ((int)(nextRandom(&sim->rng) % 100) < sim->lossPercent || sim->count == NETSIM_MAX_PACKETS)
+    {
+        sim->dropped++;
+        return;
+    }
+
+    int jitter = sim->jitterMs > 0 ? (int)(nextRandom(&sim->rng) % (uint32_t)(sim->jitterMs + 1)) : 0;
+    DelayedPacket *packet = &sim->queue[sim->count++];
+    packet->sendAtMs = nowMs + (uint64_t)(sim->delayMs + jitter);
+    packet->size = size;
+    memcpy(packet->data, data, (size_t)size);
+}
+
+// Envía los paquetes demorados cuya hora ya llegó (el jitter puede reordenarlos)
+void netPoll(NetPeer *peer, uint64_t nowMs)
+{
+    NetSim *sim = &peer->sim;
+    int kept = 0;
+    for (int i = 0; i < sim->count; i++)
+    {
+        if (sim->queue[i].sendAtMs <= nowMs)
+            sendRaw(peer, sim->queue[i].data, sim->queue[i].size);
+        else
+            sim->queue[kept++] = sim->queue[i];
+    }
+    sim->count = kept;
+}
+
+void netSendInputs(NetPeer *peer, const RollbackSession *session, uint64_t nowMs)
+{
+    uint32_t first = peer->remoteAck < session->frame ? peer->remoteAck : session->frame;
+    if (session->frame > NET_MAX_INPUTS_PER_PACKET && first < session->frame - NET_MAX_INPUTS_PER_PACKET)
+        first = session->frame - NET_MAX_INPUTS_PER_PACKET;
+    uint32_t count = session->frame - first;
+
+    uint8_t packet[NET_HEADER_SIZE + NET_MAX_INPUTS_PER_PACKET];
+    putU32(packet, NET_PACKET_MAGIC);
+    putU32(packet + 4, first);
+    packet[8] = (uint8_t)count;
+    putU32(packet + 9, session->confirmedFrame);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        packet[NET_HEADER_SIZE + i] = session->inputs[session->localPlayer][(first + i) % INPUT_HISTORY];
+    }
+
+    sendPacket(peer, packet, NET_HEADER_SIZE + (int)count, nowMs);
+}
+
+void netReceive(NetPeer *peer, RollbackSession *session)
+{
+    uint8_t packet[NET_HEADER_SIZE + NET_MAX_INPUTS_PER_PACKET];
+
+    while (true)
+    {
+        ssize_t n = recv(peer->fd, packet, sizeof(packet), 0);
+        if (n < NET_HEADER_SIZE)
+        {
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0)
+                return; // EAGAIN: no hay más paquetes
+            continue;   // Paquete truncado
+        }
+        if (getU32(packet) != NET_PACKET_MAGIC || NET_HEADER_SIZE + packet[8] > n)
+            continue;
+
+        uint32_t first = getU32(packet + 4);
+        uint32_t ack = getU32(packet + 9);
+        if (ack > peer->remoteAck)
+            peer->remoteAck = ack;
+
+        for (uint32_t i = 0; i < packet[8]; i++)
+        {
+            rollbackAddRemoteInput(session, first + i, packet[NET_HEADER_SIZE + i]);
+        }
+    }
+}
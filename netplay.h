@@ -0,0 +1,56 @@
+#ifndef NETPLAY_H
+#define NETPLAY_H
+
+#include <netinet/in.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "rollback.h"
+
+// ============ TRANSPORTE UDP DEL VERSUS ============
+// Cada paquete lleva los inputs locales que el rival todavía no confirmó
+// (redundancia: si se pierde un paquete, el siguiente los vuelve a llevar)
+// y hasta qué frame tenemos confirmados los suyos.
+
+#define NET_PACKET_MAGIC 0x54524231u // "TRB1"
+#define NET_MAX_INPUTS_PER_PACKET 64
+#define NETSIM_MAX_PACKETS 1024
+
+// Simulador de red: demora, jitter y pérdida aplicados al enviar
+typedef struct
+{
+    uint64_t sendAtMs;
+    int size;
+    uint8_t data[16 + NET_MAX_INPUTS_PER_PACKET];
+} DelayedPacket;
+
+typedef struct
+{
+    int delayMs;
+    int jitterMs;
+    int lossPercent;
+    uint32_t rng;
+    DelayedPacket queue[NETSIM_MAX_PACKETS];
+    int count;
+    uint64_t sent;
+    uint64_t dropped;
+} NetSim;
+
+typedef struct
+{
+    int fd;
+    struct sockaddr_in remote;
+    uint32_t remoteAck; // El rival confirmó nuestros inputs anteriores a este frame
+    bool simEnabled;
+    NetSim sim;
+} NetPeer;
+
+bool openNetPeer(NetPeer *peer, int localPort, const char *remoteHost, int remotePort);
+void closeNetPeer(NetPeer *peer);
+void setNetSim(NetPeer *peer, int delayMs, int jitterMs, int lossPercent, uint32_t seed);
+
+void netSendInputs(NetPeer *peer, const RollbackSession *session, uint64_t nowMs);
+void netReceive(NetPeer *peer, RollbackSession *session);
+void netPoll(NetPeer *peer, uint64_t nowMs);
+uint64_t netNowMs(void);
+
+#endif // NETPLAY_H
@@ -0,0 +1,216 @@
+#include "obsring.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Mapea un segmento ya abierto y completa la estructura del ring
+static bool mapRing(ObsRing *ring, int fd, size_t size)
+{
+    void *base = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (base == MAP_FAILED)
+    {
+        printf("Error al mapear ring de observaciones: %s\n", strerror(errno));
+        return false;
+    }
+
+    ring->header = (ObsRingHeader *)base;
+    ring->records = (ObsRecord *)((char *)base + OBS_RING_DATA_OFFSET);
+    ring->mappedSize = size;
+    return true;
+}
+
+// Crea (o recrea) el segmento compartido. Lo llama el productor.
+bool obsRingCreate(ObsRing *ring, const char *name, uint32_t capacity)
+{
+    memset(ring, 0, sizeof(*ring));
+
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+    {
+        printf("Error: la capacidad del ring debe ser potencia de 2 (%u)\n", capacity);
+        return false;
+    }
+
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        printf("Error al crear memoria compartida %s: %s\n", name, strerror(errno));
+        return false;
+    }
+
+    size_t size = OBS_RING_DATA_OFFSET + (size_t)capacity * sizeof(ObsRecord);
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        printf("Error al dimensionar memoria compartida: %s\n", strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    if (!mapRing(ring, fd, size))
+        return false;
+
+    ObsRingHeader *header = ring->header;
+    header->magic = OBS_RING_MAGIC;
+    header->version = OBS_RING_VERSION;
+    header->recordSize = sizeof(ObsRecord);
+    header->capacity = capacity;
+    atomic_store_explicit(&header->tail, 0, memory_order_relaxed);
+    atomic_store_explicit(&header->dropped, 0, memory_order_relaxed);
+    atomic_store_explicit(&header->head, 0, memory_order_release);
+
+    ring->mask = capacity - 1;
+    return true;
+}
+
+// Abre un segmento existente. Lo llama el consumidor.
+bool obsRingOpen(ObsRing *ring, const char *name)
+{
+    memset(ring, 0, sizeof(*ring));
+
+    int fd = shm_open(name, O_RDWR, 0600);
+    if (fd < 0)
+    {
+        printf("Error al abrir memoria compartida %s: %s\n", name, strerror(errno));
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < OBS_RING_DATA_OFFSET)
+    {
+        printf("Error: segmento %s inválido\n", name);
+        close(fd);
+        return false;
+    }
+
+    if (!mapRing(ring, fd, (size_t)info.st_size))
+        return false;
+
+    // La capacidad viene de memoria compartida: se lee una vez y se valida
+    // igual que en obsRingCreate antes de usarla como máscara
+    ObsRingHeader *header = ring->header;
+    uint32_t capacity = header->capacity;
+    size_t expected = OBS_RING_DATA_OFFSET + (size_t)capacity * sizeof(ObsRecord);
+    if (header->magic != OBS_RING_MAGIC || header->version != OBS_RING_VERSION ||
+        header->recordSize != sizeof(ObsRecord) || capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+        expected > ring->mappedSize)
+    {
+        printf("Error: formato de ring incompatible en %s\n", name);
+        obsRingClose(ring);
+        return false;
+    }
+
+    ring->mask = capacity - 1;
+    ring->cachedTail = atomic_load_explicit(&header->tail, memory_order_relaxed);
+    ring->cachedHead = atomic_load_explicit(&header->head, memory_order_acquire);
+    return true;
+}
+
+void obsRingClose(ObsRing *ring)
+{
+    if (ring->header != NULL)
+    {
+        munmap(ring->header, ring->mappedSize);
+        ring->header = NULL;
+        ring->records = NULL;
+    }
+}
+
+void obsRingUnlink(const char *name)
+{
+    shm_unlink(name);
+}
+
+// Serializa un GameState al formato fijo del ring
+void fillObsRecord(ObsRecord *record, const GameState *state, uint32_t gameId)
+{
+    record->gameId = gameId;
+    record->tick = state->tick;
+
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        uint16_t bits = 0;
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            bits |= (uint16_t)(state->grid[row][col] << col);
+        }
+        record->rows[row] = bits;
+    }
+
+    record->pieceType = (uint8_t)state->currentType;
+    record->rotation = (uint8_t)state->rotation;
+    record->pieceX = (int8_t)state->pieceX;
+    record->pieceY = (int8_t)state->pieceY;
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+    {
+        record->queue[i] = (uint8_t)state->nextQueue[i];
+    }
+    record->gameOver = state->gameOver ? 1 : 0;
+    record->reserved[0] = record->reserved[1] = 0;
+    record->score = state->score;
+    record->lines = state->totalLinesCleared;
+    record->piecesPlaced = (uint32_t)state->piecesPlaced;
+    record->reserved2 = 0;
+}
+
+// Publica un estado. Nunca bloquea: si el consumidor va atrasado y el
+// ring está lleno, descarta la observación y devuelve false.
+bool obsRingPublish(ObsRing *ring, const GameState *state, uint32_t gameId)
+{
+    ObsRingHeader *header = ring->header;
+    uint64_t head = ring->cachedHead;
+
+    if (head - ring->cachedTail > ring->mask)
+    {
+        // Solo releer el tail remoto cuando el ring parece lleno
+        ring->cachedTail = atomic_load_explicit(&header->tail, memory_order_acquire);
+        if (head - ring->cachedTail > ring->mask)
+        {
+            atomic_fetch_add_explicit(&header->dropped, 1, memory_order_relaxed);
+            return false;
+        }
+    }
+
+    // Escribir directamente en el slot compartido (sin buffer intermedio)
+    ObsRecord *record = &ring->records[head & ring->mask];
+    record->sequence = head;
+    fillObsRecord(record, state, gameId);
+
+    ring->cachedHead = head + 1;
+    atomic_store_explicit(&header->head, head + 1, memory_order_release);
+    return true;
+}
+
+// Devuelve un puntero al próximo bloque contiguo de registros listos.
+// `count` recibe cuántos hay (0 si el ring está vacío). Los registros
+// siguen siendo válidos hasta llamar a obsRingRelease.
+const ObsRecord *obsRingPeek(ObsRing *ring, uint32_t *count)
+{
+    uint64_t tail = ring->cachedTail;
+
+    if (ring->cachedHead == tail)
+    {
+        ring->cachedHead = atomic_load_explicit(&ring->header->head, memory_order_acquire);
+        if (ring->cachedHead == tail)
+        {
+            *count = 0;
+            return NULL;
+        }
+    }
+
+    uint64_t available = ring->cachedHead - tail;
+    uint64_t untilWrap = (ring->mask + 1) - (tail & ring->mask);
+    *count = (uint32_t)(available < untilWrap ? available : untilWrap);
+    return &ring->records[tail & ring->mask];
+}
+
+// Marca `count` registros como leídos y libera sus slots al productor
+void obsRingRelease(ObsRing *ring, uint32_t count)
+{
+    ring->cachedTail += count;
+    atomic_store_explicit(&ring->header->tail, ring->cachedTail, memory_order_release);
+}
@@ -0,0 +1,83 @@
+#ifndef OBSRING_H
+#define OBSRING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "game.h"
+
+// ============ RING DE OBSERVACIONES EN MEMORIA COMPARTIDA ============
+// Un simulador (productor) publica estados de partida en un buffer
+// circular POSIX (shm_open + mmap). Un proceso entrenador (consumidor)
+// mapea el mismo segmento y lee los registros sin copiarlos.
+// Un solo productor y un solo consumidor: los índices head/tail son
+// atómicos y no hace falta ningún lock.
+
+#define OBS_RING_MAGIC 0x4F425352u // "OBSR"
+#define OBS_RING_VERSION 1
+
+// Registro de tamaño fijo (layout estable para leerlo desde otro lenguaje)
+typedef struct
+{
+    uint64_t sequence;           // Número de observación (0, 1, 2, ...)
+    uint32_t gameId;             // Partida que generó la observación
+    uint32_t tick;               // Tick de la partida
+    uint16_t rows[GRID_HEIGHT];  // Bit c de rows[r] = celda (r, c) ocupada
+    uint8_t pieceType;           // PieceType de la pieza actual
+    uint8_t rotation;            // Rotaciones aplicadas (0-3)
+    int8_t pieceX;
+    int8_t pieceY;
+    uint8_t queue[NEXT_QUEUE_SIZE]; // Próximas piezas
+    uint8_t gameOver;
+    uint8_t reserved[2];
+    int32_t score;
+    int32_t lines;
+    uint32_t piecesPlaced;
+    uint32_t reserved2;
+} ObsRecord;
+
+_Static_assert(GRID_WIDTH <= 16, "ObsRecord guarda cada fila en 16 bits");
+_Static_assert(sizeof(ObsRecord) == 88, "El layout de ObsRecord es parte del formato");
+
+// Cabecera al inicio del segmento; los registros empiezan en OBS_RING_DATA_OFFSET
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t capacity; // Potencia de 2
+
+    // head y tail en líneas de caché distintas para no pisarse entre procesos
+    _Alignas(64) _Atomic uint64_t head; // Próximo registro a escribir (productor)
+    _Alignas(64) _Atomic uint64_t tail; // Próximo registro a leer (consumidor)
+    _Alignas(64) _Atomic uint64_t dropped; // Registros descartados por ring lleno
+} ObsRingHeader;
+
+#define OBS_RING_DATA_OFFSET ((sizeof(ObsRingHeader) + 63) & ~(size_t)63)
+
+typedef struct
+{
+    ObsRingHeader *header;
+    ObsRecord *records;
+    size_t mappedSize;
+    uint64_t mask;
+    uint64_t cachedHead; // Copia local para no leer el índice remoto en cada llamada
+    uint64_t cachedTail;
+} ObsRing;
+
+// Creación y apertura
+bool obsRingCreate(ObsRing *ring, const char *name, uint32_t capacity);
+bool obsRingOpen(ObsRing *ring, const char *name);
+void obsRingClose(ObsRing *ring);
+void obsRingUnlink(const char *name);
+
+// Productor
+void fillObsRecord(ObsRecord *record, const GameState *state, uint32_t gameId);
+bool obsRingPublish(ObsRing *ring, const GameState *state, uint32_t gameId);
+
+// Consumidor (zero-copy: los punteros apuntan dentro del segmento)
+const ObsRecord *obsRingPeek(ObsRing *ring, uint32_t *count);
+void obsRingRelease(ObsRing *ring, uint32_t count);
+
+#endif // OBSRING_H
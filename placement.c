@@ -0,0 +1,261 @@
+#include "placement.h"
+#include <pthread.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PLACEMENT_X86 1
+#endif
+
+// ============ PERFILES DE LAS ROTACIONES ============
+// Las columnas ocupadas de un tetrominó son contiguas: k = 0 es la primera
+// columna ocupada de la matriz 4x4 y span la cantidad de columnas.
+
+typedef struct
+{
+    int firstCol;
+    int span;
+    int16_t drop[4];    // GRID_HEIGHT - 1 - fila más baja de la columna k
+    int topConst;       // Suma de (GRID_HEIGHT - fila más alta) de las columnas
+    int top[4];         // Fila más alta de la columna k
+    int internalHoles;  // Celdas vacías entre bloques de una misma columna
+} RotationProfile;
+
+static RotationProfile profiles[NUM_PIECES][4];
+static PlacementKernel bestKernel = PLACEMENT_SCALAR;
+static pthread_once_t profilesOnce = PTHREAD_ONCE_INIT;
+
+static void buildProfiles(void)
+{
+    for (int type = 0; type < NUM_PIECES; type++)
+    {
+        for (int rotation = 0; rotation < 4; rotation++)
+        {
+            const PieceMask *piece = getPieceMask((PieceType)type, rotation);
+            RotationProfile *profile = &profiles[type][rotation];
+            memset(profile, 0, sizeof(*profile));
+            profile->firstCol = -1;
+
+            for (int col = 0; col < 4; col++)
+            {
+                int top = -1;
+                int bottom = -1;
+                int cells = 0;
+                for (int row = 0; row < 4; row++)
+                {
+                    if (piece->rows[row] & (1u << col))
+                    {
+                        if (top < 0)
+                            top = row;
+                        bottom = row;
+                        cells++;
+                    }
+                }
+                if (cells == 0)
+                    continue;
+                if (profile->firstCol < 0)
+                    profile->firstCol = col;
+
+                int k = profile->span++;
+                profile->drop[k] = (int16_t)(GRID_HEIGHT - 1 - bottom);
+                profile->top[k] = top;
+                profile->topConst += GRID_HEIGHT - top;
+                profile->internalHoles += bottom - top + 1 - cells;
+            }
+        }
+    }
+
+#ifdef PLACEMENT_X86
+    bestKernel = __builtin_cpu_supports("avx2") ? PLACEMENT_AVX2 : PLACEMENT_SSE2;
+#endif
+}
+
+// ============ KERNELS ============
+// Todos calculan los PLACEMENT_LANES carriles (los que pasan de count
+// leen el relleno en cero y se ignoran), así las salidas son comparables
+// byte a byte. heights tiene PLACEMENT_LANES + 4 entradas.
+
+static void scalarKernel(const int16_t *heights, const RotationProfile *profile, int baseSum, int baseHoles,
+                         RotationPlacements *out)
+{
+    for (int lane = 0; lane < PLACEMENT_LANES; lane++)
+    {
+        int16_t y = INT16_MAX;
+        int16_t sumDrop = 0;
+        int16_t sumHeights = 0;
+        for (int k = 0; k < profile->span; k++)
+        {
+            int16_t drop = (int16_t)(profile->drop[k] - heights[lane + k]);
+            if (drop < y)
+                y = drop;
+            sumDrop = (int16_t)(sumDrop + drop);
+            sumHeights = (int16_t)(sumHeights + heights[lane + k]);
+        }
+        int16_t covered = (int16_t)(y * profile->span);
+        out->landingY[lane] = y;
+        out->holes[lane] = (int16_t)(baseHoles + profile->internalHoles + sumDrop - covered);
+        out->heightSum[lane] = (int16_t)(baseSum + profile->topConst - sumHeights - covered);
+    }
+}
+
+#ifdef PLACEMENT_X86
+static void sse2Kernel(const int16_t *heights, const RotationProfile *profile, int baseSum, int baseHoles,
+                       RotationPlacements *out)
+{
+    const __m128i span = _mm_set1_epi16((int16_t)profile->span);
+    const __m128i holesBase = _mm_set1_epi16((int16_t)(baseHoles + profile->internalHoles));
+    const __m128i sumBase = _mm_set1_epi16((int16_t)(baseSum + profile->topConst));
+
+    for (int half = 0; half < PLACEMENT_LANES; half += 8)
+    {
+        __m128i y = _mm_set1_epi16(INT16_MAX);
+        __m128i sumDrop = _mm_setzero_si128();
+        __m128i sumHeights = _mm_setzero_si128();
+        for (int k = 0; k < profile->span; k++)
+        {
+            __m128i h = _mm_loadu_si128((const __m128i *)(heights + half + k));
+            __m128i drop = _mm_sub_epi16(_mm_set1_epi16(profile->drop[k]), h);
+            y = _mm_min_epi16(y, drop);
+            sumDrop = _mm_add_epi16(sumDrop, drop);
+            sumHeights = _mm_add_epi16(sumHeights, h);
+        }
+        __m128i covered = _mm_mullo_epi16(y, span);
+        __m128i holes = _mm_sub_epi16(_mm_add_epi16(holesBase, sumDrop), covered);
+        __m128i heightSum = _mm_sub_epi16(_mm_sub_epi16(sumBase, sumHeights), covered);
+        _mm_storeu_si128((__m128i *)(out->landingY + half), y);
+        _mm_storeu_si128((__m128i *)(out->holes + half), holes);
+        _mm_storeu_si128((__m128i *)(out->heightSum + half), heightSum);
+    }
+}
+
+__attribute__((target("avx2"))) static void avx2Kernel(const int16_t *heights, const RotationProfile *profile,
+                                                       int baseSum, int baseHoles, RotationPlacements *out)
+{
+    const __m256i span = _mm256_set1_epi16((int16_t)profile->span);
+    const __m256i holesBase = _mm256_set1_epi16((int16_t)(baseHoles + profile->internalHoles));
+    const __m256i sumBase = _mm256_set1_epi16((int16_t)(baseSum + profile->topConst));
+
+    __m256i y = _mm256_set1_epi16(INT16_MAX);
+    __m256i sumDrop = _mm256_setzero_si256();
+    __m256i sumHeights = _mm256_setzero_si256();
+    for (int k = 0; k < profile->span; k++)
+    {
+        __m256i h = _mm256_loadu_si256((const __m256i *)(heights + k));
+        __m256i drop = _mm256_sub_epi16(_mm256_set1_epi16(profile->drop[k]), h);
+        y = _mm256_min_epi16(y, drop);
+        sumDrop = _mm256_add_epi16(sumDrop, drop);
+        sumHeights = _mm256_add_epi16(sumHeights, h);
+    }
+    __m256i covered = _mm256_mullo_epi16(y, span);
+    __m256i holes = _mm256_sub_epi16(_mm256_add_epi16(holesBase, sumDrop), covered);
+    __m256i heightSum = _mm256_sub_epi16(_mm256_sub_epi16(sumBase, sumHeights), covered);
+    _mm256_storeu_si256((__m256i *)out->landingY, y);
+    _mm256_storeu_si256((__m256i *)out->holes, holes);
+    _mm256_storeu_si256((__m256i *)out->heightSum, heightSum);
+}
+#endif
+
+void evaluatePlacementsWith(PlacementKernel kernel, const StandardBoard *board, PieceType type, PlacementSet *out)
+{
+    pthread_once(&profilesOnce, buildProfiles);
+    if (!placementKernelSupported(kernel))
+        kernel = PLACEMENT_SCALAR;
+
+    int16_t heights[PLACEMENT_LANES + 4] = {0};
+    out->type = type;
+    out->holes = standardColumnHeights(board, out->heights);
+    out->heightSum = 0;
+    for (int col = 0; col < GRID_WIDTH; col++)
+    {
+        heights[col] = (int16_t)out->heights[col];
+        out->heightSum += out->heights[col];
+    }
+
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        const RotationProfile *profile = &profiles[type][rotation];
+        RotationPlacements *placements = &out->rotations[rotation];
+        placements->count = GRID_WIDTH - profile->span + 1;
+        placements->firstX = -profile->firstCol;
+
+        switch (kernel)
+        {
+#ifdef PLACEMENT_X86
+        case PLACEMENT_AVX2:
+            avx2Kernel(heights, profile, out->heightSum, out->holes, placements);
+            break;
+        case PLACEMENT_SSE2:
+            sse2Kernel(heights, profile, out->heightSum, out->holes, placements);
+            break;
+#endif
+        default:
+            scalarKernel(heights, profile, out->heightSum, out->holes, placements);
+            break;
+        }
+    }
+}
+
+void evaluatePlacements(const StandardBoard *board, PieceType type, PlacementSet *out)
+{
+    evaluatePlacementsWith(getPlacementKernel(), board, type, out);
+}
+
+PlacementKernel getPlacementKernel(void)
+{
+    pthread_once(&profilesOnce, buildProfiles);
+    return bestKernel;
+}
+
+bool placementKernelSupported(PlacementKernel kernel)
+{
+    pthread_once(&profilesOnce, buildProfiles);
+    return kernel >= PLACEMENT_SCALAR && kernel <= bestKernel;
+}
+
+const char *getPlacementKernelName(PlacementKernel kernel)
+{
+    switch (kernel)
+    {
+    case PLACEMENT_SSE2:
+        return "SSE2";
+    case PLACEMENT_AVX2:
+        return "AVX2";
+    default:
+        return "escalar";
+    }
+}
+
+int placementBumpiness(const PlacementSet *set, int rotation, int lane)
+{
+    const RotationProfile *profile = &profiles[set->type][rotation];
+    const RotationPlacements *placements = &set->rotations[rotation];
+    int heights[GRID_WIDTH];
+    memcpy(heights, set->heights, sizeof(heights));
+
+    int y = placements->landingY[lane];
+    for (int k = 0; k < profile->span; k++)
+    {
+        heights[lane + k] = GRID_HEIGHT - y - profile->top[k];
+    }
+
+    int bumpiness = 0;
+    for (int col = 1; col < GRID_WIDTH; col++)
+    {
+        bumpiness += heights[col] > heights[col - 1] ? heights[col] - heights[col - 1] : heights[col - 1] - heights[col];
+    }
+    return bumpiness;
+}
+
+bool placementClearsLines(const StandardBoard *board, const PieceMask *piece, int x, int y)
+{
+    for (int r = 0; r < 4; r++)
+    {
+        uint64_t bits;
+        if (piece->rows[r] == 0 || y + r < 0 || y + r >= GRID_HEIGHT)
+            continue;
+        if (shiftPieceRow(piece->rows[r], x, GRID_WIDTH, &bits) &&
+            ((uint64_t)board->rows[y + r] | bits) == BOARD_FULL_ROW(GRID_WIDTH))
+            return true;
+    }
+    return false;
+}
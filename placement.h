@@ -0,0 +1,71 @@
+#ifndef PLACEMENT_H
+#define PLACEMENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "bitboard.h"
+
+// ============ EVALUACIÓN DE TODAS LAS COLOCACIONES ============
+// Para una pieza calcula, de una sola pasada, la fila de caída y los
+// features de altura y huecos de todas las columnas de las 4 rotaciones.
+// En lugar de bajar la pieza fila por fila usa el vector de alturas de
+// columna y el perfil inferior de cada rotación:
+//
+//   y = min_k (GRID_HEIGHT - 1 - bottom[k] - heights[x + k])
+//
+// Cada columna candidata es un carril de un vector de int16: SSE2 hace 8
+// carriles por instrucción y AVX2 16. La versión escalar hace las mismas
+// cuentas carril por carril y las tres dan resultados idénticos.
+//
+// Es la caída desde arriba de todo: coincide con soltar la pieza desde
+// startY solo si startY <= y (la pieza arranca por encima del perfil).
+// Los features son los del tablero fijado ANTES de eliminar líneas; si la
+// colocación completa alguna (placementClearsLines) hay que fijarla en el
+// bitboard y recalcular.
+
+#define PLACEMENT_LANES 16 // Carriles por rotación (columnas candidatas)
+
+_Static_assert(GRID_WIDTH <= PLACEMENT_LANES, "Un carril por columna: el tablero es demasiado ancho");
+
+typedef enum
+{
+    PLACEMENT_SCALAR = 0,
+    PLACEMENT_SSE2,
+    PLACEMENT_AVX2,
+    NUM_PLACEMENT_KERNELS
+} PlacementKernel;
+
+// Colocaciones de una rotación; el carril i es la columna x = firstX + i
+typedef struct
+{
+    int count;
+    int firstX;
+    int16_t landingY[PLACEMENT_LANES];  // Fila (de la matriz 4x4) donde queda la pieza
+    int16_t heightSum[PLACEMENT_LANES]; // Suma de alturas después de fijar
+    int16_t holes[PLACEMENT_LANES];     // Huecos después de fijar
+} RotationPlacements;
+
+typedef struct
+{
+    int heights[GRID_WIDTH]; // Alturas del tablero de partida
+    int heightSum;
+    int holes;
+    PieceType type;
+    RotationPlacements rotations[4];
+} PlacementSet;
+
+// Con el mejor kernel que soporta la CPU
+void evaluatePlacements(const StandardBoard *board, PieceType type, PlacementSet *out);
+void evaluatePlacementsWith(PlacementKernel kernel, const StandardBoard *board, PieceType type, PlacementSet *out);
+
+PlacementKernel getPlacementKernel(void);
+bool placementKernelSupported(PlacementKernel kernel);
+const char *getPlacementKernelName(PlacementKernel kernel);
+
+// Bumpiness del tablero fijado (antes de eliminar líneas)
+int placementBumpiness(const PlacementSet *set, int rotation, int lane);
+
+// La pieza fijada en (x, y) completa alguna fila
+bool placementClearsLines(const StandardBoard *board, const PieceMask *piece, int x, int y);
+
+#endif // PLACEMENT_H
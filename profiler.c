@@ -0,0 +1,173 @@
+#include "profiler.h"
+
+#ifdef FRAME_PROFILER
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "constants.h"
+#include "ui.h"
+
+#define GRAPH_FRAMES 150     // Frames visibles en el gráfico
+#define GRAPH_HEIGHT 100     // Píxeles para 2 frames de presupuesto
+#define OVERLAY_X 10
+#define OVERLAY_Y 10
+
+typedef struct
+{
+    Uint64 phaseStart[NUM_FRAME_PHASES];
+    Uint64 end;
+} ProfiledFrame;
+
+static ProfiledFrame frames[PROFILER_FRAMES];
+static Uint32 frameCount; // Frames completos (el actual es frames[frameCount % PROFILER_FRAMES])
+static bool overlayVisible;
+
+static const char *PHASE_NAMES[NUM_FRAME_PHASES] = {"eventos", "update", "render", "espera"};
+static const SDL_Color PHASE_COLORS[NUM_FRAME_PHASES] = {
+    {80, 160, 255, 255}, {80, 220, 120, 255}, {240, 200, 60, 255}, {110, 110, 110, 255}};
+
+void profilerBeginPhase(FramePhase phase)
+{
+    frames[frameCount % PROFILER_FRAMES].phaseStart[phase] = SDL_GetPerformanceCounter();
+}
+
+void profilerEndFrame(void)
+{
+    frames[frameCount % PROFILER_FRAMES].end = SDL_GetPerformanceCounter();
+    frameCount++;
+}
+
+static Uint64 phaseDuration(const ProfiledFrame *frame, int phase)
+{
+    Uint64 end = phase + 1 < NUM_FRAME_PHASES ? frame->phaseStart[phase + 1] : frame->end;
+    return end - frame->phaseStart[phase];
+}
+
+static int compareU64(const void *a, const void *b)
+{
+    Uint64 x = *(const Uint64 *)a;
+    Uint64 y = *(const Uint64 *)b;
+    return x < y ? -1 : x > y;
+}
+
+// Índice en el ring del i-ésimo frame completo más viejo de los últimos `count`
+static const ProfiledFrame *recentFrame(Uint32 count, Uint32 i)
+{
+    return &frames[(frameCount - count + i) % PROFILER_FRAMES];
+}
+
+static Uint32 storedFrames(void)
+{
+    return frameCount < PROFILER_FRAMES ? frameCount : PROFILER_FRAMES;
+}
+
+void profilerRenderOverlay(SDL_Renderer *renderer)
+{
+    if (!overlayVisible)
+        return;
+
+    double msPerTick = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    double pixelsPerMs = GRAPH_HEIGHT / (2.0 * FRAME_DELAY);
+    Uint32 count = storedFrames();
+    Uint32 shown = count < GRAPH_FRAMES ? count : GRAPH_FRAMES;
+
+    SDL_Rect background = {OVERLAY_X, OVERLAY_Y, GRAPH_FRAMES * 2 + 170, GRAPH_HEIGHT + 90};
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+    SDL_RenderFillRect(renderer, &background);
+
+    // Barras apiladas: un lote de rectángulos por fase
+    static SDL_Rect bars[NUM_FRAME_PHASES][GRAPH_FRAMES];
+    int baseY = OVERLAY_Y + 10 + GRAPH_HEIGHT;
+    for (Uint32 i = 0; i < shown; i++)
+    {
+        const ProfiledFrame *frame = recentFrame(shown, i);
+        int top = baseY;
+        for (int phase = 0; phase < NUM_FRAME_PHASES; phase++)
+        {
+            int height = (int)((double)phaseDuration(frame, phase) * msPerTick * pixelsPerMs + 0.5);
+            if (top - height < OVERLAY_Y)
+                height = top - OVERLAY_Y;
+            top -= height;
+            bars[phase][i] = (SDL_Rect){OVERLAY_X + 10 + (int)i * 2, top, 2, height};
+        }
+    }
+    for (int phase = 0; phase < NUM_FRAME_PHASES; phase++)
+    {
+        SDL_SetRenderDrawColor(renderer, PHASE_COLORS[phase].r, PHASE_COLORS[phase].g, PHASE_COLORS[phase].b, 255);
+        SDL_RenderFillRects(renderer, bars[phase], (int)shown);
+    }
+
+    // Presupuesto de un frame (FRAME_DELAY ms)
+    int budgetY = baseY - (int)(FRAME_DELAY * pixelsPerMs);
+    SDL_SetRenderDrawColor(renderer, 255, 60, 60, 255);
+    SDL_RenderDrawLine(renderer, OVERLAY_X + 10, budgetY, OVERLAY_X + 10 + GRAPH_FRAMES * 2, budgetY);
+
+    // p50/p99 de cada fase sobre todo el ring
+    static Uint64 durations[PROFILER_FRAMES];
+    char text[80];
+    for (int phase = 0; phase < NUM_FRAME_PHASES && count > 0; phase++)
+    {
+        for (Uint32 i = 0; i < count; i++)
+        {
+            durations[i] = phaseDuration(recentFrame(count, i), phase);
+        }
+        qsort(durations, count, sizeof(Uint64), compareU64);
+        snprintf(text, sizeof(text), "%-7s p50 %5.2f  p99 %5.2f ms", PHASE_NAMES[phase],
+                 (double)durations[count / 2] * msPerTick, (double)durations[count * 99 / 100] * msPerTick);
+        renderText(renderer, text, OVERLAY_X + GRAPH_FRAMES * 2 + 20, OVERLAY_Y + 10 + phase * 22,
+                   PHASE_COLORS[phase]);
+    }
+
+    SDL_Color white = {255, 255, 255, 255};
+    snprintf(text, sizeof(text), "%u frames (F3 ocultar, F12 exportar)", count);
+    renderText(renderer, text, OVERLAY_X + 10, baseY + 20, white);
+}
+
+bool profilerExportTrace(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        printf("Error al crear %s\n", path);
+        return false;
+    }
+
+    double usPerTick = 1000000.0 / (double)SDL_GetPerformanceFrequency();
+    Uint32 count = storedFrames();
+    Uint64 origin = count > 0 ? recentFrame(count, 0)->phaseStart[0] : 0;
+
+    // Un evento "X" (completo) por frame y uno por fase, anidados en el mismo hilo
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    for (Uint32 i = 0; i < count; i++)
+    {
+        const ProfiledFrame *frame = recentFrame(count, i);
+        fprintf(file, "%s{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+                i > 0 ? ",\n" : "", (double)(frame->phaseStart[0] - origin) * usPerTick,
+                (double)(frame->end - frame->phaseStart[0]) * usPerTick);
+        for (int phase = 0; phase < NUM_FRAME_PHASES; phase++)
+        {
+            fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%.3f,\"dur\":%.3f}",
+                    PHASE_NAMES[phase], (double)(frame->phaseStart[phase] - origin) * usPerTick,
+                    (double)phaseDuration(frame, phase) * usPerTick);
+        }
+    }
+    fprintf(file, "\n]}\n");
+
+    bool ok = fclose(file) == 0;
+    if (ok)
+        printf("Trace de %u frames guardado en %s\n", count, path);
+    return ok;
+}
+
+void profilerHandleEvent(const SDL_Event *event)
+{
+    if (event->type != SDL_KEYDOWN)
+        return;
+    if (event->key.keysym.sym == SDLK_F3)
+        overlayVisible = !overlayVisible;
+    else if (event->key.keysym.sym == SDLK_F12)
+        profilerExportTrace(PROFILER_TRACE_FILE);
+}
+
+#endif // FRAME_PROFILER
@@ -0,0 +1,51 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <SDL.h>
+#include <stdbool.h>
+
+// ============ PROFILER DE FASES DEL FRAME ============
+// Marca con SDL_GetPerformanceCounter el comienzo de cada fase del game
+// loop (eventos, update, render, espera) en un ring de los últimos
+// PROFILER_FRAMES frames. F3 muestra un overlay con el gráfico de tiempos
+// por frame y p50/p99 de cada fase; F12 exporta el ring como JSON de
+// trace events de Chrome (abrir con chrome://tracing o Perfetto).
+//
+// Solo existe si se compila con -DFRAME_PROFILER (make PROFILE=1); si no,
+// las macros PROFILE_* no generan código.
+
+typedef enum
+{
+    PHASE_EVENTS = 0,
+    PHASE_UPDATE,
+    PHASE_RENDER,
+    PHASE_DELAY, // SDL_Delay de control de FPS
+    NUM_FRAME_PHASES
+} FramePhase;
+
+#define PROFILER_FRAMES 600 // 10 segundos a 60 FPS
+#define PROFILER_TRACE_FILE "frame_trace.json"
+
+#ifdef FRAME_PROFILER
+
+void profilerBeginPhase(FramePhase phase); // Cierra la fase anterior
+void profilerEndFrame(void);
+void profilerHandleEvent(const SDL_Event *event);
+void profilerRenderOverlay(SDL_Renderer *renderer);
+bool profilerExportTrace(const char *path);
+
+#define PROFILE_PHASE(phase) profilerBeginPhase(phase)
+#define PROFILE_FRAME_END() profilerEndFrame()
+#define PROFILE_EVENT(event) profilerHandleEvent(event)
+#define PROFILE_OVERLAY(renderer) profilerRenderOverlay(renderer)
+
+#else
+
+#define PROFILE_PHASE(phase) ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define PROFILE_EVENT(event) ((void)0)
+#define PROFILE_OVERLAY(renderer) ((void)0)
+
+#endif // FRAME_PROFILER
+
+#endif // PROFILER_H
@@ -0,0 +1,78 @@
+#ifndef PROTOCOL_H
+#define PROTOCOL_H
+
+#include <stdint.h>
+#include "constants.h"
+
+// ============ PROTOCOLO BINARIO DEL SERVIDOR ============
+// Cada mensaje es: [uint16 largo del payload][uint8 tipo][payload]
+// Todos los enteros van en little-endian.
+
+#define SERVER_DEFAULT_PORT 7777
+#define SERVER_DEFAULT_SOCKET "/tmp/tetris.sock"
+
+#define MSG_HEADER_SIZE 3
+#define MSG_MAX_PAYLOAD 256
+
+typedef enum
+{
+    MSG_HELLO = 1,     // C->S: uint32 semilla (empieza una partida nueva)
+    MSG_WELCOME,       // S->C: uint32 id de sesión
+    MSG_INPUT,         // C->S: uint8 teclas mantenidas (InputFlags), uint32 seq
+    MSG_STATE,         // S->C: estado de la partida (ver NET_STATE_SIZE)
+    MSG_GAME_OVER,     // S->C: int32 puntaje, int32 líneas
+    MSG_STATS_REQUEST, // C->S: sin payload
+    MSG_STATS          // S->C: estadísticas del servidor (ver NET_STATS_SIZE)
+} MessageType;
+
+// MSG_STATE: tick, último seq de input aplicado, filas en bits,
+// tipo/rotación/x/y de la pieza, puntaje y líneas
+#define NET_STATE_SIZE (4 + 4 + GRID_HEIGHT * 2 + 4 + 4 + 4)
+
+// MSG_STATS: sesiones, ticks, ticks atrasados, p50/p99/máx de duración
+// del tick en microsegundos, estados descartados por clientes lentos
+#define NET_STATS_SIZE (4 + 8 + 4 + 4 + 4 + 4 + 8)
+
+// Helpers de serialización
+static inline void putU16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static inline void putU32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+        p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static inline void putU64(uint8_t *p, uint64_t v)
+{
+    for (int i = 0; i < 8; i++)
+        p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static inline uint16_t getU16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t getU32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint64_t getU64(const uint8_t *p)
+{
+    return (uint64_t)getU32(p) | ((uint64_t)getU32(p + 4) << 32);
+}
+
+// Escribe la cabecera y devuelve el tamaño total del mensaje
+static inline int putHeader(uint8_t *p, MessageType type, uint16_t payloadSize)
+{
+    putU16(p, payloadSize);
+    p[2] = (uint8_t)type;
+    return MSG_HEADER_SIZE + payloadSize;
+}
+
+#endif // PROTOCOL_H
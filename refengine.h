@@ -0,0 +1,18 @@
+#ifndef REFENGINE_H
+#define REFENGINE_H
+
+#include "game.h"
+
+// ============ MOTOR DE REFERENCIA ============
+// Copia congelada del motor de game.c tal como era antes de reescribirlo
+// con bitboards y SIMD: checkCollision, lockPiece, clearCompleteLines,
+// rotatePieceWithKicks y el stepGame que los usa, celda por celda.
+// No se optimiza ni se corrige por separado: es el comportamiento contra
+// el que tools/difftest.c compara cualquier versión nueva, tick a tick.
+// Si el comportamiento del juego cambia a propósito, se cambia acá
+// también y en el mismo commit.
+
+void refInitGame(GameState *state, uint32_t seed);
+int refStepGame(GameState *state, unsigned inputs);
+
+#endif // REFENGINE_H
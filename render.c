@@ -0,0 +1,223 @@
+#include "render.h"
+
+// Rectángulos acumulados para dibujarlos con una sola llamada por color
+// (SDL_RenderFillRects) en lugar de un SDL_RenderFillRect por celda
+#define MAX_RUNS_PER_ROW ((GRID_WIDTH + 1) / 2) // Tramos de celdas llenas por fila
+
+typedef struct
+{
+    SDL_Rect *rects;
+    int count;
+    int capacity;
+} RectBatch;
+
+static SDL_Rect filledRects[MAX_MINI_BOARDS * GRID_HEIGHT * MAX_RUNS_PER_ROW];
+static SDL_Rect emptyRects[GRID_HEIGHT * GRID_WIDTH];
+static SDL_Rect pieceRects[NUM_PIECES][MAX_MINI_BOARDS * 4];
+static SDL_Rect backgroundRects[MAX_MINI_BOARDS];
+static SDL_Rect deadRects[MAX_MINI_BOARDS];
+
+#define BATCH(array) {array, 0, (int)(sizeof(array) / sizeof(array[0]))}
+
+static RectBatch filledBatch = BATCH(filledRects);
+static RectBatch emptyBatch = BATCH(emptyRects);
+static RectBatch pieceBatches[NUM_PIECES] = {
+    BATCH(pieceRects[0]), BATCH(pieceRects[1]), BATCH(pieceRects[2]), BATCH(pieceRects[3]),
+    BATCH(pieceRects[4]), BATCH(pieceRects[5]), BATCH(pieceRects[6])};
+static RectBatch backgroundBatch = BATCH(backgroundRects);
+static RectBatch deadBatch = BATCH(deadRects);
+
+static void addRect(RectBatch *batch, int x, int y, int w, int h)
+{
+    if (batch->count == batch->capacity)
+        return;
+    SDL_Rect *rect = &batch->rects[batch->count++];
+    rect->x = x;
+    rect->y = y;
+    rect->w = w;
+    rect->h = h;
+}
+
+static void fillBatch(SDL_Renderer *renderer, RectBatch *batch, SDL_Color color)
+{
+    if (batch->count > 0)
+    {
+        SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
+        SDL_RenderFillRects(renderer, batch->rects, batch->count);
+    }
+    batch->count = 0;
+}
+
+// Dibuja el tablero completo: fondo, piezas fijadas y la pieza que cae
+void renderBoard(SDL_Renderer *renderer, int grid[GRID_HEIGHT][GRID_WIDTH],
+                 int currentPiece[4][4], PieceType currentType, int pieceX, int pieceY)
+{
+    // Limpiar la pantalla con un color de fondo
+    SDL_SetRenderDrawColor(renderer, COLOR_BACKGROUND_R, COLOR_BACKGROUND_G, COLOR_BACKGROUND_B, COLOR_BACKGROUND_A);
+    SDL_RenderClear(renderer);
+
+    renderBoardAt(renderer, BOARD_OFFSET_X, BOARD_OFFSET_Y, grid, currentPiece, currentType, pieceX, pieceY);
+}
+
+static void drawGrid(SDL_Renderer *renderer, int originX, int originY, const int grid[GRID_HEIGHT][GRID_WIDTH])
+{
+    // Dibujar la grilla de Tetris (piezas ya colocadas)
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            RectBatch *batch = grid[row][col] == 1 ? &filledBatch : &emptyBatch;
+            addRect(batch, originX + col * CELL_SIZE, originY + row * CELL_SIZE, CELL_SIZE - 1, CELL_SIZE - 1);
+        }
+    }
+
+    // Piezas fijadas (usar color cyan por ahora)
+    SDL_Color lockedColor = {0, 240, 240, 255};
+    fillBatch(renderer, &filledBatch, lockedColor);
+
+    // Grilla vacía
+    if (emptyBatch.count > 0)
+    {
+        SDL_SetRenderDrawColor(renderer, COLOR_GRID_R, COLOR_GRID_G, COLOR_GRID_B, COLOR_GRID_A);
+        SDL_RenderDrawRects(renderer, emptyBatch.rects, emptyBatch.count);
+        emptyBatch.count = 0;
+    }
+}
+
+// La pieza que cae, corrida (offsetX, offsetY) píxeles de su celda
+static void drawPiece(SDL_Renderer *renderer, int originX, int originY, const int currentPiece[4][4],
+                      PieceType currentType, int pieceX, int pieceY, int offsetX, int offsetY)
+{
+    // Dibujar la pieza actual (la que está cayendo)
+    RectBatch *pieceBatch = &pieceBatches[currentType];
+    for (int row = 0; row < 4; row++)
+    {
+        for (int col = 0; col < 4; col++)
+        {
+            // Si esta celda de la pieza está ocupada
+            if (currentPiece[row][col] == 1)
+            {
+                // Calcular la posición en la grilla y en píxeles
+                int gridRow = pieceY + row;
+                int gridCol = pieceX + col;
+
+                // Verificar que esté dentro de los límites
+                if (gridRow >= 0 && gridRow < GRID_HEIGHT &&
+                    gridCol >= 0 && gridCol < GRID_WIDTH)
+                {
+                    addRect(pieceBatch, originX + gridCol * CELL_SIZE + offsetX,
+                            originY + gridRow * CELL_SIZE + offsetY, CELL_SIZE - 1, CELL_SIZE - 1);
+                }
+            }
+        }
+    }
+
+    // Dibujar con el color correspondiente a la pieza
+    fillBatch(renderer, pieceBatch, PIECE_COLORS[currentType]);
+}
+
+// Dibuja un tablero con su esquina superior izquierda en (originX, originY)
+// sin limpiar la pantalla (para mostrar varios tableros a la vez)
+void renderBoardAt(SDL_Renderer *renderer, int originX, int originY, int grid[GRID_HEIGHT][GRID_WIDTH],
+                   int currentPiece[4][4], PieceType currentType, int pieceX, int pieceY)
+{
+    drawGrid(renderer, originX, originY, grid);
+    drawPiece(renderer, originX, originY, currentPiece, currentType, pieceX, pieceY, 0, 0);
+}
+
+// Solo se interpola un paso de una celda de la misma pieza (gravedad, soft
+// drop o un movimiento lateral); un kick, una rotación o una pieza nueva
+// se dibujan directamente donde están
+void renderGameInterpolated(SDL_Renderer *renderer, int originX, int originY, const GameState *previous,
+                            const GameState *current, float alpha)
+{
+    int offsetX = 0;
+    int offsetY = 0;
+    int dx = current->pieceX - previous->pieceX;
+    int dy = current->pieceY - previous->pieceY;
+    if (previous->piecesPlaced == current->piecesPlaced && previous->rotation == current->rotation &&
+        dx >= -1 && dx <= 1 && dy >= 0 && dy <= 1)
+    {
+        offsetX = (int)((alpha - 1.0f) * (float)(dx * CELL_SIZE));
+        offsetY = (int)((alpha - 1.0f) * (float)(dy * CELL_SIZE));
+    }
+
+    drawGrid(renderer, originX, originY, current->grid);
+    if (!current->gameOver)
+        drawPiece(renderer, originX, originY, current->currentPiece, current->currentType, current->pieceX,
+                  current->pieceY, offsetX, offsetY);
+}
+
+// ============ TABLEROS EN MINIATURA ============
+// Para el modo batalla: decenas de tableros chicos. Las celdas fijadas de
+// cada fila se juntan en tramos horizontales y todo se acumula por color,
+// así dibujar 98 tableros cuesta ~10 llamadas a SDL en lugar de ~20.000.
+void renderMiniBoards(SDL_Renderer *renderer, const GameState *games, int count,
+                      int originX, int originY, int columns, int cellSize)
+{
+    if (count > MAX_MINI_BOARDS)
+        count = MAX_MINI_BOARDS;
+
+    int boardWidth = GRID_WIDTH * cellSize;
+    int boardHeight = GRID_HEIGHT * cellSize;
+    int slotWidth = boardWidth + MINI_BOARD_SPACING;
+    int slotHeight = boardHeight + MINI_BOARD_SPACING;
+
+    for (int i = 0; i < count; i++)
+    {
+        const GameState *game = &games[i];
+        int x0 = originX + (i % columns) * slotWidth;
+        int y0 = originY + (i / columns) * slotHeight;
+
+        addRect(game->gameOver ? &deadBatch : &backgroundBatch, x0, y0, boardWidth, boardHeight);
+
+        for (int row = 0; row < GRID_HEIGHT; row++)
+        {
+            int col = 0;
+            while (col < GRID_WIDTH)
+            {
+                if (game->grid[row][col] == 0)
+                {
+                    col++;
+                    continue;
+                }
+                int start = col;
+                while (col < GRID_WIDTH && game->grid[row][col] == 1)
+                {
+                    col++;
+                }
+                addRect(&filledBatch, x0 + start * cellSize, y0 + row * cellSize,
+                        (col - start) * cellSize, cellSize);
+            }
+        }
+
+        if (game->gameOver)
+            continue;
+
+        RectBatch *pieceBatch = &pieceBatches[game->currentType];
+        for (int row = 0; row < 4; row++)
+        {
+            for (int col = 0; col < 4; col++)
+            {
+                int gridRow = game->pieceY + row;
+                int gridCol = game->pieceX + col;
+                if (game->currentPiece[row][col] == 1 && gridRow >= 0 && gridRow < GRID_HEIGHT &&
+                    gridCol >= 0 && gridCol < GRID_WIDTH)
+                {
+                    addRect(pieceBatch, x0 + gridCol * cellSize, y0 + gridRow * cellSize, cellSize, cellSize);
+                }
+            }
+        }
+    }
+
+    SDL_Color gridColor = {COLOR_GRID_R, COLOR_GRID_G, COLOR_GRID_B, COLOR_GRID_A};
+    SDL_Color deadColor = {90, 0, 0, 255};
+    SDL_Color lockedColor = {140, 140, 140, 255};
+    fillBatch(renderer, &backgroundBatch, gridColor);
+    fillBatch(renderer, &deadBatch, deadColor);
+    fillBatch(renderer, &filledBatch, lockedColor);
+    for (int type = 0; type < NUM_PIECES; type++)
+    {
+        fillBatch(renderer, &pieceBatches[type], PIECE_COLORS[type]);
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include <SDL.h>
+#include "constants.h"
+#include "game.h"
+
+#define MAX_MINI_BOARDS 128
+#define MINI_BOARD_SPACING 4 // Píxeles entre tableros en miniatura
+
+// Funciones de dibujo del tablero
+void renderBoard(SDL_Renderer *renderer, int grid[GRID_HEIGHT][GRID_WIDTH],
+                 int currentPiece[4][4], PieceType currentType, int pieceX, int pieceY);
+void renderBoardAt(SDL_Renderer *renderer, int originX, int originY, int grid[GRID_HEIGHT][GRID_WIDTH],
+                   int currentPiece[4][4], PieceType currentType, int pieceX, int pieceY);
+void renderGameInterpolated(SDL_Renderer *renderer, int originX, int originY, const GameState *previous,
+                            const GameState *current, float alpha); // alpha 0 = previous, 1 = current
+void renderMiniBoards(SDL_Renderer *renderer, const GameState *games, int count,
+                      int originX, int originY, int columns, int cellSize);
+
+#endif // RENDER_H
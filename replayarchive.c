@@ -0,0 +1,426 @@
+#include "replayarchive.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define ALIGN8(n) (((n) + 7) & ~(uint64_t)7)
+
+uint32_t replayChecksum(const uint8_t *data, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// ============ ÍNDICE ============
+// Entradas por gameId y dos permutaciones: por puntaje (de mayor a menor)
+// y por semilla. qsort no tiene contexto: las comparaciones de posiciones
+// miran estas entradas (armar un índice no es concurrente).
+
+static const ReplayIndexEntry *sortingEntries;
+
+static int compareById(const void *a, const void *b)
+{
+    const ReplayIndexEntry *x = a;
+    const ReplayIndexEntry *y = b;
+    if (x->gameId != y->gameId)
+        return x->gameId < y->gameId ? -1 : 1;
+    return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+static int compareByScore(const void *a, const void *b)
+{
+    const ReplayIndexEntry *x = &sortingEntries[*(const uint32_t *)a];
+    const ReplayIndexEntry *y = &sortingEntries[*(const uint32_t *)b];
+    if (x->score != y->score)
+        return x->score > y->score ? -1 : 1;
+    return x->gameId < y->gameId ? -1 : x->gameId > y->gameId;
+}
+
+static int compareBySeed(const void *a, const void *b)
+{
+    const ReplayIndexEntry *x = &sortingEntries[*(const uint32_t *)a];
+    const ReplayIndexEntry *y = &sortingEntries[*(const uint32_t *)b];
+    if (x->seed != y->seed)
+        return x->seed < y->seed ? -1 : 1;
+    return x->gameId < y->gameId ? -1 : x->gameId > y->gameId;
+}
+
+static void sortIndex(ReplayIndexEntry *entries, size_t count, uint32_t *byScore, uint32_t *bySeed)
+{
+    qsort(entries, count, sizeof(ReplayIndexEntry), compareById);
+    for (size_t i = 0; i < count; i++)
+    {
+        byScore[i] = (uint32_t)i;
+        bySeed[i] = (uint32_t)i;
+    }
+    sortingEntries = entries;
+    qsort(byScore, count, sizeof(uint32_t), compareByScore);
+    qsort(bySeed, count, sizeof(uint32_t), compareBySeed);
+    sortingEntries = NULL;
+}
+
+// Bytes de entradas + permutaciones (con relleno a 8) antes del pie
+static uint64_t indexSize(uint64_t count)
+{
+    return ALIGN8(count * sizeof(ReplayIndexEntry) + count * 2 * sizeof(uint32_t));
+}
+
+// ============ LECTURA ============
+
+static bool validRecord(const uint8_t *base, uint64_t offset, uint64_t end)
+{
+    if (offset > end || end - offset < sizeof(ReplayRecordHeader))
+        return false;
+    const ReplayRecordHeader *record = (const ReplayRecordHeader *)(base + offset);
+    return record->magic == REPLAY_RECORD_MAGIC && offset + sizeof(ReplayRecordHeader) + record->length <= end;
+}
+
+// El índice del pie viene del archivo: cada entrada tiene que apuntar a un
+// registro entero antes del índice (getReplayData no vuelve a mirar) y los
+// órdenes por puntaje y semilla a entradas que existen
+static bool validIndex(const ReplayArchive *archive)
+{
+    for (size_t i = 0; i < archive->count; i++)
+    {
+        const ReplayIndexEntry *entry = &archive->entries[i];
+        if (entry->offset < sizeof(ReplayArchiveHeader) || entry->offset > archive->recordsEnd ||
+            archive->recordsEnd - entry->offset < sizeof(ReplayRecordHeader) + (uint64_t)entry->length)
+            return false;
+        if (archive->byScore[i] >= archive->count || archive->bySeed[i] >= archive->count)
+            return false;
+    }
+    return true;
+}
+
+// Sin índice al final (el escritor no llegó a cerrar): recorrer los
+// registros hasta el primero incompleto y armar el índice en memoria
+static bool rebuildIndex(ReplayArchive *archive)
+{
+    size_t capacity = 1024;
+    ReplayIndexEntry *entries = malloc(sizeof(ReplayIndexEntry) * capacity);
+    size_t count = 0;
+    uint64_t offset = sizeof(ReplayArchiveHeader);
+    while (entries != NULL && validRecord(archive->base, offset, archive->size))
+    {
+        const ReplayRecordHeader *record = (const ReplayRecordHeader *)(archive->base + offset);
+        if (count == capacity)
+        {
+            capacity *= 2;
+            ReplayIndexEntry *grown = realloc(entries, sizeof(ReplayIndexEntry) * capacity);
+            if (grown == NULL)
+                break;
+            entries = grown;
+        }
+        entries[count++] = (ReplayIndexEntry){record->gameId, offset, record->length, record->seed,
+                                              record->score, record->lines, record->ticks, 0};
+        offset += ALIGN8(sizeof(ReplayRecordHeader) + record->length);
+    }
+
+    // Un solo bloque: entradas y las dos permutaciones
+    size_t entryBytes = sizeof(ReplayIndexEntry) * count;
+    uint8_t *block = malloc(entryBytes + count * 2 * sizeof(uint32_t) + 1);
+    if (entries == NULL || block == NULL)
+    {
+        printf("Error al reservar memoria para el índice\n");
+        free(entries);
+        free(block);
+        return false;
+    }
+    memcpy(block, entries, entryBytes);
+    free(entries);
+
+    archive->ownedIndex = block;
+    archive->entries = (const ReplayIndexEntry *)block;
+    archive->byScore = (const uint32_t *)(block + entryBytes);
+    archive->bySeed = archive->byScore + count;
+    archive->count = count;
+    archive->recordsEnd = offset;
+    archive->rebuilt = true;
+    sortIndex((ReplayIndexEntry *)block, count, (uint32_t *)archive->byScore, (uint32_t *)archive->bySeed);
+    return true;
+}
+
+bool openReplayArchive(ReplayArchive *archive, const char *path)
+{
+    memset(archive, 0, sizeof(*archive));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        printf("Error al abrir %s\n", path);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(ReplayArchiveHeader))
+    {
+        printf("Error: %s no es un archivo de replays\n", path);
+        close(fd);
+        return false;
+    }
+
+    archive->size = (size_t)info.st_size;
+    void *mapping = mmap(NULL, archive->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd); // El mapeo sigue vivo sin el descriptor
+    if (mapping == MAP_FAILED)
+    {
+        printf("Error al mapear %s\n", path);
+        return false;
+    }
+    archive->base = mapping;
+
+    const ReplayArchiveHeader *header = (const ReplayArchiveHeader *)archive->base;
+    if (header->magic != REPLAY_ARCHIVE_MAGIC || header->version != REPLAY_ARCHIVE_VERSION)
+    {
+        printf("Error: %s no es un archivo de replays (o es de otra versión)\n", path);
+        closeReplayArchive(archive);
+        return false;
+    }
+
+    // El pie tiene que cerrar justo al final y el índice caber antes. count
+    // se acota antes de multiplicar, así un pie corrupto no da la vuelta.
+    if (archive->size >= sizeof(ReplayArchiveHeader) + sizeof(ReplayIndexFooter))
+    {
+        const ReplayIndexFooter *footer =
+            (const ReplayIndexFooter *)(archive->base + archive->size - sizeof(ReplayIndexFooter));
+        uint64_t indexSpace = archive->size - sizeof(ReplayArchiveHeader) - sizeof(ReplayIndexFooter);
+        if (footer->magic == REPLAY_INDEX_MAGIC && footer->version == REPLAY_ARCHIVE_VERSION &&
+            footer->count <= indexSpace / (sizeof(ReplayIndexEntry) + 2 * sizeof(uint32_t)) &&
+            footer->indexOffset >= sizeof(ReplayArchiveHeader) && footer->indexOffset % 8 == 0 &&
+            footer->indexOffset <= archive->size &&
+            footer->indexOffset + indexSize(footer->count) + sizeof(ReplayIndexFooter) == archive->size)
+        {
+            archive->entries = (const ReplayIndexEntry *)(archive->base + footer->indexOffset);
+            archive->byScore = (const uint32_t *)(archive->entries + footer->count);
+            archive->bySeed = archive->byScore + footer->count;
+            archive->count = (size_t)footer->count;
+            archive->recordsEnd = footer->indexOffset;
+            if (validIndex(archive))
+                return true;
+            printf("Error: el índice de %s está dañado, se rearma desde los registros\n", path);
+            archive->entries = NULL;
+            archive->byScore = NULL;
+            archive->bySeed = NULL;
+            archive->count = 0;
+            archive->recordsEnd = 0;
+        }
+    }
+
+    if (!rebuildIndex(archive))
+    {
+        closeReplayArchive(archive);
+        return false;
+    }
+    return true;
+}
+
+void closeReplayArchive(ReplayArchive *archive)
+{
+    if (archive->base != NULL)
+        munmap((void *)archive->base, archive->size);
+    free(archive->ownedIndex);
+    memset(archive, 0, sizeof(*archive));
+}
+
+const ReplayIndexEntry *findReplayById(const ReplayArchive *archive, uint64_t gameId)
+{
+    size_t low = 0;
+    size_t high = archive->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (archive->entries[middle].gameId < gameId)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low < archive->count && archive->entries[low].gameId == gameId ? &archive->entries[low] : NULL;
+}
+
+size_t findReplaysBySeed(const ReplayArchive *archive, uint32_t seed, size_t *first)
+{
+    size_t low = 0;
+    size_t high = archive->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (archive->entries[archive->bySeed[middle]].seed < seed)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    *first = low;
+    size_t end = low;
+    while (end < archive->count && archive->entries[archive->bySeed[end]].seed == seed)
+        end++;
+    return end - low;
+}
+
+const ReplayIndexEntry *getReplayByScoreRank(const ReplayArchive *archive, size_t rank)
+{
+    return rank < archive->count ? &archive->entries[archive->byScore[rank]] : NULL;
+}
+
+const uint8_t *getReplayData(const ReplayArchive *archive, const ReplayIndexEntry *entry)
+{
+    return archive->base + entry->offset + sizeof(ReplayRecordHeader);
+}
+
+bool verifyReplay(const ReplayArchive *archive, const ReplayIndexEntry *entry)
+{
+    if (!validRecord(archive->base, entry->offset, archive->recordsEnd))
+        return false;
+    const ReplayRecordHeader *record = (const ReplayRecordHeader *)(archive->base + entry->offset);
+    return record->length == entry->length &&
+           record->checksum == replayChecksum(getReplayData(archive, entry), entry->length);
+}
+
+const ReplayRecordHeader *nextReplayRecord(const ReplayArchive *archive, uint64_t *cursor)
+{
+    if (*cursor < sizeof(ReplayArchiveHeader))
+        *cursor = sizeof(ReplayArchiveHeader);
+    if (!validRecord(archive->base, *cursor, archive->recordsEnd))
+        return NULL;
+    const ReplayRecordHeader *record = (const ReplayRecordHeader *)(archive->base + *cursor);
+    *cursor += ALIGN8(sizeof(ReplayRecordHeader) + record->length);
+    return record;
+}
+
+void adviseReplayArchive(const ReplayArchive *archive, bool sequential)
+{
+    madvise((void *)archive->base, archive->size, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+}
+
+// ============ ESCRITURA ============
+
+static bool growEntries(ReplayArchiveWriter *writer, size_t needed)
+{
+    if (needed <= writer->capacity)
+        return true;
+    size_t capacity = writer->capacity > 0 ? writer->capacity : 1024;
+    while (capacity < needed)
+        capacity *= 2;
+    ReplayIndexEntry *grown = realloc(writer->entries, sizeof(ReplayIndexEntry) * capacity);
+    if (grown == NULL)
+    {
+        printf("Error al reservar memoria para el índice\n");
+        return false;
+    }
+    writer->entries = grown;
+    writer->capacity = capacity;
+    return true;
+}
+
+bool openReplayArchiveWriter(ReplayArchiveWriter *writer, const char *path)
+{
+    memset(writer, 0, sizeof(*writer));
+    writer->nextGameId = 1;
+
+    // Si ya existe: traer su índice (del archivo o reconstruido) y cortar
+    // el archivo donde terminan los registros; el índice se reescribe al cerrar
+    if (access(path, F_OK) == 0)
+    {
+        ReplayArchive existing;
+        if (!openReplayArchive(&existing, path))
+            return false;
+        bool ok = growEntries(writer, existing.count);
+        if (ok)
+        {
+            memcpy(writer->entries, existing.entries, sizeof(ReplayIndexEntry) * existing.count);
+            writer->count = existing.count;
+            writer->offset = existing.recordsEnd;
+            if (existing.count > 0)
+                writer->nextGameId = existing.entries[existing.count - 1].gameId + 1;
+        }
+        closeReplayArchive(&existing);
+
+        writer->file = ok ? fopen(path, "r+b") : NULL;
+        if (writer->file == NULL || ftruncate(fileno(writer->file), (off_t)writer->offset) != 0 ||
+            fseek(writer->file, (long)writer->offset, SEEK_SET) != 0)
+        {
+            printf("Error al reabrir %s para agregar\n", path);
+            if (writer->file != NULL)
+                fclose(writer->file);
+            free(writer->entries);
+            writer->entries = NULL;
+            return false;
+        }
+        return true;
+    }
+
+    writer->file = fopen(path, "wb");
+    if (writer->file == NULL)
+    {
+        printf("Error al crear %s\n", path);
+        return false;
+    }
+    ReplayArchiveHeader header = {REPLAY_ARCHIVE_MAGIC, REPLAY_ARCHIVE_VERSION, {0, 0, 0}};
+    if (fwrite(&header, sizeof(header), 1, writer->file) != 1)
+    {
+        printf("Error al escribir %s\n", path);
+        fclose(writer->file);
+        return false;
+    }
+    writer->offset = sizeof(header);
+    return true;
+}
+
+bool appendReplay(ReplayArchiveWriter *writer, const ReplayInfo *info, const uint8_t *data, uint32_t length)
+{
+    if (!growEntries(writer, writer->count + 1))
+        return false;
+
+    uint64_t gameId = info->gameId != 0 ? info->gameId : writer->nextGameId;
+    if (gameId >= writer->nextGameId)
+        writer->nextGameId = gameId + 1;
+
+    ReplayRecordHeader record = {REPLAY_RECORD_MAGIC, length, gameId, info->seed, info->score, info->lines,
+                                 info->ticks, replayChecksum(data, length), 0};
+    static const uint8_t padding[8] = {0};
+    size_t padLength = (size_t)(ALIGN8(sizeof(record) + length) - sizeof(record) - length);
+    if (fwrite(&record, sizeof(record), 1, writer->file) != 1 || fwrite(data, 1, length, writer->file) != length ||
+        fwrite(padding, 1, padLength, writer->file) != padLength)
+    {
+        printf("Error al escribir el replay %llu\n", (unsigned long long)gameId);
+        return false;
+    }
+
+    writer->entries[writer->count++] = (ReplayIndexEntry){gameId, writer->offset, length, info->seed,
+                                                          info->score, info->lines, info->ticks, 0};
+    writer->offset += sizeof(record) + length + padLength;
+    return true;
+}
+
+bool closeReplayArchiveWriter(ReplayArchiveWriter *writer)
+{
+    size_t count = writer->count;
+    uint32_t *order = malloc(sizeof(uint32_t) * 2 * count + 1);
+    bool ok = order != NULL;
+    if (ok)
+    {
+        sortIndex(writer->entries, count, order, order + count);
+        static const uint8_t padding[8] = {0};
+        size_t used = sizeof(ReplayIndexEntry) * count + sizeof(uint32_t) * 2 * count;
+        size_t padLength = (size_t)(indexSize(count) - used);
+        ReplayIndexFooter footer = {writer->offset, count, REPLAY_INDEX_MAGIC, REPLAY_ARCHIVE_VERSION};
+        ok = fwrite(writer->entries, sizeof(ReplayIndexEntry), count, writer->file) == count &&
+             fwrite(order, sizeof(uint32_t), 2 * count, writer->file) == 2 * count &&
+             fwrite(padding, 1, padLength, writer->file) == padLength &&
+             fwrite(&footer, sizeof(footer), 1, writer->file) == 1;
+    }
+    if (fclose(writer->file) != 0)
+        ok = false;
+    if (!ok)
+        printf("Error al escribir el índice del archivo de replays\n");
+
+    free(order);
+    free(writer->entries);
+    memset(writer, 0, sizeof(*writer));
+    return ok;
+}
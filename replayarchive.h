@@ -0,0 +1,147 @@
+#ifndef REPLAYARCHIVE_H
+#define REPLAYARCHIVE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// ============ ARCHIVO DE REPLAYS ============
+// Millones de partidas en un solo archivo en vez de un .tstr por partida:
+//
+//   [ReplayArchiveHeader]
+//   [ReplayRecordHeader + stream .tstr] [ReplayRecordHeader + stream] ...
+//   [índice: ReplayIndexEntry por id] [orden por puntaje] [orden por semilla]
+//   [ReplayIndexFooter]
+//
+// Los registros solo se agregan al final. El payload es el stream de
+// espectador tal cual (keyframes + deltas con varints, ver stream.h), que
+// ya es la forma comprimida de la partida, con su "TSTR" al principio: se
+// puede pasar directo a --watch o a replayvideo. Cada registro empieza
+// alineado a 8 bytes.
+//
+// Al cerrar, el escritor agrega el índice al final. Si el proceso muere
+// antes, el archivo queda sin índice pero los registros se pueden recorrer
+// igual (cada uno lleva su largo y su magic), y el lector lo reconstruye.
+// Al reabrir para agregar, el índice viejo se descarta y se reescribe.
+//
+// El lector mapea el archivo con mmap y devuelve punteros al payload dentro
+// del mapeo, sin copiar. Formato little-endian.
+
+#define REPLAY_ARCHIVE_MAGIC 0x41505254u // "TRPA"
+#define REPLAY_RECORD_MAGIC 0x43455254u  // "TREC"
+#define REPLAY_INDEX_MAGIC 0x49505254u   // "TRPI"
+#define REPLAY_ARCHIVE_VERSION 1
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t reserved[3];
+} ReplayArchiveHeader;
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t length;   // Bytes del payload (sin este encabezado ni el relleno)
+    uint64_t gameId;
+    uint32_t seed;
+    int32_t score;
+    int32_t lines;
+    uint32_t ticks;
+    uint32_t checksum; // FNV-1a del payload
+    uint32_t reserved;
+} ReplayRecordHeader;
+
+typedef struct
+{
+    uint64_t gameId;
+    uint64_t offset; // Del ReplayRecordHeader dentro del archivo
+    uint32_t length;
+    uint32_t seed;
+    int32_t score;
+    int32_t lines;
+    uint32_t ticks;
+    uint32_t reserved;
+} ReplayIndexEntry;
+
+typedef struct
+{
+    uint64_t indexOffset; // Donde empiezan las entradas
+    uint64_t count;
+    uint32_t magic;
+    uint32_t version;
+} ReplayIndexFooter;
+
+_Static_assert(sizeof(ReplayArchiveHeader) == 32, "El layout del encabezado es parte del formato");
+_Static_assert(sizeof(ReplayRecordHeader) == 40, "El layout del registro es parte del formato");
+_Static_assert(sizeof(ReplayIndexEntry) == 40, "El layout del índice es parte del formato");
+_Static_assert(sizeof(ReplayIndexFooter) == 24, "El layout del pie es parte del formato");
+
+// Datos de una partida para agregarla (gameId 0 = el siguiente libre)
+typedef struct
+{
+    uint64_t gameId;
+    uint32_t seed;
+    int32_t score;
+    int32_t lines;
+    uint32_t ticks;
+} ReplayInfo;
+
+// ============ ESCRITURA ============
+
+typedef struct
+{
+    FILE *file;
+    uint64_t offset; // Fin de los registros
+    ReplayIndexEntry *entries;
+    size_t count;
+    size_t capacity;
+    uint64_t nextGameId;
+} ReplayArchiveWriter;
+
+// Crea el archivo o lo reabre para agregar al final
+bool openReplayArchiveWriter(ReplayArchiveWriter *writer, const char *path);
+bool appendReplay(ReplayArchiveWriter *writer, const ReplayInfo *info, const uint8_t *data, uint32_t length);
+// Escribe el índice y cierra
+bool closeReplayArchiveWriter(ReplayArchiveWriter *writer);
+
+// ============ LECTURA ============
+
+typedef struct
+{
+    const uint8_t *base; // Mapeo de todo el archivo
+    size_t size;
+    const ReplayIndexEntry *entries; // Ordenadas por gameId
+    const uint32_t *byScore;         // Posiciones en entries, de mayor a menor puntaje
+    const uint32_t *bySeed;          // Posiciones en entries, por semilla
+    size_t count;
+    uint64_t recordsEnd; // Donde termina el último registro completo
+    bool rebuilt;        // El archivo no tenía índice (se armó recorriéndolo)
+    void *ownedIndex;    // Índice reconstruido en memoria (NULL si es el del archivo)
+} ReplayArchive;
+
+bool openReplayArchive(ReplayArchive *archive, const char *path);
+void closeReplayArchive(ReplayArchive *archive);
+
+const ReplayIndexEntry *findReplayById(const ReplayArchive *archive, uint64_t gameId);
+// Entradas con esa semilla: devuelve cuántas hay y *first apunta a la primera
+// posición en bySeed
+size_t findReplaysBySeed(const ReplayArchive *archive, uint32_t seed, size_t *first);
+const ReplayIndexEntry *getReplayByScoreRank(const ReplayArchive *archive, size_t rank); // 0 = el mejor
+
+// Puntero al stream dentro del mapeo (sin copiar)
+const uint8_t *getReplayData(const ReplayArchive *archive, const ReplayIndexEntry *entry);
+bool verifyReplay(const ReplayArchive *archive, const ReplayIndexEntry *entry);
+
+// Recorrido secuencial en el orden del archivo; *cursor empieza en 0.
+// Devuelve NULL al final.
+const ReplayRecordHeader *nextReplayRecord(const ReplayArchive *archive, uint64_t *cursor);
+
+// Indicaciones al kernel para el mapeo: secuencial (lectura anticipada
+// agresiva) para recorrer todo, aleatorio para saltar por el índice
+void adviseReplayArchive(const ReplayArchive *archive, bool sequential);
+
+uint32_t replayChecksum(const uint8_t *data, size_t length);
+
+#endif // REPLAYARCHIVE_H
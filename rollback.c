@@ -0,0 +1,214 @@
+#include "rollback.h"
+#include <string.h>
+#include <time.h>
+
+// Basura enviada según las líneas eliminadas de una vez
+static const int GARBAGE_TABLE[5] = {0, 0, 1, 2, 4};
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// ============ MODO VERSUS ============
+
+void initVersus(VersusState *versus, uint32_t seed)
+{
+    memset(versus, 0, sizeof(*versus));
+
+    // Misma secuencia de piezas para los dos jugadores
+    initGame(&versus->players[0], seed);
+    initGame(&versus->players[1], seed);
+    versus->garbageRng = seed ^ 0xA5A5A5A5u;
+    if (versus->garbageRng == 0)
+        versus->garbageRng = 1;
+    versus->winner = VERSUS_NO_WINNER;
+}
+
+void stepVersus(VersusState *versus, unsigned inputs0, unsigned inputs1)
+{
+    if (versus->winner != VERSUS_NO_WINNER)
+        return;
+
+    unsigned inputs[2] = {inputs0, inputs1};
+    int lines[2];
+    bool locked[2];
+
+    for (int p = 0; p < 2; p++)
+    {
+        int piecesBefore = versus->players[p].piecesPlaced;
+        lines[p] = stepGame(&versus->players[p], inputs[p]);
+        locked[p] = versus->players[p].piecesPlaced != piecesBefore;
+    }
+
+    // Las líneas primero cancelan la basura propia pendiente
+    for (int p = 0; p < 2; p++)
+    {
+        int attack = GARBAGE_TABLE[lines[p] > 4 ? 4 : lines[p]];
+        int cancelled = attack < versus->pendingGarbage[p] ? attack : versus->pendingGarbage[p];
+        versus->pendingGarbage[p] -= cancelled;
+        versus->pendingGarbage[1 - p] += attack - cancelled;
+    }
+
+    // La basura entra cuando el jugador fija una pieza sin limpiar líneas
+    for (int p = 0; p < 2; p++)
+    {
+        if (locked[p] && lines[p] == 0 && versus->pendingGarbage[p] > 0)
+        {
+            int hole = (int)(nextRandom(&versus->garbageRng) % GRID_WIDTH);
+            addGarbageLines(&versus->players[p], versus->pendingGarbage[p], hole);
+            versus->pendingGarbage[p] = 0;
+        }
+    }
+
+    versus->frame++;
+
+    bool over0 = versus->players[0].gameOver;
+    bool over1 = versus->players[1].gameOver;
+    if (over0 && over1)
+        versus->winner = VERSUS_DRAW;
+    else if (over0)
+        versus->winner = 1;
+    else if (over1)
+        versus->winner = 0;
+}
+
+// FNV-1a sobre los campos que definen la simulación (sin padding)
+static uint32_t hashBytes(uint32_t hash, const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t versusChecksum(const VersusState *versus)
+{
+    uint32_t hash = 2166136261u;
+    for (int p = 0; p < 2; p++)
+    {
+        const GameState *game = &versus->players[p];
+        int fields[] = {game->currentType, game->rotation, game->pieceX, game->pieceY,
+                        game->score, game->totalLinesCleared, game->piecesPlaced, game->gameOver,
+                        game->fallCounter, game->moveCooldown, game->rotateCooldown,
+                        versus->pendingGarbage[p]};
+        hash = hashBytes(hash, game->grid, sizeof(game->grid));
+        hash = hashBytes(hash, fields, sizeof(fields));
+        hash = hashBytes(hash, &game->rngState, sizeof(game->rngState));
+    }
+    hash = hashBytes(hash, &versus->garbageRng, sizeof(versus->garbageRng));
+    hash = hashBytes(hash, &versus->frame, sizeof(versus->frame));
+    return hash;
+}
+
+// ============ ROLLBACK ============
+
+void initRollback(RollbackSession *session, uint32_t seed, int localPlayer)
+{
+    memset(session, 0, sizeof(*session));
+    initVersus(&session->state, seed);
+    session->localPlayer = localPlayer;
+    session->rollbackFrom = ROLLBACK_NONE;
+}
+
+static bool isRemoteConfirmed(const RollbackSession *session, uint32_t frame)
+{
+    return session->remoteTags[frame % INPUT_HISTORY] == frame + 1;
+}
+
+// Predicción: el rival sigue apretando lo mismo que en su último input conocido
+static uint8_t predictRemoteInput(const RollbackSession *session)
+{
+    if (session->confirmedFrame == 0)
+        return 0;
+    return session->inputs[1 - session->localPlayer][(session->confirmedFrame - 1) % INPUT_HISTORY];
+}
+
+// Simula un frame guardando antes el snapshot para poder volver a él
+static void simulateFrame(RollbackSession *session, uint32_t frame)
+{
+    int remote = 1 - session->localPlayer;
+    uint32_t slot = frame % INPUT_HISTORY;
+
+    if (!isRemoteConfirmed(session, frame))
+        session->inputs[remote][slot] = predictRemoteInput(session);
+
+    session->snapshots[frame % (ROLLBACK_WINDOW + 1)] = session->state;
+    stepVersus(&session->state, session->inputs[0][slot], session->inputs[1][slot]);
+}
+
+void rollbackAddRemoteInput(RollbackSession *session, uint32_t frame, uint8_t input)
+{
+    // Repetido, o demasiado adelantado para el historial
+    if (isRemoteConfirmed(session, frame) || frame < session->confirmedFrame ||
+        frame >= session->confirmedFrame + INPUT_HISTORY)
+        return;
+
+    int remote = 1 - session->localPlayer;
+    uint32_t slot = frame % INPUT_HISTORY;
+
+    // Ese frame ya se simuló con una predicción equivocada
+    if (frame < session->frame && session->inputs[remote][slot] != input &&
+        (session->rollbackFrom == ROLLBACK_NONE || frame < session->rollbackFrom))
+    {
+        session->rollbackFrom = frame;
+    }
+
+    session->inputs[remote][slot] = input;
+    session->remoteTags[slot] = frame + 1;
+
+    while (isRemoteConfirmed(session, session->confirmedFrame))
+    {
+        session->confirmedFrame++;
+    }
+}
+
+// Si hubo una predicción fallida, vuelve a ese frame y re-simula hasta el actual
+void rollbackResolve(RollbackSession *session)
+{
+    if (session->rollbackFrom == ROLLBACK_NONE)
+        return;
+
+    uint64_t start = nowNs();
+    uint32_t from = session->rollbackFrom;
+    session->state = session->snapshots[from % (ROLLBACK_WINDOW + 1)];
+    for (uint32_t frame = from; frame < session->frame; frame++)
+    {
+        simulateFrame(session, frame);
+    }
+
+    uint64_t elapsed = nowNs() - start;
+    uint32_t frames = session->frame - from;
+    session->stats.rollbacks++;
+    session->stats.framesResimulated += frames;
+    if (frames > session->stats.maxRollbackFrames)
+        session->stats.maxRollbackFrames = frames;
+    session->stats.resimulateNs += elapsed;
+    if (elapsed > session->stats.maxResimulateNs)
+        session->stats.maxResimulateNs = elapsed;
+    session->rollbackFrom = ROLLBACK_NONE;
+}
+
+// Avanza un frame con el input local. Devuelve false si el rival va
+// demasiado atrasado (más de ROLLBACK_WINDOW frames sin confirmar): en ese
+// caso no se simula y hay que volver a intentar en el próximo tick.
+bool rollbackAdvance(RollbackSession *session, uint8_t localInput)
+{
+    rollbackResolve(session);
+
+    if (session->frame - session->confirmedFrame >= ROLLBACK_WINDOW)
+    {
+        session->stats.stalls++;
+        return false;
+    }
+
+    session->inputs[session->localPlayer][session->frame % INPUT_HISTORY] = localInput;
+    simulateFrame(session, session->frame);
+    session->frame++;
+    return true;
+}
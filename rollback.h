@@ -0,0 +1,68 @@
+#ifndef ROLLBACK_H
+#define ROLLBACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "game.h"
+
+// ============ MODO VERSUS ============
+// Dos partidas que avanzan juntas tick a tick. Las líneas eliminadas se
+// mandan como basura al rival y entran cuando el rival fija su próxima
+// pieza sin limpiar. Todo es determinista: ambos procesos simulan las dos
+// partidas y solo intercambian inputs.
+
+#define VERSUS_NO_WINNER -1
+#define VERSUS_DRAW 2
+
+typedef struct
+{
+    GameState players[2];
+    int pendingGarbage[2]; // Líneas de basura esperando entrar
+    uint32_t garbageRng;   // Columna del hueco de la basura
+    uint32_t frame;
+    int winner; // VERSUS_NO_WINNER, 0, 1 o VERSUS_DRAW
+} VersusState;
+
+void initVersus(VersusState *versus, uint32_t seed);
+void stepVersus(VersusState *versus, unsigned inputs0, unsigned inputs1);
+uint32_t versusChecksum(const VersusState *versus);
+
+// ============ ROLLBACK ============
+// Cada peer simula sin esperar al otro: el input remoto que todavía no
+// llegó se predice (se repite el último confirmado). Cuando llega un input
+// distinto al predicho se restaura el snapshot de ese frame y se
+// re-simulan los frames siguientes con los inputs corregidos.
+
+#define ROLLBACK_WINDOW 10    // Máximo de frames sin confirmar antes de frenar
+#define INPUT_HISTORY 256     // Inputs guardados por jugador (potencia de 2)
+#define ROLLBACK_NONE UINT32_MAX
+
+typedef struct
+{
+    uint32_t rollbacks;          // Predicciones corregidas
+    uint32_t framesResimulated;
+    uint32_t maxRollbackFrames;
+    uint32_t stalls;             // Frames en los que hubo que esperar al rival
+    uint64_t resimulateNs;       // Tiempo total re-simulando
+    uint64_t maxResimulateNs;    // Peor rollback individual
+} RollbackStats;
+
+typedef struct
+{
+    VersusState state; // Estado en `frame` (con inputs remotos predichos)
+    VersusState snapshots[ROLLBACK_WINDOW + 1]; // Estado al inicio de cada frame sin confirmar
+    uint8_t inputs[2][INPUT_HISTORY];           // Inputs usados (o confirmados) por frame
+    uint32_t remoteTags[INPUT_HISTORY];         // frame + 1 si el input remoto está confirmado
+    int localPlayer;
+    uint32_t frame;          // Próximo frame a simular
+    uint32_t confirmedFrame; // Todos los inputs remotos anteriores están confirmados
+    uint32_t rollbackFrom;   // Primer frame mal predicho (ROLLBACK_NONE = ninguno)
+    RollbackStats stats;
+} RollbackSession;
+
+void initRollback(RollbackSession *session, uint32_t seed, int localPlayer);
+void rollbackAddRemoteInput(RollbackSession *session, uint32_t frame, uint8_t input);
+void rollbackResolve(RollbackSession *session);
+bool rollbackAdvance(RollbackSession *session, uint8_t localInput);
+
+#endif // ROLLBACK_H
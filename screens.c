@@ -0,0 +1,760 @@
+#include "screens.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "database.h"
+#include "game.h"
+#include "journal.h"
+#include "latencyview.h"
+#include "metrics.h"
+#include "profiler.h"
+#include "render.h"
+#include "ui.h"
+
+#define MAX_CATCHUP_TICKS 4 // Tras una pausa larga no simular más de esto de golpe
+#define TOP_SCORES_POLL_MS 50 // Cada cuánto mira el menú si ya llegó el Top 10
+
+typedef enum
+{
+    SCREEN_MENU,
+    SCREEN_GAME,
+    SCREEN_GAME_OVER
+} ScreenType;
+
+// Menú principal con opciones: Jugar y Ver Top 10
+typedef enum
+{
+    MAIN_MENU,
+    TOP_SCORES_SCREEN,
+    ENTER_NAME_SCREEN
+} MenuState;
+
+typedef struct
+{
+    MenuState state;
+    TextField nameField;
+    Button playButton;
+    Button topScoresButton;
+    Button exitButton;
+    Button startButton;
+    Button backButton;
+    Score scores[10];
+    int scoreCount;   // Se piden al entrar al Top 10 (-1 = todavía no llegaron)
+    Uint32 cursorPhase; // Fase del parpadeo que se dibujó por última vez
+} MenuScreen;
+
+typedef struct
+{
+    GameState current;
+    GameState previous; // Estado del tick anterior, para interpolar
+    unsigned held;
+    unsigned tapped; // Apretadas desde el último tick (un toque corto no se pierde)
+    Journal journal; // Autoguardado por si el proceso muere a mitad de partida
+} GameScreen;
+
+typedef struct
+{
+    Button menuButton;
+    int score;
+    int lines;
+} GameOverScreen;
+
+typedef struct
+{
+    ScreenType type;
+    bool dirty; // Menú y Game Over: algo cambió y hay que redibujar
+    union
+    {
+        MenuScreen menu;
+        GameScreen game;
+        GameOverScreen gameOver;
+    };
+} Screen;
+
+typedef struct
+{
+    SDL_Window *window;
+    SDL_Renderer *renderer;
+    EventLog *eventLog;
+    Screen stack[MAX_SCREENS];
+    int depth;
+    char username[50];
+    bool quit;
+    LatencyRun *latency; // --latency: mide tecla -> pantalla en este mismo loop (NULL si no)
+} App;
+
+// ============ PILA ============
+
+static Screen *topScreen(App *app)
+{
+    return &app->stack[app->depth - 1];
+}
+
+static void initMenuScreen(MenuScreen *menu)
+{
+    int centerX = WINDOW_WIDTH / 2;
+    memset(menu, 0, sizeof(*menu));
+    menu->state = MAIN_MENU;
+
+    // Campo de texto para nombre (centrado)
+    menu->nameField = createTextField(centerX - 150, 180, 300, 40, false);
+    menu->nameField.isActive = false;
+
+    // Botones del menú principal (centrados)
+    menu->playButton = createButton(centerX - 100, 200, 200, 50, "JUGAR");
+    menu->topScoresButton = createButton(centerX - 100, 260, 200, 50, "Top 10");
+    menu->exitButton = createButton(centerX - 100, 320, 200, 50, "Salir");
+
+    // Botones para pantalla de nombre (centrados)
+    menu->startButton = createButton(centerX - 100, 280, 200, 50, "Comenzar");
+    menu->backButton = createButton(centerX - 100, 340, 200, 50, "Volver");
+}
+
+static Screen *pushScreen(App *app, ScreenType type)
+{
+    if (app->depth == MAX_SCREENS)
+        return NULL;
+    Screen *screen = &app->stack[app->depth++];
+    memset(screen, 0, sizeof(*screen));
+    screen->type = type;
+    screen->dirty = true;
+    return screen;
+}
+
+static void popScreen(App *app)
+{
+    Screen *screen = topScreen(app);
+    if (screen->type == SCREEN_GAME)
+    {
+        // Tabla de mejores puntajes (consulta a la base): en el hilo de
+        // guardado, después del puntaje de esta partida
+        printTopScoresAsync();
+    }
+    app->depth--;
+
+    // Volver al menú lo deja como al principio
+    if (app->depth > 0 && topScreen(app)->type == SCREEN_MENU)
+    {
+        initMenuScreen(&topScreen(app)->menu);
+        topScreen(app)->dirty = true;
+    }
+}
+
+// ============ PARTIDA ============
+
+static uint32_t randomSeed(void)
+{
+    return (uint32_t)time(NULL) ^ (uint32_t)SDL_GetPerformanceCounter();
+}
+
+// Modo latencia con teclas inyectadas: las partidas no son de nadie, no
+// se autoguardan ni pisan el journal de una partida real sin terminar
+static bool injectingLatency(const App *app)
+{
+    return app->latency != NULL && app->latency->config.injectCount > 0;
+}
+
+static void startGame(App *app, uint32_t seed)
+{
+    eventLogPushText(app->eventLog, EVENT_GAME_STARTED, 0, app->username);
+    metricsAdd(METRIC_GAMES_STARTED, 1);
+
+    Screen *screen = pushScreen(app, SCREEN_GAME);
+    if (screen == NULL)
+        return;
+    initGame(&screen->game.current, seed);
+    screen->game.previous = screen->game.current;
+    if (!injectingLatency(app))
+        journalBegin(&screen->game.journal, JOURNAL_PATH, app->username, &screen->game.current);
+}
+
+// Al perder se sigue con otra partida, sin Game Over ni puntaje
+static void restartGame(App *app, GameScreen *game)
+{
+    initGame(&game->current, nextRandom(&app->latency->rng));
+    game->previous = game->current;
+}
+
+// Una partida terminó pero el proceso murió antes de guardar su puntaje
+static void recoverPendingSave(void)
+{
+    char username[50];
+    GameState state;
+    int replayed;
+    if (!journalResume(JOURNAL_PENDING_PATH, username, sizeof(username), &state, &replayed))
+    {
+        remove(JOURNAL_PENDING_PATH); // Dañado (o no estaba): no hay nada que guardar
+        return;
+    }
+    // El resultado llega al log de eventos como cualquier otro guardado
+    saveScoreAsync(username, state.score, state.totalLinesCleared, state.tick, JOURNAL_PENDING_PATH);
+}
+
+// Retoma la partida que quedó sin terminar la última vez que se cerró el juego
+static void resumeGame(App *app)
+{
+    GameState state;
+    int replayed;
+    uint64_t start = metricsNowNs();
+    if (!journalResume(JOURNAL_PATH, app->username, sizeof(app->username), &state, &replayed))
+        return;
+    uint64_t elapsedUs = (metricsNowNs() - start) / 1000;
+
+    Screen *screen = pushScreen(app, SCREEN_GAME);
+    if (screen == NULL)
+        return;
+    screen->game.current = state;
+    screen->game.previous = state;
+    journalBegin(&screen->game.journal, JOURNAL_PATH, app->username, &state);
+    eventLogPushText(app->eventLog, EVENT_GAME_STARTED, state.tick, app->username);
+    eventLogPush(app->eventLog, EVENT_GAME_RESUMED, state.tick, state.score, replayed, (int32_t)elapsedUs);
+}
+
+// Guarda el puntaje al terminar la partida (Game Over, ESC o cerrar)
+static void finishGame(App *app, GameScreen *game, EventType reason)
+{
+    const GameState *state = &game->current;
+    eventLogPush(app->eventLog, reason, state->tick, state->score, state->totalLinesCleared, 0);
+
+    // El guardado va al hilo de la base; el journal queda como pendiente
+    // hasta que se confirme. Hay un solo archivo pendiente: si el guardado
+    // anterior todavía no terminó (dos partidas seguidas en milisegundos),
+    // se espera a ese antes de pisarlo.
+    waitScoreSaves();
+    bool handedOff = journalHandOff(&game->journal, JOURNAL_PENDING_PATH);
+    saveScoreAsync(app->username, state->score, state->totalLinesCleared, state->tick,
+                   handedOff ? JOURNAL_PENDING_PATH : NULL);
+    metricsAdd(METRIC_GAMES_FINISHED, 1);
+}
+
+// Resultados del hilo de guardado al log de eventos (que solo acepta
+// eventos de este hilo)
+static void reportScoreSaves(App *app)
+{
+    ScoreSaveResult results[8];
+    int count = takeScoreSaveResults(results, 8);
+    for (int i = 0; i < count; i++)
+        eventLogPush(app->eventLog, EVENT_SCORE_SAVED, results[i].tick, results[i].score, results[i].saved, 0);
+}
+
+// Un tick fijo de simulación
+static void tickGame(App *app, GameScreen *game)
+{
+    GameState *state = &game->current;
+    game->previous = *state;
+
+    unsigned inputs = game->held | game->tapped;
+    game->tapped = 0;
+
+    int placed = state->piecesPlaced;
+    int score = state->score;
+    int linesCleared = stepGame(state, inputs);
+    journalRecord(&game->journal, inputs, state);
+    if (app->latency != NULL)
+        latencyTick(app->latency, &game->previous, state, inputs);
+
+    if (state->piecesPlaced != placed)
+        metricsAdd(METRIC_PIECES_PLACED, 1);
+    if (linesCleared > 0)
+    {
+        metricsLinesCleared(linesCleared);
+        eventLogPush(app->eventLog, EVENT_LINES_CLEARED, state->tick, linesCleared, state->score - score,
+                     state->score);
+    }
+}
+
+static void showGameOver(App *app)
+{
+    GameScreen *game = &topScreen(app)->game;
+    finishGame(app, game, EVENT_GAME_OVER);
+
+    int score = game->current.score;
+    int lines = game->current.totalLinesCleared;
+    Screen *screen = pushScreen(app, SCREEN_GAME_OVER);
+    if (screen == NULL)
+        return;
+    screen->gameOver.menuButton = createButton(WINDOW_WIDTH / 2 - 100, 400, 200, 50, "Menu Principal");
+    screen->gameOver.score = score;
+    screen->gameOver.lines = lines;
+}
+
+static void handleGameEvent(App *app, GameScreen *game, SDL_Event *event)
+{
+    if (event->type == SDL_QUIT)
+    {
+        finishGame(app, game, EVENT_GAME_SAVED);
+        app->quit = true; // Salir de la aplicación completa
+        return;
+    }
+
+    // ESC guarda y vuelve al menú principal
+    if (event->type == SDL_KEYDOWN && event->key.keysym.sym == SDLK_ESCAPE)
+    {
+        finishGame(app, game, EVENT_GAME_SAVED);
+        popScreen(app);
+        return;
+    }
+
+    game->held = updateHeldInputs(game->held, event);
+    if (event->type == SDL_KEYDOWN && !event->key.repeat)
+    {
+        unsigned input = keyToInput(event->key.keysym.sym);
+        game->tapped |= input;
+        if (app->latency != NULL)
+            latencyKeyDown(app->latency, input, event->key.timestamp);
+    }
+}
+
+static void renderGame(SDL_Renderer *renderer, const GameScreen *game, float alpha)
+{
+    SDL_SetRenderDrawColor(renderer, COLOR_BACKGROUND_R, COLOR_BACKGROUND_G, COLOR_BACKGROUND_B, COLOR_BACKGROUND_A);
+    SDL_RenderClear(renderer);
+    renderGameInterpolated(renderer, BOARD_OFFSET_X, BOARD_OFFSET_Y, &game->previous, &game->current, alpha);
+}
+
+// ============ MENÚ ============
+
+static void handleMenuEvent(App *app, Screen *screen, SDL_Event *event)
+{
+    MenuScreen *menu = &screen->menu;
+
+    if (event->type == SDL_QUIT)
+    {
+        app->quit = true;
+        return;
+    }
+
+    if (event->type == SDL_MOUSEBUTTONDOWN)
+    {
+        int mouseX, mouseY;
+        SDL_GetMouseState(&mouseX, &mouseY);
+
+        if (menu->state == MAIN_MENU)
+        {
+            if (isButtonClicked(&menu->playButton, mouseX, mouseY))
+            {
+                menu->state = ENTER_NAME_SCREEN;
+                menu->nameField.isActive = true;
+                SDL_StartTextInput();
+            }
+            else if (isButtonClicked(&menu->topScoresButton, mouseX, mouseY))
+            {
+                menu->state = TOP_SCORES_SCREEN;
+                menu->scoreCount = -1;
+                getTopScoresAsync(); // La consulta va al hilo de la base
+            }
+            else if (isButtonClicked(&menu->exitButton, mouseX, mouseY))
+            {
+                app->quit = true;
+                return;
+            }
+        }
+        else if (menu->state == ENTER_NAME_SCREEN)
+        {
+            menu->nameField.isActive = isButtonClicked((Button *)&menu->nameField, mouseX, mouseY);
+
+            if (isButtonClicked(&menu->startButton, mouseX, mouseY))
+            {
+                if (strlen(menu->nameField.text) > 0)
+                {
+                    strcpy(app->username, menu->nameField.text);
+                    SDL_StopTextInput();
+                    startGame(app, randomSeed()); // Jugar
+                    return;
+                }
+            }
+            else if (isButtonClicked(&menu->backButton, mouseX, mouseY))
+            {
+                menu->state = MAIN_MENU;
+                menu->nameField.text[0] = '\0';
+                SDL_StopTextInput();
+            }
+        }
+        else if (menu->state == TOP_SCORES_SCREEN)
+        {
+            if (isButtonClicked(&menu->backButton, mouseX, mouseY))
+            {
+                menu->state = MAIN_MENU;
+            }
+        }
+    }
+
+    // Manejar input de teclado
+    if (menu->state == ENTER_NAME_SCREEN)
+    {
+        if (event->type == SDL_KEYDOWN && event->key.keysym.sym == SDLK_RETURN)
+        {
+            if (strlen(menu->nameField.text) > 0)
+            {
+                strcpy(app->username, menu->nameField.text);
+                SDL_StopTextInput();
+                startGame(app, randomSeed()); // Jugar
+                return;
+            }
+        }
+        else if (event->type == SDL_KEYDOWN && event->key.keysym.sym == SDLK_ESCAPE)
+        {
+            menu->state = MAIN_MENU;
+            menu->nameField.text[0] = '\0';
+            SDL_StopTextInput();
+        }
+        else
+        {
+            handleTextFieldInput(&menu->nameField, event);
+        }
+    }
+    else if (event->type == SDL_KEYDOWN && event->key.keysym.sym == SDLK_ESCAPE)
+    {
+        if (menu->state == TOP_SCORES_SCREEN)
+        {
+            menu->state = MAIN_MENU;
+        }
+    }
+
+    // Actualizar hover de botones (mover el mouse solo redibuja si cambia)
+    int mouseX, mouseY;
+    SDL_GetMouseState(&mouseX, &mouseY);
+    if (menu->state == MAIN_MENU)
+    {
+        screen->dirty |= updateButtonHover(&menu->playButton, mouseX, mouseY);
+        screen->dirty |= updateButtonHover(&menu->topScoresButton, mouseX, mouseY);
+        screen->dirty |= updateButtonHover(&menu->exitButton, mouseX, mouseY);
+    }
+    else if (menu->state == ENTER_NAME_SCREEN)
+    {
+        screen->dirty |= updateButtonHover(&menu->startButton, mouseX, mouseY);
+        screen->dirty |= updateButtonHover(&menu->backButton, mouseX, mouseY);
+    }
+    else if (menu->state == TOP_SCORES_SCREEN)
+    {
+        screen->dirty |= updateButtonHover(&menu->backButton, mouseX, mouseY);
+    }
+}
+
+static bool menuBlinking(const MenuScreen *menu)
+{
+    return menu->state == ENTER_NAME_SCREEN && menu->nameField.isActive;
+}
+
+static bool menuLoadingScores(const MenuScreen *menu)
+{
+    return menu->state == TOP_SCORES_SCREEN && menu->scoreCount < 0;
+}
+
+// Si el hilo de la base ya respondió el Top 10, mostrarlo
+static void pollTopScores(Screen *screen)
+{
+    if (screen->type != SCREEN_MENU || !menuLoadingScores(&screen->menu))
+        return;
+    int count = takeTopScores(screen->menu.scores, 10);
+    if (count >= 0)
+    {
+        screen->menu.scoreCount = count;
+        screen->dirty = true;
+    }
+}
+
+static void renderMenu(SDL_Renderer *renderer, MenuScreen *menu)
+{
+    SDL_SetRenderDrawColor(renderer, 20, 20, 30, 255);
+    SDL_RenderClear(renderer);
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color cyan = {0, 240, 240, 255};
+    SDL_Color gray = {150, 150, 150, 255};
+
+    if (menu->state == MAIN_MENU)
+    {
+        renderTextCentered(renderer, "TETRIS EN C", WINDOW_WIDTH / 2, 80, cyan);
+        renderButton(renderer, &menu->playButton);
+        renderButton(renderer, &menu->topScoresButton);
+        renderButton(renderer, &menu->exitButton);
+    }
+    else if (menu->state == ENTER_NAME_SCREEN)
+    {
+        renderTextCentered(renderer, "INGRESA TU NOMBRE", WINDOW_WIDTH / 2, 80, white);
+        renderTextCentered(renderer, "Nombre:", WINDOW_WIDTH / 2, 150, white);
+        renderTextField(renderer, &menu->nameField);
+        renderButton(renderer, &menu->startButton);
+        renderButton(renderer, &menu->backButton);
+    }
+    else if (menu->state == TOP_SCORES_SCREEN)
+    {
+        renderTextCentered(renderer, "TOP 10 PUNTAJES", WINDOW_WIDTH / 2, 30, cyan);
+
+        if (menu->scoreCount < 0)
+            renderTextCentered(renderer, "Cargando...", WINDOW_WIDTH / 2, 70, gray);
+
+        for (int i = 0; i < menu->scoreCount && i < 8; i++)
+        {
+            char line[150];
+            snprintf(line, sizeof(line), "%d. %s - %d pts - %s", i + 1, menu->scores[i].username,
+                     menu->scores[i].score, menu->scores[i].date);
+            renderTextCentered(renderer, line, WINDOW_WIDTH / 2, 70 + i * 30, gray);
+        }
+
+        menu->backButton.rect.y = 520;
+        menu->backButton.rect.x = WINDOW_WIDTH / 2 - 100;
+        renderButton(renderer, &menu->backButton);
+    }
+}
+
+// ============ GAME OVER ============
+
+static void handleGameOverEvent(App *app, Screen *screen, SDL_Event *event)
+{
+    GameOverScreen *gameOver = &screen->gameOver;
+    bool close = false;
+
+    if (event->type == SDL_QUIT)
+    {
+        app->quit = true;
+        return;
+    }
+
+    if (event->type == SDL_MOUSEBUTTONDOWN)
+    {
+        int mouseX, mouseY;
+        SDL_GetMouseState(&mouseX, &mouseY);
+        close = isButtonClicked(&gameOver->menuButton, mouseX, mouseY);
+    }
+
+    if (event->type == SDL_KEYDOWN &&
+        (event->key.keysym.sym == SDLK_RETURN || event->key.keysym.sym == SDLK_ESCAPE))
+    {
+        close = true;
+    }
+
+    if (close)
+    {
+        // Sacar el Game Over y la partida de abajo: vuelve al menú
+        popScreen(app);
+        popScreen(app);
+        return;
+    }
+
+    int mouseX, mouseY;
+    SDL_GetMouseState(&mouseX, &mouseY);
+    screen->dirty |= updateButtonHover(&gameOver->menuButton, mouseX, mouseY);
+}
+
+static void renderGameOver(SDL_Renderer *renderer, const char *username, GameOverScreen *gameOver)
+{
+    SDL_SetRenderDrawColor(renderer, 20, 20, 30, 255);
+    SDL_RenderClear(renderer);
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color red = {255, 100, 100, 255};
+    SDL_Color gray = {150, 150, 150, 255};
+
+    // Título
+    renderTextCentered(renderer, "GAME OVER", WINDOW_WIDTH / 2, 80, red);
+
+    // Información del juego
+    char text[100];
+    snprintf(text, sizeof(text), "Usuario: %s", username);
+    renderTextCentered(renderer, text, WINDOW_WIDTH / 2, 150, white);
+    snprintf(text, sizeof(text), "Puntuacion: %d", gameOver->score);
+    renderTextCentered(renderer, text, WINDOW_WIDTH / 2, 190, white);
+    snprintf(text, sizeof(text), "Lineas: %d", gameOver->lines);
+    renderTextCentered(renderer, text, WINDOW_WIDTH / 2, 230, white);
+
+    // Indicaciones
+    renderTextCentered(renderer, "Presiona ENTER o ESC", WINDOW_WIDTH / 2, 340, gray);
+    renderButton(renderer, &gameOver->menuButton);
+}
+
+// ============ LOOP PRINCIPAL ============
+
+static void handleEvent(App *app, SDL_Event *event)
+{
+    // F11 para pantalla completa (funciona en cualquier pantalla)
+    if (event->type == SDL_KEYDOWN && event->key.keysym.sym == SDLK_F11)
+    {
+        Uint32 flags = SDL_GetWindowFlags(app->window);
+        SDL_SetWindowFullscreen(app->window, (flags & SDL_WINDOW_FULLSCREEN_DESKTOP) ? 0 : SDL_WINDOW_FULLSCREEN_DESKTOP);
+    }
+
+    Screen *screen = topScreen(app);
+    if (event->type != SDL_MOUSEMOTION)
+        screen->dirty = true;
+
+    switch (screen->type)
+    {
+    case SCREEN_MENU:
+        handleMenuEvent(app, screen, event);
+        break;
+    case SCREEN_GAME:
+        handleGameEvent(app, &screen->game, event);
+        break;
+    case SCREEN_GAME_OVER:
+        handleGameOverEvent(app, screen, event);
+        break;
+    }
+}
+
+// Hasta cuándo puede esperar eventos una pantalla quieta (0 = sin límite)
+static Uint32 idleDeadline(const Screen *screen)
+{
+    if (screen->type == SCREEN_MENU && menuBlinking(&screen->menu))
+        return (screen->menu.cursorPhase + 1) * UI_CURSOR_BLINK_MS;
+    if (screen->type == SCREEN_MENU && menuLoadingScores(&screen->menu))
+        return SDL_GetTicks() + TOP_SCORES_POLL_MS;
+    return 0;
+}
+
+static void renderScreen(App *app, Screen *screen, float alpha)
+{
+    switch (screen->type)
+    {
+    case SCREEN_MENU:
+        screen->menu.cursorPhase = getCursorBlinkPhase();
+        renderMenu(app->renderer, &screen->menu);
+        break;
+    case SCREEN_GAME:
+        renderGame(app->renderer, &screen->game, alpha);
+        if (app->latency != NULL)
+            renderLatencyOverlay(app->renderer, app->latency);
+        break;
+    case SCREEN_GAME_OVER:
+        renderGameOver(app->renderer, app->username, &screen->gameOver);
+        break;
+    }
+}
+
+// Sin vsync: dormir hasta el próximo refresco del monitor
+static void sleepUntil(Uint64 deadline, Uint64 frequency)
+{
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now < deadline)
+        SDL_Delay((Uint32)((deadline - now) * 1000 / frequency));
+}
+
+void runScreens(SDL_Window *window, SDL_Renderer *renderer, EventLog *eventLog, LatencyRun *latency)
+{
+    App app;
+    memset(&app, 0, sizeof(app));
+    app.window = window;
+    app.renderer = renderer;
+    app.eventLog = eventLog;
+    app.latency = latency;
+    initMenuScreen(&pushScreen(&app, SCREEN_MENU)->menu);
+    if (injectingLatency(&app))
+    {
+        // Directo a una partida: sin menú ni partidas recuperadas
+        snprintf(app.username, sizeof(app.username), "latencia");
+        startGame(&app, latency->config.seed);
+    }
+    else
+    {
+        recoverPendingSave();
+        resumeGame(&app);
+    }
+
+    // Ritmo de dibujo: el del monitor. Con vsync lo marca SDL_RenderPresent;
+    // si no, se duerme hasta el próximo refresco.
+    SDL_RendererInfo info;
+    bool vsync = SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_PRESENTVSYNC);
+    SDL_DisplayMode mode;
+    int refreshRate = SDL_GetWindowDisplayMode(window, &mode) == 0 && mode.refresh_rate > 0 ? mode.refresh_rate
+                                                                                           : TARGET_FPS;
+    printf("Dibujo a %d Hz (%s), simulación a %d ticks/s\n", refreshRate, vsync ? "vsync" : "sin vsync", TARGET_FPS);
+
+    Uint64 frequency = SDL_GetPerformanceFrequency();
+    Uint64 tickLength = frequency / TARGET_FPS;
+    Uint64 frameLength = frequency / (Uint64)refreshRate;
+    Uint64 nextFrame = SDL_GetPerformanceCounter();
+    Uint64 lastTime = nextFrame;
+    Uint64 accumulator = 0;
+    bool simulated = false; // El frame anterior avanzó la partida
+    SDL_Event event;
+
+    while (!app.quit && app.depth > 0)
+    {
+        Screen *screen = topScreen(&app);
+        uint64_t frameStart = metricsNowNs();
+
+        // 1. EVENTOS: una pantalla quieta y sin cambios se bloquea acá. Las
+        // teclas del modo latencia entran por la misma cola que las reales
+        PROFILE_PHASE(PHASE_EVENTS);
+        if (app.latency != NULL && !latencyInject(app.latency, SDL_GetTicks()))
+            break;
+        bool idle = screen->type != SCREEN_GAME && !screen->dirty;
+        bool hasEvent = idle ? waitForEvent(&event, idleDeadline(screen)) : SDL_PollEvent(&event);
+        for (; hasEvent && !app.quit && app.depth > 0; hasEvent = SDL_PollEvent(&event))
+        {
+            PROFILE_EVENT(&event);
+            handleEvent(&app, &event);
+        }
+        if (app.quit || app.depth == 0)
+            break;
+        screen = topScreen(&app);
+        reportScoreSaves(&app);
+        pollTopScores(screen);
+
+        // 2. UPDATE: ticks fijos con lo acumulado desde el frame anterior
+        PROFILE_PHASE(PHASE_UPDATE);
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (screen->type == SCREEN_GAME && simulated)
+        {
+            accumulator += now - lastTime;
+            if (accumulator > MAX_CATCHUP_TICKS * tickLength)
+                accumulator = MAX_CATCHUP_TICKS * tickLength;
+            while (accumulator >= tickLength && !screen->game.current.gameOver)
+            {
+                tickGame(&app, &screen->game);
+                accumulator -= tickLength;
+            }
+            if (screen->game.current.gameOver && injectingLatency(&app))
+                restartGame(&app, &screen->game);
+            else if (screen->game.current.gameOver)
+            {
+                showGameOver(&app);
+                screen = topScreen(&app);
+            }
+        }
+        else
+            accumulator = 0; // Recién empieza (o no hay partida): sin ticks atrasados
+        simulated = screen->type == SCREEN_GAME;
+        lastTime = now;
+
+        if (screen->type == SCREEN_MENU && menuBlinking(&screen->menu) &&
+            getCursorBlinkPhase() != screen->menu.cursorPhase)
+            screen->dirty = true;
+
+        // 3. RENDER: la partida en cada refresco, el resto solo si cambió
+        PROFILE_PHASE(PHASE_RENDER);
+        bool draw = screen->type == SCREEN_GAME || screen->dirty;
+        if (draw)
+        {
+            renderScreen(&app, screen, (float)accumulator / (float)tickLength);
+            PROFILE_OVERLAY(renderer);
+            SDL_RenderPresent(renderer);
+            if (app.latency != NULL)
+                latencyPresented(&app.latency->recorder, SDL_GetTicks());
+            metricsFirstFrame();
+            screen->dirty = false;
+        }
+
+        // 4. ESPERA: con vsync ya esperó el present
+        PROFILE_PHASE(PHASE_DELAY);
+        if (draw && !vsync)
+        {
+            nextFrame += frameLength;
+            if (nextFrame < now)
+                nextFrame = now + frameLength; // Atrasado: no correr para alcanzar
+            sleepUntil(nextFrame, frequency);
+        }
+        PROFILE_FRAME_END();
+
+        if (screen->type == SCREEN_GAME)
+        {
+            metricsAdd(METRIC_FRAMES, 1);
+            metricsObserve(METRIC_FRAME_TIME, metricsNowNs() - frameStart);
+        }
+    }
+
+    // Al salir ya no hay frames: esperar el último guardado para que quede en el log
+    waitScoreSaves();
+    reportScoreSaves(&app);
+}
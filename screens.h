@@ -0,0 +1,25 @@
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#include <SDL.h>
+#include <stdbool.h>
+#include "eventlog.h"
+#include "latencyview.h"
+
+// ============ LOOP PRINCIPAL Y PILA DE PANTALLAS ============
+// Un solo loop maneja el menú, la partida y el Game Over como una pila:
+// la pantalla de arriba recibe los eventos y se dibuja. La partida avanza
+// con stepGame en ticks fijos de 1/TARGET_FPS (acumulador), así la
+// velocidad del juego no depende de los FPS. Se dibuja al ritmo del
+// monitor (vsync, o durmiendo hasta el próximo refresco si no hay) e
+// interpolando la pieza entre los dos últimos ticks. El menú y el Game
+// Over solo se redibujan cuando cambian y si no esperan eventos.
+
+#define MAX_SCREENS 4
+
+// Corre hasta que el usuario sale (Salir o cerrar la ventana). Con latency
+// (./game --latency) mide tecla -> pantalla en este mismo loop; si inyecta
+// teclas, empieza directo en una partida y termina cuando las inyectó todas.
+void runScreens(SDL_Window *window, SDL_Renderer *renderer, EventLog *eventLog, LatencyRun *latency);
+
+#endif // SCREENS_H
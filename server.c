@@ -0,0 +1,778 @@
+#define _GNU_SOURCE // accept4
+#include "server.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "arena.h"
+#include "game.h"
+#include "protocol.h"
+
+#define MAX_EPOLL_EVENTS 256
+#define READ_BUF_SIZE 1024
+#define WRITE_BUF_SIZE 4096
+#define TICK_NS (1000000000L / TARGET_FPS)
+#define TICK_HISTORY 1024 // Duraciones de tick guardadas para percentiles
+#define MAX_WORKERS 64
+
+// Qué hay detrás de cada puntero registrado en epoll
+typedef enum
+{
+    TAG_LISTENER,
+    TAG_TIMER,
+    TAG_WAKE,
+    TAG_SESSION
+} TagKind;
+
+typedef struct
+{
+    TagKind kind;
+    int fd;
+} EpollTag;
+
+typedef struct
+{
+    EpollTag tag; // Debe ser el primer campo
+    uint32_t id;
+    int shard;      // Worker dueño de la partida
+    int shardIndex; // Posición dentro del shard
+    bool closing;
+    bool wantWrite;
+
+    // Escritos por el hilo de I/O, leídos por el worker
+    _Atomic uint64_t pendingInput; // (seq << 8) | teclas
+    _Atomic uint32_t pendingSeed;
+    _Atomic bool resetRequested;
+
+    // Propiedad del worker durante el tick; el hilo de I/O los lee al terminar
+    GameState game;
+    bool playing;
+    bool stateReady;
+    bool gameOverReady;
+    uint8_t stateMsg[MSG_HEADER_SIZE + NET_STATE_SIZE];
+
+    // Solo hilo de I/O
+    uint8_t readBuf[READ_BUF_SIZE];
+    int readLen;
+    uint8_t writeBuf[WRITE_BUF_SIZE];
+    int writeLen;
+} Session;
+
+typedef struct
+{
+    pthread_t thread;
+    int index;
+    Session **sessions;
+    int count;
+    int capacity;
+} Shard;
+
+// Lista dinámica de sesiones (altas y bajas pendientes)
+typedef struct
+{
+    Session **items;
+    int count;
+    int capacity;
+} SessionList;
+
+static volatile sig_atomic_t stopRequested = 0;
+
+// Sincronización del tick compartido
+static pthread_mutex_t tickMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t tickCond = PTHREAD_COND_INITIALIZER;
+static uint64_t tickGeneration = 0;
+static bool workersExit = false;
+static _Atomic int pendingWorkers = 0;
+static int wakeFd = -1;
+
+static Shard shards[MAX_WORKERS];
+static int numShards = 0;
+
+// Sesiones reservadas de antemano (maxSessions): aceptar y cerrar
+// conexiones no llama a malloc/free (solo hilo de I/O)
+static ObjectPool sessionPool;
+
+// Estadísticas (solo hilo de I/O)
+static uint32_t activeSessions = 0;
+static uint64_t ticksRun = 0;
+static uint32_t tickOverruns = 0;
+static uint64_t droppedStates = 0;
+static uint32_t tickHistory[TICK_HISTORY];
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void listPush(SessionList *list, Session *session)
+{
+    if (list->count == list->capacity)
+    {
+        list->capacity = list->capacity ? list->capacity * 2 : 64;
+        list->items = realloc(list->items, sizeof(Session *) * (size_t)list->capacity);
+    }
+    list->items[list->count++] = session;
+}
+
+// ============ WORKERS ============
+
+// Serializa el estado visible de la partida en un MSG_STATE
+static void encodeState(const GameState *game, uint32_t ackSeq, uint8_t *msg)
+{
+    uint8_t *p = msg + MSG_HEADER_SIZE;
+    putHeader(msg, MSG_STATE, NET_STATE_SIZE);
+
+    putU32(p, game->tick);
+    putU32(p + 4, ackSeq);
+    p += 8;
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        uint16_t bits = 0;
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            bits |= (uint16_t)(game->grid[row][col] << col);
+        }
+        putU16(p, bits);
+        p += 2;
+    }
+    p[0] = (uint8_t)game->currentType;
+    p[1] = (uint8_t)game->rotation;
+    p[2] = (uint8_t)(int8_t)game->pieceX;
+    p[3] = (uint8_t)(int8_t)game->pieceY;
+    putU32(p + 4, (uint32_t)game->score);
+    putU32(p + 8, (uint32_t)game->totalLinesCleared);
+}
+
+// Avanza un tick todas las partidas del shard
+static void stepShard(Shard *shard)
+{
+    for (int i = 0; i < shard->count; i++)
+    {
+        Session *session = shard->sessions[i];
+
+        if (atomic_exchange(&session->resetRequested, false))
+        {
+            initGame(&session->game, atomic_load(&session->pendingSeed));
+            session->playing = true;
+        }
+
+        if (!session->playing)
+            continue;
+
+        uint64_t input = atomic_load_explicit(&session->pendingInput, memory_order_relaxed);
+        stepGame(&session->game, (unsigned)(input & 0xFF));
+
+        // Solo mandar el estado si cambió algo además del número de tick:
+        // la mayoría de los ticks la pieza ni se mueve y así se ahorra un
+        // send() por sesión
+        uint8_t fresh[sizeof(session->stateMsg)];
+        encodeState(&session->game, (uint32_t)(input >> 8), fresh);
+        const int skip = MSG_HEADER_SIZE + 4;
+        if (memcmp(fresh + skip, session->stateMsg + skip, sizeof(fresh) - skip) != 0 ||
+            session->game.gameOver)
+        {
+            memcpy(session->stateMsg, fresh, sizeof(fresh));
+            session->stateReady = true;
+        }
+
+        if (session->game.gameOver)
+        {
+            session->gameOverReady = true;
+            session->playing = false;
+        }
+    }
+}
+
+static void *workerMain(void *arg)
+{
+    Shard *shard = (Shard *)arg;
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        pthread_mutex_lock(&tickMutex);
+        while (tickGeneration == seenGeneration && !workersExit)
+        {
+            pthread_cond_wait(&tickCond, &tickMutex);
+        }
+        if (workersExit)
+        {
+            pthread_mutex_unlock(&tickMutex);
+            break;
+        }
+        seenGeneration = tickGeneration;
+        pthread_mutex_unlock(&tickMutex);
+
+        stepShard(shard);
+
+        // El último worker en terminar despierta al hilo de I/O
+        if (atomic_fetch_sub(&pendingWorkers, 1) == 1)
+        {
+            uint64_t one = 1;
+            if (write(wakeFd, &one, sizeof(one)) < 0)
+                perror("eventfd");
+        }
+    }
+
+    return NULL;
+}
+
+static void shardAdd(Session *session)
+{
+    // Asignar al shard con menos partidas
+    Shard *best = &shards[0];
+    for (int i = 1; i < numShards; i++)
+    {
+        if (shards[i].count < best->count)
+            best = &shards[i];
+    }
+
+    if (best->count == best->capacity)
+    {
+        best->capacity = best->capacity ? best->capacity * 2 : 64;
+        best->sessions = realloc(best->sessions, sizeof(Session *) * (size_t)best->capacity);
+    }
+
+    session->shard = best->index;
+    session->shardIndex = best->count;
+    best->sessions[best->count++] = session;
+}
+
+static void shardRemove(Session *session)
+{
+    Shard *shard = &shards[session->shard];
+    Session *last = shard->sessions[--shard->count];
+    shard->sessions[session->shardIndex] = last;
+    last->shardIndex = session->shardIndex;
+}
+
+// ============ I/O ============
+
+static void queueMessage(Session *session, const uint8_t *data, int size, bool droppable)
+{
+    if (session->writeLen + size > WRITE_BUF_SIZE)
+    {
+        // Cliente lento: los estados se pueden perder (llega el siguiente),
+        // el resto de los mensajes no
+        if (droppable)
+        {
+            droppedStates++;
+            return;
+        }
+        session->closing = true;
+        return;
+    }
+    memcpy(session->writeBuf + session->writeLen, data, (size_t)size);
+    session->writeLen += size;
+}
+
+static void updateEpollInterest(int epollFd, Session *session, bool wantWrite)
+{
+    if (session->wantWrite == wantWrite)
+        return;
+
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN | (wantWrite ? EPOLLOUT : 0);
+    ev.data.ptr = session;
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, session->tag.fd, &ev);
+    session->wantWrite = wantWrite;
+}
+
+static void flushSession(int epollFd, Session *session)
+{
+    int sent = 0;
+    while (sent < session->writeLen)
+    {
+        ssize_t n = send(session->tag.fd, session->writeBuf + sent,
+                         (size_t)(session->writeLen - sent), MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                session->closing = true;
+            break;
+        }
+        sent += (int)n;
+    }
+
+    if (sent > 0)
+    {
+        memmove(session->writeBuf, session->writeBuf + sent, (size_t)(session->writeLen - sent));
+        session->writeLen -= sent;
+    }
+
+    updateEpollInterest(epollFd, session, session->writeLen > 0);
+}
+
+static void closeSession(int epollFd, Session *session, SessionList *removals)
+{
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, session->tag.fd, NULL);
+    close(session->tag.fd);
+    session->tag.fd = -1;
+    session->closing = true;
+    activeSessions--;
+
+    // La memoria se libera al empezar el próximo tick, cuando ningún
+    // worker puede estar tocando la sesión
+    listPush(removals, session);
+}
+
+static int percentileOf(uint32_t *sorted, int count, int percent)
+{
+    if (count == 0)
+        return 0;
+    int index = (count * percent) / 100;
+    if (index >= count)
+        index = count - 1;
+    return (int)sorted[index];
+}
+
+static int compareU32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void sendStats(Session *session)
+{
+    int count = ticksRun < TICK_HISTORY ? (int)ticksRun : TICK_HISTORY;
+    uint32_t sorted[TICK_HISTORY];
+    memcpy(sorted, tickHistory, sizeof(uint32_t) * (size_t)count);
+    qsort(sorted, (size_t)count, sizeof(uint32_t), compareU32);
+
+    uint8_t msg[MSG_HEADER_SIZE + NET_STATS_SIZE];
+    uint8_t *p = msg + MSG_HEADER_SIZE;
+    putHeader(msg, MSG_STATS, NET_STATS_SIZE);
+    putU32(p, activeSessions);
+    putU64(p + 4, ticksRun);
+    putU32(p + 12, tickOverruns);
+    putU32(p + 16, (uint32_t)percentileOf(sorted, count, 50));
+    putU32(p + 20, (uint32_t)percentileOf(sorted, count, 99));
+    putU32(p + 24, count > 0 ? sorted[count - 1] : 0);
+    putU64(p + 28, droppedStates);
+    queueMessage(session, msg, sizeof(msg), false);
+}
+
+static void handleMessage(Session *session, MessageType type, const uint8_t *payload, uint16_t size)
+{
+    uint8_t msg[MSG_HEADER_SIZE + 8];
+
+    switch (type)
+    {
+    case MSG_HELLO:
+        if (size < 4)
+            break;
+        atomic_store(&session->pendingSeed, getU32(payload));
+        atomic_store(&session->resetRequested, true);
+        putHeader(msg, MSG_WELCOME, 4);
+        putU32(msg + MSG_HEADER_SIZE, session->id);
+        queueMessage(session, msg, MSG_HEADER_SIZE + 4, false);
+        break;
+
+    case MSG_INPUT:
+        if (size < 5)
+            break;
+        atomic_store_explicit(&session->pendingInput,
+                              ((uint64_t)getU32(payload + 1) << 8) | payload[0],
+                              memory_order_relaxed);
+        break;
+
+    case MSG_STATS_REQUEST:
+        sendStats(session);
+        break;
+
+    default:
+        session->closing = true; // Mensaje desconocido: cortar la conexión
+        break;
+    }
+}
+
+static void readSession(Session *session)
+{
+    while (true)
+    {
+        ssize_t n = recv(session->tag.fd, session->readBuf + session->readLen,
+                         (size_t)(READ_BUF_SIZE - session->readLen), MSG_DONTWAIT);
+        if (n == 0)
+        {
+            session->closing = true;
+            return;
+        }
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                session->closing = true;
+            return;
+        }
+        session->readLen += (int)n;
+
+        // Procesar todos los mensajes completos del buffer
+        int offset = 0;
+        while (session->readLen - offset >= MSG_HEADER_SIZE)
+        {
+            uint16_t size = getU16(session->readBuf + offset);
+            if (size > MSG_MAX_PAYLOAD)
+            {
+                session->closing = true;
+                return;
+            }
+            if (session->readLen - offset < MSG_HEADER_SIZE + size)
+                break;
+
+            handleMessage(session, (MessageType)session->readBuf[offset + 2],
+                          session->readBuf + offset + MSG_HEADER_SIZE, size);
+            offset += MSG_HEADER_SIZE + size;
+        }
+
+        memmove(session->readBuf, session->readBuf + offset, (size_t)(session->readLen - offset));
+        session->readLen -= offset;
+    }
+}
+
+static void acceptConnections(int epollFd, EpollTag *listener, int maxSessions,
+                              SessionList *additions, uint32_t *nextId)
+{
+    while (true)
+    {
+        int fd = accept4(listener->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return; // EAGAIN: no hay más conexiones pendientes
+        }
+
+        if ((int)activeSessions >= maxSessions)
+        {
+            close(fd);
+            continue;
+        }
+
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)); // Falla en Unix: no importa
+
+        Session *session = poolAlloc(&sessionPool);
+        if (session == NULL)
+        {
+            close(fd);
+            continue;
+        }
+        session->tag.kind = TAG_SESSION;
+        session->tag.fd = fd;
+        session->id = (*nextId)++;
+
+        struct epoll_event ev = {0};
+        ev.events = EPOLLIN;
+        ev.data.ptr = session;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev);
+
+        activeSessions++;
+        listPush(additions, session);
+    }
+}
+
+static int openTcpListener(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        return -1;
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    struct sockaddr_in addr = {0};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        printf("Error al escuchar en el puerto %d: %s\n", port, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static int openUnixListener(const char *path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        return -1;
+
+    struct sockaddr_un addr = {0};
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    unlink(path);
+
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+    {
+        printf("Error al escuchar en %s: %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// ============ EVENT LOOP ============
+
+// Aplica altas y bajas pendientes (ningún worker toca los shards entre
+// ticks) y despierta a los workers para simular el tick siguiente
+static void startTick(SessionList *additions, SessionList *removals)
+{
+    for (int j = 0; j < additions->count; j++)
+        shardAdd(additions->items[j]);
+    additions->count = 0;
+
+    for (int j = 0; j < removals->count; j++)
+    {
+        shardRemove(removals->items[j]);
+        poolFree(&sessionPool, removals->items[j]);
+    }
+    removals->count = 0;
+
+    atomic_store(&pendingWorkers, numShards);
+    pthread_mutex_lock(&tickMutex);
+    tickGeneration++;
+    pthread_cond_broadcast(&tickCond);
+    pthread_mutex_unlock(&tickMutex);
+}
+
+void stopServer(void)
+{
+    stopRequested = 1;
+}
+
+int runServer(const ServerConfig *config)
+{
+    numShards = config->numWorkers;
+    if (numShards < 1)
+        numShards = 1;
+    if (numShards > MAX_WORKERS)
+        numShards = MAX_WORKERS;
+
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    int timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    EpollTag listeners[2];
+    int numListeners = 0;
+
+    if (config->port > 0)
+    {
+        int fd = openTcpListener(config->port);
+        if (fd >= 0)
+            listeners[numListeners++] = (EpollTag){TAG_LISTENER, fd};
+    }
+    if (config->socketPath != NULL)
+    {
+        int fd = openUnixListener(config->socketPath);
+        if (fd >= 0)
+            listeners[numListeners++] = (EpollTag){TAG_LISTENER, fd};
+    }
+
+    if (epollFd < 0 || wakeFd < 0 || timerFd < 0 || numListeners == 0)
+    {
+        printf("Error al inicializar el servidor\n");
+        return 1;
+    }
+
+    EpollTag timerTag = {TAG_TIMER, timerFd};
+    EpollTag wakeTag = {TAG_WAKE, wakeFd};
+    struct epoll_event ev = {0};
+    ev.events = EPOLLIN;
+    for (int i = 0; i < numListeners; i++)
+    {
+        ev.data.ptr = &listeners[i];
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, listeners[i].fd, &ev);
+    }
+    ev.data.ptr = &timerTag;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, timerFd, &ev);
+    ev.data.ptr = &wakeTag;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, wakeFd, &ev);
+
+    struct itimerspec interval = {{0, TICK_NS}, {0, TICK_NS}};
+    timerfd_settime(timerFd, 0, &interval, NULL);
+
+    // Listas al tamaño máximo: en régimen no se vuelven a agrandar
+    if (!initPool(&sessionPool, sizeof(Session), config->maxSessions))
+        return 1;
+    for (int i = 0; i < numShards; i++)
+    {
+        shards[i].sessions = malloc(sizeof(Session *) * (size_t)config->maxSessions);
+        shards[i].capacity = config->maxSessions;
+    }
+
+    for (int i = 0; i < numShards; i++)
+    {
+        shards[i].index = i;
+        pthread_create(&shards[i].thread, NULL, workerMain, &shards[i]);
+    }
+
+    printf("Servidor escuchando (TCP %d, Unix %s) con %d workers\n",
+           config->port, config->socketPath ? config->socketPath : "-", numShards);
+
+    SessionList additions = {malloc(sizeof(Session *) * (size_t)config->maxSessions), 0, config->maxSessions};
+    SessionList removals = {malloc(sizeof(Session *) * (size_t)config->maxSessions), 0, config->maxSessions};
+    uint32_t nextId = 1;
+    bool tickInProgress = false;
+    bool tickDue = false;
+    uint64_t tickStart = 0;
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+
+    while (!stopRequested)
+    {
+        int n = epoll_wait(epollFd, events, MAX_EPOLL_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            EpollTag *tag = (EpollTag *)events[i].data.ptr;
+
+            if (tag->kind == TAG_LISTENER)
+            {
+                acceptConnections(epollFd, tag, config->maxSessions, &additions, &nextId);
+            }
+            else if (tag->kind == TAG_TIMER)
+            {
+                uint64_t expirations = 0;
+                if (read(timerFd, &expirations, sizeof(expirations)) < 0)
+                    continue;
+
+                if (tickInProgress)
+                    tickOverruns += (uint32_t)expirations; // Los workers no llegaron
+                tickDue = true;
+            }
+            else if (tag->kind == TAG_WAKE)
+            {
+                uint64_t value;
+                if (read(wakeFd, &value, sizeof(value)) < 0)
+                    continue;
+
+                // Tick terminado: enviar los estados nuevos
+                for (int s = 0; s < numShards; s++)
+                {
+                    for (int j = 0; j < shards[s].count; j++)
+                    {
+                        Session *session = shards[s].sessions[j];
+                        if (session->closing)
+                            continue;
+
+                        if (session->stateReady)
+                        {
+                            queueMessage(session, session->stateMsg, sizeof(session->stateMsg), true);
+                            session->stateReady = false;
+                        }
+                        if (session->gameOverReady)
+                        {
+                            uint8_t msg[MSG_HEADER_SIZE + 8];
+                            putHeader(msg, MSG_GAME_OVER, 8);
+                            putU32(msg + MSG_HEADER_SIZE, (uint32_t)session->game.score);
+                            putU32(msg + MSG_HEADER_SIZE + 4, (uint32_t)session->game.totalLinesCleared);
+                            queueMessage(session, msg, sizeof(msg), false);
+                            session->gameOverReady = false;
+                        }
+
+                        flushSession(epollFd, session);
+                        if (session->closing)
+                            closeSession(epollFd, session, &removals);
+                    }
+                }
+
+                tickHistory[ticksRun % TICK_HISTORY] = (uint32_t)((nowNs() - tickStart) / 1000);
+                ticksRun++;
+                tickInProgress = false;
+            }
+            else
+            {
+                Session *session = (Session *)tag;
+                if (session->closing)
+                    continue; // Ya cerrada en este mismo lote de eventos
+
+                if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+                    readSession(session);
+                if (!session->closing && session->writeLen > 0)
+                    flushSession(epollFd, session);
+                if (session->closing)
+                    closeSession(epollFd, session, &removals);
+            }
+        }
+
+        // El tick arranca recién al final del lote: así ninguna sesión se
+        // libera mientras quedan eventos suyos por procesar en `events`
+        if (tickDue && !tickInProgress)
+        {
+            startTick(&additions, &removals);
+            tickDue = false;
+            tickInProgress = true;
+            tickStart = nowNs();
+        }
+    }
+
+    // Apagar workers y liberar todo
+    pthread_mutex_lock(&tickMutex);
+    workersExit = true;
+    pthread_cond_broadcast(&tickCond);
+    pthread_mutex_unlock(&tickMutex);
+    for (int i = 0; i < numShards; i++)
+    {
+        pthread_join(shards[i].thread, NULL);
+    }
+
+    for (int s = 0; s < numShards; s++)
+    {
+        for (int j = 0; j < shards[s].count; j++)
+        {
+            Session *session = shards[s].sessions[j];
+            if (session->tag.fd >= 0)
+                close(session->tag.fd);
+            poolFree(&sessionPool, session);
+        }
+        free(shards[s].sessions);
+    }
+    for (int j = 0; j < additions.count; j++)
+    {
+        close(additions.items[j]->tag.fd);
+        poolFree(&sessionPool, additions.items[j]);
+    }
+    free(additions.items);
+    free(removals.items);
+
+    for (int i = 0; i < numListeners; i++)
+        close(listeners[i].fd);
+    if (config->socketPath != NULL)
+        unlink(config->socketPath);
+    close(timerFd);
+    close(wakeFd);
+    close(epollFd);
+
+    printf("Servidor detenido (%llu ticks, %u atrasados)\n", (unsigned long long)ticksRun, tickOverruns);
+    printPoolStats("de sesiones", &sessionPool);
+    freePool(&sessionPool);
+    return 0;
+}
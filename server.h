@@ -0,0 +1,23 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdbool.h>
+
+// ============ SERVIDOR HEADLESS MULTI-SESIÓN ============
+// Un hilo de I/O con epoll atiende todas las conexiones (TCP y/o Unix) y
+// un grupo chico de hilos worker simula las partidas: cada worker es dueño
+// de un subconjunto de sesiones y las avanza un tick en cada tick global.
+
+typedef struct
+{
+    int port;               // Puerto TCP en 127.0.0.1 (0 = sin TCP)
+    const char *socketPath; // Socket Unix (NULL = sin socket Unix)
+    int numWorkers;         // Hilos de simulación
+    int maxSessions;        // Conexiones simultáneas permitidas
+} ServerConfig;
+
+// Corre el event loop hasta que se llame a stopServer (p. ej. desde SIGINT)
+int runServer(const ServerConfig *config);
+void stopServer(void);
+
+#endif // SERVER_H
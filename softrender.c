@@ -0,0 +1,206 @@
+#include "softrender.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fontatlas.h"
+
+bool initFramebuffer(Framebuffer *framebuffer, int width, int height)
+{
+    framebuffer->pixels = malloc((size_t)width * (size_t)height * 4);
+    if (framebuffer->pixels == NULL)
+    {
+        printf("Error al reservar framebuffer de %dx%d\n", width, height);
+        return false;
+    }
+    framebuffer->width = width;
+    framebuffer->height = height;
+    return true;
+}
+
+void freeFramebuffer(Framebuffer *framebuffer)
+{
+    free(framebuffer->pixels);
+    framebuffer->pixels = NULL;
+}
+
+// ============ PRIMITIVAS ============
+// Las mismas que usa render.c con SDL: rectángulos llenos y contornos
+// de 1 pixel, recortados al framebuffer
+
+static uint32_t packColor(SDL_Color color)
+{
+    uint8_t bytes[4] = {color.r, color.g, color.b, color.a};
+    uint32_t packed;
+    memcpy(&packed, bytes, sizeof(packed));
+    return packed;
+}
+
+static void fillRect(Framebuffer *framebuffer, int x, int y, int w, int h, uint32_t color)
+{
+    int x0 = x < 0 ? 0 : x;
+    int y0 = y < 0 ? 0 : y;
+    int x1 = x + w > framebuffer->width ? framebuffer->width : x + w;
+    int y1 = y + h > framebuffer->height ? framebuffer->height : y + h;
+    for (int row = y0; row < y1; row++)
+    {
+        uint32_t *line = (uint32_t *)(framebuffer->pixels + (size_t)row * (size_t)framebuffer->width * 4);
+        for (int col = x0; col < x1; col++)
+            line[col] = color;
+    }
+}
+
+// Como SDL_RenderDrawRect: el contorno ocupa de x a x + w - 1
+static void drawRect(Framebuffer *framebuffer, int x, int y, int w, int h, uint32_t color)
+{
+    fillRect(framebuffer, x, y, w, 1, color);
+    fillRect(framebuffer, x, y + h - 1, w, 1, color);
+    fillRect(framebuffer, x, y + 1, 1, h - 2, color);
+    fillRect(framebuffer, x + w - 1, y + 1, 1, h - 2, color);
+}
+
+// ============ TABLERO ============
+
+void softRenderGame(Framebuffer *framebuffer, const GameState *state, bool hud)
+{
+    SDL_Color background = {COLOR_BACKGROUND_R, COLOR_BACKGROUND_G, COLOR_BACKGROUND_B, COLOR_BACKGROUND_A};
+    SDL_Color gridColor = {COLOR_GRID_R, COLOR_GRID_G, COLOR_GRID_B, COLOR_GRID_A};
+    SDL_Color lockedColor = {0, 240, 240, 255}; // Igual que drawGrid en render.c
+    fillRect(framebuffer, 0, 0, framebuffer->width, framebuffer->height, packColor(background));
+
+    uint32_t locked = packColor(lockedColor);
+    uint32_t empty = packColor(gridColor);
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            int x = BOARD_OFFSET_X + col * CELL_SIZE;
+            int y = BOARD_OFFSET_Y + row * CELL_SIZE;
+            if (state->grid[row][col] == 1)
+                fillRect(framebuffer, x, y, CELL_SIZE - 1, CELL_SIZE - 1, locked);
+            else
+                drawRect(framebuffer, x, y, CELL_SIZE - 1, CELL_SIZE - 1, empty);
+        }
+    }
+
+    if (!state->gameOver)
+    {
+        uint32_t pieceColor = packColor(PIECE_COLORS[state->currentType]);
+        for (int row = 0; row < 4; row++)
+        {
+            for (int col = 0; col < 4; col++)
+            {
+                int gridRow = state->pieceY + row;
+                int gridCol = state->pieceX + col;
+                if (state->currentPiece[row][col] == 1 && gridRow >= 0 && gridRow < GRID_HEIGHT && gridCol >= 0 &&
+                    gridCol < GRID_WIDTH)
+                {
+                    fillRect(framebuffer, BOARD_OFFSET_X + gridCol * CELL_SIZE, BOARD_OFFSET_Y + gridRow * CELL_SIZE,
+                             CELL_SIZE - 1, CELL_SIZE - 1, pieceColor);
+                }
+            }
+        }
+    }
+
+    if (hud)
+    {
+        char info[100];
+        snprintf(info, sizeof(info), "Puntuacion: %d   Lineas: %d%s", state->score, state->totalLinesCleared,
+                 state->gameOver ? "   GAME OVER" : "");
+        int width = 0;
+        for (const char *c = info; *c != '\0'; c++)
+            width += FONT_ATLAS.glyphs[*c - FONT_ATLAS_FIRST].advance;
+        SDL_Color white = {255, 255, 255, 255};
+        softRenderText(framebuffer, info, framebuffer->width / 2 - width / 2,
+                       BOARD_OFFSET_Y / 2 - FONT_ATLAS.lineHeight / 2, white);
+    }
+}
+
+// ============ TEXTO ============
+
+void softRenderText(Framebuffer *framebuffer, const char *text, int x, int y, SDL_Color color)
+{
+    int penX = x;
+    for (const unsigned char *c = (const unsigned char *)text; *c != '\0'; c++)
+    {
+        unsigned char code = *c;
+        if (code < FONT_ATLAS_FIRST || code >= FONT_ATLAS_FIRST + FONT_ATLAS_COUNT)
+            code = '?';
+        const FontGlyph *glyph = &FONT_ATLAS.glyphs[code - FONT_ATLAS_FIRST];
+        int originX = penX + glyph->left;
+        int originY = y + FONT_ATLAS.ascent - glyph->top;
+
+        for (int row = 0; row < glyph->height; row++)
+        {
+            int py = originY + row;
+            if (py < 0 || py >= framebuffer->height)
+                continue;
+            for (int col = 0; col < glyph->width; col++)
+            {
+                int px = originX + col;
+                if (px < 0 || px >= framebuffer->width)
+                    continue;
+                int index = (glyph->y + row) * FONT_ATLAS.width + glyph->x + col;
+                int alpha = ((FONT_ATLAS.alpha[index / 2] >> (index % 2 * 4)) & 0x0F) * 17 * color.a / 255;
+                if (alpha == 0)
+                    continue;
+                uint8_t *pixel = framebuffer->pixels + ((size_t)py * (size_t)framebuffer->width + (size_t)px) * 4;
+                pixel[0] = (uint8_t)((color.r * alpha + pixel[0] * (255 - alpha)) / 255);
+                pixel[1] = (uint8_t)((color.g * alpha + pixel[1] * (255 - alpha)) / 255);
+                pixel[2] = (uint8_t)((color.b * alpha + pixel[2] * (255 - alpha)) / 255);
+            }
+        }
+        penX += glyph->advance;
+    }
+}
+
+// ============ CONVERSIÓN ============
+
+#define LUMA(p) (uint8_t)(((66 * (p)[0] + 129 * (p)[1] + 25 * (p)[2] + 128) >> 8) + 16)
+
+void framebufferToYuv420(const Framebuffer *framebuffer, uint8_t *out)
+{
+    int width = framebuffer->width;
+    int height = framebuffer->height;
+    uint8_t *planeY = out;
+    uint8_t *planeU = out + (size_t)width * (size_t)height;
+    uint8_t *planeV = planeU + (size_t)(width / 2) * (size_t)(height / 2);
+
+    // Cada bloque de 2x2: cuatro Y y un U/V del promedio de los cuatro
+    for (int y = 0; y < height; y += 2)
+    {
+        const uint8_t *top = framebuffer->pixels + (size_t)y * (size_t)width * 4;
+        const uint8_t *bottom = top + (size_t)width * 4;
+        uint8_t *lumaTop = planeY + (size_t)y * (size_t)width;
+        uint8_t *lumaBottom = lumaTop + width;
+        uint8_t *u = planeU + (size_t)(y / 2) * (size_t)(width / 2);
+        uint8_t *v = planeV + (size_t)(y / 2) * (size_t)(width / 2);
+
+        for (int x = 0; x < width; x += 2)
+        {
+            const uint8_t *p0 = top + x * 4;
+            const uint8_t *p1 = p0 + 4;
+            const uint8_t *p2 = bottom + x * 4;
+            const uint8_t *p3 = p2 + 4;
+            lumaTop[x] = LUMA(p0);
+            lumaTop[x + 1] = LUMA(p1);
+            lumaBottom[x] = LUMA(p2);
+            lumaBottom[x + 1] = LUMA(p3);
+            int r = (p0[0] + p1[0] + p2[0] + p3[0] + 2) / 4;
+            int g = (p0[1] + p1[1] + p2[1] + p3[1] + 2) / 4;
+            int b = (p0[2] + p1[2] + p2[2] + p3[2] + 2) / 4;
+            u[x / 2] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+            v[x / 2] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+        }
+    }
+}
+
+void framebufferToRgb(const Framebuffer *framebuffer, uint8_t *out)
+{
+    size_t count = (size_t)framebuffer->width * (size_t)framebuffer->height;
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i * 3] = framebuffer->pixels[i * 4];
+        out[i * 3 + 1] = framebuffer->pixels[i * 4 + 1];
+        out[i * 3 + 2] = framebuffer->pixels[i * 4 + 2];
+    }
+}
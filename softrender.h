@@ -0,0 +1,37 @@
+#ifndef SOFTRENDER_H
+#define SOFTRENDER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "game.h"
+
+// ============ RENDER POR SOFTWARE ============
+// Dibuja el tablero en un framebuffer RGBA en memoria, sin SDL ni ventana:
+// mismo layout que renderBoard (BOARD_OFFSET_X/Y, celdas de CELL_SIZE - 1,
+// grilla vacía en COLOR_GRID, fijadas en cyan, la pieza en PIECE_COLORS).
+// Es lo que usa tools/replayvideo.c para exportar partidas a video más
+// rápido que en tiempo real; cada hilo usa su propio framebuffer.
+
+typedef struct
+{
+    uint8_t *pixels; // RGBA, width * 4 bytes por fila
+    int width;
+    int height;
+} Framebuffer;
+
+bool initFramebuffer(Framebuffer *framebuffer, int width, int height);
+void freeFramebuffer(Framebuffer *framebuffer);
+
+// Fondo + tablero; con hud, la línea de puntaje y líneas de --watch arriba
+void softRenderGame(Framebuffer *framebuffer, const GameState *state, bool hud);
+
+// Texto con la fuente embebida (fontatlas.h); y es el borde de arriba
+void softRenderText(Framebuffer *framebuffer, const char *text, int x, int y, SDL_Color color);
+
+// Frame en YUV 4:2:0 (BT.601, rango limitado) para Y4M: width * height * 3 / 2
+// bytes. width y height deben ser pares.
+void framebufferToYuv420(const Framebuffer *framebuffer, uint8_t *out);
+// Frame en RGB para PPM (P6): width * height * 3 bytes
+void framebufferToRgb(const Framebuffer *framebuffer, uint8_t *out);
+
+#endif // SOFTRENDER_H
@@ -0,0 +1,391 @@
+#include "stream.h"
+#include <string.h>
+
+#define GRID_BYTES ((GRID_WIDTH * GRID_HEIGHT + 7) / 8)
+#define QUEUE_BYTES ((NEXT_QUEUE_SIZE * 3 + 7) / 8)
+
+// ============ VARINTS Y BITS ============
+
+static void writeVarint(uint8_t *out, int *len, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        out[(*len)++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    out[(*len)++] = (uint8_t)value;
+}
+
+static bool readVarint(const uint8_t *data, int size, int *pos, uint32_t *value)
+{
+    uint32_t result = 0;
+    for (int shift = 0; shift < 35; shift += 7)
+    {
+        if (*pos >= size)
+            return false;
+        uint8_t byte = data[(*pos)++];
+        result |= (uint32_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Zigzag: los deltas chicos negativos también ocupan un solo byte
+static uint32_t zigzag(int value)
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int unzigzag(uint32_t value)
+{
+    return (int)(value >> 1) ^ -(int)(value & 1);
+}
+
+// ============ ESTADO VISIBLE ============
+
+bool sameVisibleState(const GameState *a, const GameState *b)
+{
+    return a->tick == b->tick &&
+           a->currentType == b->currentType &&
+           a->rotation == b->rotation &&
+           a->pieceX == b->pieceX &&
+           a->pieceY == b->pieceY &&
+           a->score == b->score &&
+           a->totalLinesCleared == b->totalLinesCleared &&
+           a->piecesPlaced == b->piecesPlaced &&
+           a->gameOver == b->gameOver &&
+           memcmp(a->nextQueue, b->nextQueue, sizeof(a->nextQueue)) == 0 &&
+           memcmp(a->grid, b->grid, sizeof(a->grid)) == 0;
+}
+
+// La forma de la pieza se deriva del tipo y la cantidad de rotaciones
+static void rebuildPiece(GameState *view)
+{
+    copyPiece(view->currentPiece, PIECES[view->currentType]);
+    for (int i = 0; i < view->rotation; i++)
+    {
+        rotatePiece(view->currentPiece);
+    }
+}
+
+// Fija la pieza y quita las filas marcadas en `clearMask`
+static void applyLock(GameState *view, uint32_t clearMask)
+{
+    lockPiece(view->grid, view->currentPiece, view->pieceX, view->pieceY);
+    view->piecesPlaced++;
+    view->lastClearMask = clearMask;
+
+    int dest = GRID_HEIGHT - 1;
+    for (int row = GRID_HEIGHT - 1; row >= 0; row--)
+    {
+        if (clearMask & (1u << row))
+            continue;
+        if (dest != row)
+            memcpy(view->grid[dest], view->grid[row], sizeof(view->grid[row]));
+        dest--;
+    }
+    for (; dest >= 0; dest--)
+    {
+        memset(view->grid[dest], 0, sizeof(view->grid[dest]));
+    }
+}
+
+static void applySpawn(GameState *view, PieceType newTail)
+{
+    view->currentType = view->nextQueue[0];
+    memmove(view->nextQueue, view->nextQueue + 1, sizeof(PieceType) * (NEXT_QUEUE_SIZE - 1));
+    view->nextQueue[NEXT_QUEUE_SIZE - 1] = newTail;
+    view->rotation = 0;
+    view->pieceX = SPAWN_X;
+    view->pieceY = SPAWN_Y;
+}
+
+// Aplica un frame sobre `view`. Devuelve los bytes consumidos o -1.
+static int applyFrame(GameState *view, const uint8_t *data, int size)
+{
+    if (size < 1)
+        return -1;
+
+    uint8_t flags = data[0];
+    int pos = 1;
+    uint32_t value;
+
+    if (flags & FRAME_KEY)
+    {
+        if (!readVarint(data, size, &pos, &value))
+            return -1;
+        view->tick = value;
+
+        if (pos + GRID_BYTES + 3 + QUEUE_BYTES > size)
+            return -1;
+        for (int i = 0; i < GRID_WIDTH * GRID_HEIGHT; i++)
+        {
+            view->grid[i / GRID_WIDTH][i % GRID_WIDTH] = (data[pos + i / 8] >> (i % 8)) & 1;
+        }
+        pos += GRID_BYTES;
+
+        view->currentType = (PieceType)(data[pos] & 7);
+        view->rotation = (data[pos] >> 3) & 3;
+        view->pieceX = (int8_t)data[pos + 1];
+        view->pieceY = (int8_t)data[pos + 2];
+        pos += 3;
+
+        uint32_t queueBits = 0;
+        for (int i = 0; i < QUEUE_BYTES; i++)
+            queueBits |= (uint32_t)data[pos + i] << (8 * i);
+        for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+            view->nextQueue[i] = (PieceType)((queueBits >> (3 * i)) & 7);
+        pos += QUEUE_BYTES;
+
+        uint32_t score, lines, pieces;
+        if (!readVarint(data, size, &pos, &score) || !readVarint(data, size, &pos, &lines) ||
+            !readVarint(data, size, &pos, &pieces))
+            return -1;
+        view->score = (int)score;
+        view->totalLinesCleared = (int)lines;
+        view->piecesPlaced = (int)pieces;
+        view->gameOver = (flags & FRAME_GAME_OVER) != 0;
+        if (view->currentType >= NUM_PIECES)
+            return -1;
+
+        rebuildPiece(view);
+        return pos;
+    }
+
+    uint32_t gap = 0;
+    if ((flags & FRAME_GAP) && !readVarint(data, size, &pos, &gap))
+        return -1;
+    view->tick += gap + 1;
+
+    if (flags & FRAME_LOCK)
+    {
+        if (!readVarint(data, size, &pos, &value))
+            return -1;
+        applyLock(view, value);
+    }
+    if (flags & FRAME_SPAWN)
+    {
+        if (pos >= size || data[pos] >= NUM_PIECES)
+            return -1;
+        applySpawn(view, (PieceType)data[pos++]);
+    }
+    if (flags & FRAME_MOVE)
+    {
+        uint32_t dx, dy;
+        if (!readVarint(data, size, &pos, &dx) || !readVarint(data, size, &pos, &dy))
+            return -1;
+        view->pieceX += unzigzag(dx);
+        view->pieceY += unzigzag(dy);
+    }
+    if (flags & FRAME_ROTATE)
+    {
+        if (pos >= size)
+            return -1;
+        view->rotation = data[pos++] & 3;
+    }
+    if (flags & FRAME_SCORE)
+    {
+        uint32_t dScore, dLines;
+        if (!readVarint(data, size, &pos, &dScore) || !readVarint(data, size, &pos, &dLines))
+            return -1;
+        view->score += (int)dScore;
+        view->totalLinesCleared += (int)dLines;
+    }
+    if (flags & FRAME_GAME_OVER)
+        view->gameOver = true;
+
+    if (flags & (FRAME_SPAWN | FRAME_ROTATE))
+        rebuildPiece(view);
+    return pos;
+}
+
+// ============ ENCODER ============
+
+void initStreamEncoder(StreamEncoder *encoder)
+{
+    memset(encoder, 0, sizeof(*encoder));
+    encoder->keyframeInterval = STREAM_KEYFRAME_INTERVAL;
+}
+
+static int writeKeyframe(const GameState *state, uint8_t *out)
+{
+    int len = 0;
+    out[len++] = FRAME_KEY | (state->gameOver ? FRAME_GAME_OVER : 0);
+    writeVarint(out, &len, state->tick);
+
+    memset(out + len, 0, GRID_BYTES);
+    for (int i = 0; i < GRID_WIDTH * GRID_HEIGHT; i++)
+    {
+        if (state->grid[i / GRID_WIDTH][i % GRID_WIDTH])
+            out[len + i / 8] |= (uint8_t)(1 << (i % 8));
+    }
+    len += GRID_BYTES;
+
+    out[len++] = (uint8_t)(state->currentType | (state->rotation << 3));
+    out[len++] = (uint8_t)(int8_t)state->pieceX;
+    out[len++] = (uint8_t)(int8_t)state->pieceY;
+
+    uint32_t queueBits = 0;
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+        queueBits |= (uint32_t)state->nextQueue[i] << (3 * i);
+    for (int i = 0; i < QUEUE_BYTES; i++)
+        out[len++] = (uint8_t)(queueBits >> (8 * i));
+
+    writeVarint(out, &len, (uint32_t)state->score);
+    writeVarint(out, &len, (uint32_t)state->totalLinesCleared);
+    writeVarint(out, &len, (uint32_t)state->piecesPlaced);
+    return len;
+}
+
+// Arma el delta entre el espejo y `state`. Devuelve 0 si no cambió nada
+// visible y -1 si el cambio no se puede expresar como delta.
+static int writeDelta(const StreamEncoder *encoder, const GameState *state, uint8_t *out)
+{
+    const GameState *mirror = &encoder->mirror;
+    uint8_t payload[STREAM_MAX_FRAME_SIZE];
+    int len = 0;
+    uint8_t flags = 0;
+
+    if (state->gameOver != mirror->gameOver && !state->gameOver)
+        return -1; // Partida nueva
+    if (state->score < mirror->score || state->totalLinesCleared < mirror->totalLinesCleared)
+        return -1;
+
+    // Posición de referencia para el movimiento: la de spawn si hubo lock
+    int baseX = mirror->pieceX;
+    int baseY = mirror->pieceY;
+    int baseRotation = mirror->rotation;
+
+    if (state->piecesPlaced == mirror->piecesPlaced + 1)
+    {
+        flags |= FRAME_LOCK | FRAME_SPAWN;
+        writeVarint(payload, &len, state->lastClearMask);
+        payload[len++] = (uint8_t)state->nextQueue[NEXT_QUEUE_SIZE - 1];
+        baseX = SPAWN_X;
+        baseY = SPAWN_Y;
+        baseRotation = 0;
+    }
+    else if (state->piecesPlaced != mirror->piecesPlaced)
+    {
+        return -1;
+    }
+
+    if (state->pieceX != baseX || state->pieceY != baseY)
+    {
+        flags |= FRAME_MOVE;
+        writeVarint(payload, &len, zigzag(state->pieceX - baseX));
+        writeVarint(payload, &len, zigzag(state->pieceY - baseY));
+    }
+    if (state->rotation != baseRotation)
+    {
+        flags |= FRAME_ROTATE;
+        payload[len++] = (uint8_t)state->rotation;
+    }
+    if (state->score != mirror->score || state->totalLinesCleared != mirror->totalLinesCleared)
+    {
+        flags |= FRAME_SCORE;
+        writeVarint(payload, &len, (uint32_t)(state->score - mirror->score));
+        writeVarint(payload, &len, (uint32_t)(state->totalLinesCleared - mirror->totalLinesCleared));
+    }
+    if (state->gameOver && !mirror->gameOver)
+        flags |= FRAME_GAME_OVER;
+
+    if (flags == 0)
+        return 0;
+
+    int total = 0;
+    uint32_t gap = state->tick - encoder->lastFrameTick - 1;
+    out[total++] = flags | (gap > 0 ? FRAME_GAP : 0);
+    if (gap > 0)
+        writeVarint(out, &total, gap);
+    memcpy(out + total, payload, (size_t)len);
+    return total + len;
+}
+
+// Codifica el tick actual. `out` debe tener STREAM_MAX_FRAME_SIZE bytes.
+// Devuelve los bytes escritos (0 = nada visible cambió en este tick).
+int encodeStreamFrame(StreamEncoder *encoder, const GameState *state, uint8_t *out)
+{
+    int len = -1;
+
+    bool needKey = !encoder->started ||
+                   state->tick <= encoder->lastFrameTick ||
+                   state->tick - encoder->lastKeyTick >= encoder->keyframeInterval;
+
+    if (!needKey)
+    {
+        len = writeDelta(encoder, state, out);
+        if (len == 0)
+            return 0;
+
+        // Verificar contra el espejo: si el delta no reproduce el estado
+        // (p. ej. líneas de basura que no vienen de un lock), mandar keyframe
+        if (len > 0)
+        {
+            GameState check = encoder->mirror;
+            if (applyFrame(&check, out, len) != len || !sameVisibleState(&check, state))
+                len = -1;
+            else
+                encoder->mirror = check;
+        }
+    }
+
+    if (len < 0)
+    {
+        len = writeKeyframe(state, out);
+        applyFrame(&encoder->mirror, out, len);
+        encoder->lastKeyTick = state->tick;
+        encoder->started = true;
+    }
+
+    encoder->lastFrameTick = state->tick;
+    return len;
+}
+
+// ============ DECODER ============
+
+void initStreamDecoder(StreamDecoder *decoder)
+{
+    memset(decoder, 0, sizeof(*decoder));
+}
+
+// Decodifica un frame. Devuelve los bytes consumidos o -1 si el frame está
+// corrupto o es un delta antes del primer keyframe.
+int decodeStreamFrame(StreamDecoder *decoder, const uint8_t *data, int size)
+{
+    if (size < 1)
+        return -1;
+    if (!(data[0] & FRAME_KEY) && !decoder->hasKeyframe)
+        return -1;
+
+    int used = applyFrame(&decoder->view, data, size);
+    if (used > 0 && (data[0] & FRAME_KEY))
+        decoder->hasKeyframe = true;
+    return used;
+}
+
+// Tick al que corresponde el próximo frame, sin aplicarlo
+bool peekStreamFrameTick(const StreamDecoder *decoder, const uint8_t *data, int size, uint32_t *tick)
+{
+    if (size < 1)
+        return false;
+
+    int pos = 1;
+    uint32_t value = 0;
+    if (data[0] & FRAME_KEY)
+    {
+        if (!readVarint(data, size, &pos, &value))
+            return false;
+        *tick = value;
+        return true;
+    }
+
+    if ((data[0] & FRAME_GAP) && !readVarint(data, size, &pos, &value))
+        return false;
+    *tick = decoder->view.tick + value + 1;
+    return true;
+}
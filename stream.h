@@ -0,0 +1,57 @@
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "game.h"
+
+// ============ STREAM DE ESPECTADOR ============
+// Codifica una partida como keyframes + deltas por tick en vez de mandar
+// las 200 celdas cada vez. Un delta solo lleva lo que cambió: movimiento
+// de la pieza, locks (con la máscara de filas eliminadas), la pieza nueva
+// de la cola y el puntaje. Los ticks sin cambios no generan bytes: el
+// próximo frame lleva cuántos ticks se saltearon.
+//
+// El decoder reconstruye exactamente el estado visible (grilla, pieza,
+// cola, puntaje, líneas). Los contadores internos del motor (gravedad,
+// autorepeat, RNG) no viajan.
+
+#define STREAM_MAGIC "TSTR"
+#define STREAM_KEYFRAME_INTERVAL 600 // Un keyframe cada 10 s para quien se une tarde
+#define STREAM_MAX_FRAME_SIZE 64
+
+// Flags del primer byte de cada frame
+#define FRAME_KEY (1 << 0)       // Estado completo
+#define FRAME_LOCK (1 << 1)      // Se fijó la pieza (varint: máscara de filas eliminadas)
+#define FRAME_SPAWN (1 << 2)     // Pieza nueva (byte: pieza que entra al final de la cola)
+#define FRAME_MOVE (1 << 3)      // Varints zigzag: dx, dy
+#define FRAME_ROTATE (1 << 4)    // Byte: rotación nueva
+#define FRAME_SCORE (1 << 5)     // Varints: +puntaje, +líneas
+#define FRAME_GAME_OVER (1 << 6) // Sin payload
+#define FRAME_GAP (1 << 7)       // Varint: ticks sin cambios antes de este frame
+
+typedef struct
+{
+    GameState mirror; // Lo que el decoder tiene reconstruido
+    bool started;
+    uint32_t lastFrameTick;
+    uint32_t lastKeyTick;
+    uint32_t keyframeInterval;
+} StreamEncoder;
+
+typedef struct
+{
+    GameState view; // Solo los campos visibles son válidos
+    bool hasKeyframe;
+} StreamDecoder;
+
+void initStreamEncoder(StreamEncoder *encoder);
+int encodeStreamFrame(StreamEncoder *encoder, const GameState *state, uint8_t *out);
+
+void initStreamDecoder(StreamDecoder *decoder);
+int decodeStreamFrame(StreamDecoder *decoder, const uint8_t *data, int size);
+bool peekStreamFrameTick(const StreamDecoder *decoder, const uint8_t *data, int size, uint32_t *tick);
+
+bool sameVisibleState(const GameState *a, const GameState *b);
+
+#endif // STREAM_H
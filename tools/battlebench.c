@@ -0,0 +1,141 @@
+// Benchmark headless de la batalla de 99 (bots contra bots)
+//
+// Corre la misma batalla con 1 hilo y con N hilos, verifica que el
+// resultado sea idéntico y reporta ticks/s, tiempo por tick (promedio y
+// p99) y cuánto del presupuesto de 16.6 ms por frame consume la simulación.
+//
+// Uso: ./battlebench [--ticks N] [--threads N] [--seed S]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "battle.h"
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int compareU64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+// FNV-1a de todos los tableros y puntajes
+static uint32_t battleChecksum(const Battle *battle)
+{
+    uint32_t hash = 2166136261u;
+    for (int p = 0; p < BATTLE_PLAYERS; p++)
+    {
+        const uint8_t *bytes = (const uint8_t *)battle->games[p].grid;
+        for (size_t i = 0; i < sizeof(battle->games[p].grid); i++)
+        {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        hash = (hash ^ (uint32_t)battle->games[p].score) * 16777619u;
+        hash = (hash ^ (uint32_t)battle->placement[p]) * 16777619u;
+    }
+    return hash;
+}
+
+typedef struct
+{
+    uint32_t checksum;
+    int ticks;
+    int alive;
+    double ticksPerSecond;
+    double averageUs;
+    double p99Us;
+} BenchResult;
+
+static BenchResult runBench(uint32_t seed, int numThreads, int maxTicks)
+{
+    BenchResult result = {0};
+    Battle *battle = createBattle(seed, BATTLE_NO_HUMAN, numThreads);
+    if (battle == NULL)
+        return result;
+
+    uint64_t *tickNs = malloc(sizeof(uint64_t) * (size_t)maxTicks);
+    uint64_t start = nowNs();
+    int ticks = 0;
+    while (ticks < maxTicks && battle->alive > 1)
+    {
+        uint64_t tickStart = nowNs();
+        stepBattle(battle, 0);
+        tickNs[ticks++] = nowNs() - tickStart;
+    }
+    uint64_t elapsed = nowNs() - start;
+
+    qsort(tickNs, (size_t)ticks, sizeof(uint64_t), compareU64);
+    result.checksum = battleChecksum(battle);
+    result.ticks = ticks;
+    result.alive = battle->alive;
+    result.ticksPerSecond = (double)ticks / ((double)elapsed / 1e9);
+    result.averageUs = (double)elapsed / (double)ticks / 1000.0;
+    result.p99Us = ticks > 0 ? (double)tickNs[ticks * 99 / 100] / 1000.0 : 0.0;
+
+    free(tickNs);
+    destroyBattle(battle);
+    return result;
+}
+
+static void printResult(const char *label, int numThreads, const BenchResult *result)
+{
+    double budgetUs = 1e6 / TARGET_FPS;
+    printf("%-10s %2d hilos: %8.0f ticks/s (%9.0f tableros/s) | tick %7.1f us, p99 %7.1f us (%.1f%% del frame)\n",
+           label, numThreads, result->ticksPerSecond, result->ticksPerSecond * BATTLE_PLAYERS,
+           result->averageUs, result->p99Us, result->averageUs * 100.0 / budgetUs);
+}
+
+int main(int argc, char *argv[])
+{
+    int maxTicks = TARGET_FPS * 60 * 3; // 3 minutos de partida
+    int numThreads = getCpuCount();
+    uint32_t seed = 99;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+            maxTicks = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            numThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else
+        {
+            printf("Uso: %s [--ticks N] [--threads N] [--seed S]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (maxTicks < 1)
+        maxTicks = 1;
+
+    printf("Batalla de %d bots, hasta %d ticks, semilla %u\n", BATTLE_PLAYERS, maxTicks, seed);
+
+    BenchResult single = runBench(seed, 1, maxTicks);
+    printResult("Secuencial", 1, &single);
+
+    BenchResult parallel = single;
+    if (numThreads > 1)
+    {
+        parallel = runBench(seed, numThreads, maxTicks);
+        printResult("Paralelo", numThreads, &parallel);
+        printf("Aceleración: %.2fx\n", parallel.ticksPerSecond / single.ticksPerSecond);
+    }
+
+    printf("Ticks simulados: %d, jugadores vivos al final: %d\n", single.ticks, single.alive);
+
+    if (parallel.checksum != single.checksum || parallel.ticks != single.ticks)
+    {
+        printf("ERROR: el resultado depende de la cantidad de hilos (%08x vs %08x)\n",
+               single.checksum, parallel.checksum);
+        return 1;
+    }
+    printf("Resultado idéntico con 1 y %d hilos (checksum %08x)\n", numThreads, single.checksum);
+    return 0;
+}
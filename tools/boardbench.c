@@ -0,0 +1,242 @@
+// Benchmark de los bitboards por tamaño de tablero
+//
+// Juega partidas de colocaciones al azar (pieza, rotación y columna) en
+// cada variante de la tabla de kernels y reporta colocaciones/s. En el
+// tablero del juego repite exactamente las mismas colocaciones con la
+// grilla de enteros (checkCollision/lockPiece/clearCompleteLines) y
+// verifica que tableros y líneas coincidan en cada paso.
+//
+// Uso: ./boardbench [--placements N] [--seed S]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bitboard.h"
+#include "game.h"
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+typedef struct
+{
+    long placements;
+    long lines;
+    long games;
+    double placementsPerSecond;
+} BoardResult;
+
+typedef struct
+{
+    PieceType type;
+    int rotation;
+    int x;
+} Placement;
+
+// Colocación al azar dentro de las paredes (sortea columnas hasta que entre)
+static Placement randomPlacement(uint32_t *rng, int width)
+{
+    Placement placement;
+    placement.type = (PieceType)(nextRandom(rng) % NUM_PIECES);
+    placement.rotation = (int)(nextRandom(rng) % 4);
+    const PieceMask *piece = getPieceMask(placement.type, placement.rotation);
+
+    bool inside = false;
+    while (!inside)
+    {
+        placement.x = (int)(nextRandom(rng) % (uint32_t)(width + 3)) - 3;
+        inside = true;
+        for (int r = 0; r < 4; r++)
+        {
+            uint64_t bits;
+            if (!shiftPieceRow(piece->rows[r], placement.x, width, &bits))
+                inside = false;
+        }
+    }
+    return placement;
+}
+
+static BoardResult runKernels(const BoardKernels *kernels, uint32_t seed, long placements)
+{
+    BoardResult result = {0};
+    void *board = calloc(1, kernels->boardSize);
+    if (board == NULL)
+    {
+        printf("Error al reservar el tablero %s\n", kernels->name);
+        return result;
+    }
+
+    uint32_t rng = seed;
+    uint64_t start = nowNs();
+    while (result.placements < placements)
+    {
+        Placement placement = randomPlacement(&rng, kernels->width);
+        const PieceMask *piece = getPieceMask(placement.type, placement.rotation);
+        int lines = 0;
+        int y = kernels->placePiece(board, piece, placement.x, 0, &lines);
+        if (y < 0)
+        {
+            // Spawn bloqueado: se termina la partida
+            memset(board, 0, kernels->boardSize);
+            result.games++;
+            continue;
+        }
+        result.lines += lines;
+        result.placements++;
+    }
+    uint64_t elapsed = nowNs() - start;
+
+    result.placementsPerSecond = (double)result.placements / ((double)elapsed / 1e9);
+    free(board);
+    return result;
+}
+
+// Mismas reglas que runKernels pero con la grilla de enteros del motor
+static BoardResult runIntGrid(uint32_t seed, long placements)
+{
+    BoardResult result = {0};
+    int grid[GRID_HEIGHT][GRID_WIDTH] = {{0}};
+    int shape[4][4];
+
+    uint32_t rng = seed;
+    uint64_t start = nowNs();
+    while (result.placements < placements)
+    {
+        Placement placement = randomPlacement(&rng, GRID_WIDTH);
+        copyPiece(shape, PIECES[placement.type]);
+        for (int r = 0; r < placement.rotation; r++)
+        {
+            rotatePiece(shape);
+        }
+        if (checkCollision(grid, shape, placement.x, 0))
+        {
+            memset(grid, 0, sizeof(grid));
+            result.games++;
+            continue;
+        }
+        int y = 0;
+        while (!checkCollision(grid, shape, placement.x, y + 1))
+        {
+            y++;
+        }
+        lockPiece(grid, shape, placement.x, y);
+        result.lines += clearCompleteLines(grid);
+        result.placements++;
+    }
+    uint64_t elapsed = nowNs() - start;
+
+    result.placementsPerSecond = (double)result.placements / ((double)elapsed / 1e9);
+    return result;
+}
+
+// Juega las dos versiones en paralelo y compara celda por celda
+static bool verifyStandard(uint32_t seed, long placements)
+{
+    int grid[GRID_HEIGHT][GRID_WIDTH] = {{0}};
+    StandardBoard board = {{0}};
+    StandardBoard expected;
+    int shape[4][4];
+
+    uint32_t rng = seed;
+    for (long i = 0; i < placements; i++)
+    {
+        Placement placement = randomPlacement(&rng, GRID_WIDTH);
+        const PieceMask *piece = getPieceMask(placement.type, placement.rotation);
+        copyPiece(shape, PIECES[placement.type]);
+        for (int r = 0; r < placement.rotation; r++)
+        {
+            rotatePiece(shape);
+        }
+
+        bool intCollides = checkCollision(grid, shape, placement.x, 0);
+        if (intCollides != standardCollides(&board, piece, placement.x, 0))
+        {
+            printf("ERROR: colisión distinta en la colocación %ld\n", i);
+            return false;
+        }
+        if (intCollides)
+        {
+            memset(grid, 0, sizeof(grid));
+            memset(&board, 0, sizeof(board));
+            continue;
+        }
+
+        int y = 0;
+        while (!checkCollision(grid, shape, placement.x, y + 1))
+        {
+            y++;
+        }
+        lockPiece(grid, shape, placement.x, y);
+        int intLines = clearCompleteLines(grid);
+
+        int boardY = standardDropY(&board, piece, placement.x, 0);
+        standardLock(&board, piece, placement.x, boardY);
+        int boardLines = standardClearLines(&board);
+
+        standardFromCells(&expected, &grid[0][0]);
+        if (boardY != y || boardLines != intLines || memcmp(&expected, &board, sizeof(board)) != 0)
+        {
+            printf("ERROR: tableros distintos en la colocación %ld (y %d vs %d, líneas %d vs %d)\n", i, y, boardY,
+                   intLines, boardLines);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void printResult(const char *label, int width, int height, int rowBits, const BoardResult *result)
+{
+    printf("%-10s %2dx%-2d (fila %2d bits): %10.0f colocaciones/s | %ld líneas, %ld partidas\n", label, width,
+           height, rowBits, result->placementsPerSecond, result->lines, result->games);
+}
+
+int main(int argc, char *argv[])
+{
+    long placements = 2000000;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--placements") == 0 && i + 1 < argc)
+            placements = atol(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else
+        {
+            printf("Uso: %s [--placements N] [--seed S]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (placements < 1)
+        placements = 1;
+    if (seed == 0)
+        seed = 1;
+
+    printf("%ld colocaciones al azar por tablero, semilla %u\n", placements, seed);
+
+    for (int i = 0; i < getBoardKernelCount(); i++)
+    {
+        const BoardKernels *kernels = getBoardKernelsByIndex(i);
+        BoardResult result = runKernels(kernels, seed, placements);
+        printResult(kernels->name, kernels->width, kernels->height, kernels->rowBits, &result);
+    }
+
+    BoardResult grid = runIntGrid(seed, placements);
+    printResult("grilla int", GRID_WIDTH, GRID_HEIGHT, 0, &grid);
+
+    const BoardKernels *standard = getBoardKernels(GRID_WIDTH, GRID_HEIGHT);
+    BoardResult bits = runKernels(standard, seed, placements);
+    printf("Bitboard vs grilla: %.2fx\n", bits.placementsPerSecond / grid.placementsPerSecond);
+
+    if (bits.lines != grid.lines || bits.games != grid.games || !verifyStandard(seed, placements))
+    {
+        printf("ERROR: el bitboard no coincide con la grilla de enteros\n");
+        return 1;
+    }
+    printf("Bitboard idéntico a la grilla de enteros en %ld colocaciones\n", placements);
+    return 0;
+}
@@ -0,0 +1,872 @@
+// Pruebas diferenciales: motor de referencia contra los motores optimizados
+//
+// Juega muchas partidas con semilla e inputs al azar (teclas sostenidas
+// al azar, o piezas apuntadas a una colocación) en refengine.c (la
+// copia congelada del motor celda por celda) y, en paralelo tick a tick,
+// en cada motor a probar:
+//
+//   game.c    stepGame tal como está hoy en el árbol
+//   bitboard  el mismo stepGame sobre StandardBoard y PieceMask (bitboard.h)
+//
+// Después de cada tick compara el estado completo (grilla, pieza, cola,
+// puntaje, contadores, RNG) y lo que devolvió el paso. Ante la primera
+// diferencia achica la secuencia de inputs (quita tramos y apaga teclas
+// mientras siga fallando), la guarda en difftest_fail.txt y la reproduce
+// mostrando el campo que difiere. Las partidas se reparten entre núcleos.
+//
+// Uso: ./difftest [--games N] [--threads N] [--seed S] [--max-ticks N]
+//      ./difftest [--inject-bug] --replay difftest_fail.txt
+//
+// --inject-bug rompe el motor bitboard a propósito, para ver al arnés
+// encontrar la diferencia y achicarla.
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bitboard.h"
+#include "refengine.h"
+
+#define MAX_THREADS 64
+#define DEFAULT_MAX_TICKS (TARGET_FPS * 60 * 5) // Cortar partidas a los 5 minutos
+#define FAIL_FILE "difftest_fail.txt"
+
+static bool injectBug = false;
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// ============ MOTOR BITBOARD ============
+// stepGame de game.c con la grilla como StandardBoard y la pieza como
+// PieceMask de (tipo, rotación) en lugar de una matriz 4x4
+
+typedef struct
+{
+    StandardBoard board;
+    PieceType currentType;
+    int rotation;
+    int pieceX;
+    int pieceY;
+    PieceType nextQueue[NEXT_QUEUE_SIZE];
+    int score;
+    int totalLinesCleared;
+    int piecesPlaced;
+    uint32_t lastClearMask;
+    bool gameOver;
+    uint32_t tick;
+    uint32_t rngState;
+    int fallCounter;
+    int moveCooldown;
+    int rotateCooldown;
+} BitGame;
+
+static const PieceMask *currentMask(const BitGame *game)
+{
+    return getPieceMask(game->currentType, game->rotation);
+}
+
+static bool bitSpawnNextPiece(BitGame *game)
+{
+    game->currentType = game->nextQueue[0];
+    memmove(game->nextQueue, game->nextQueue + 1, sizeof(PieceType) * (NEXT_QUEUE_SIZE - 1));
+    game->nextQueue[NEXT_QUEUE_SIZE - 1] = (PieceType)(nextRandom(&game->rngState) % NUM_PIECES);
+    game->rotation = 0;
+    game->pieceX = SPAWN_X;
+    game->pieceY = SPAWN_Y;
+    return !standardCollides(&game->board, currentMask(game), game->pieceX, game->pieceY);
+}
+
+static void bitInitGame(BitGame *game, uint32_t seed)
+{
+    memset(game, 0, sizeof(*game));
+    game->rngState = seed != 0 ? seed : 0x9E3779B9u;
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+        game->nextQueue[i] = (PieceType)(nextRandom(&game->rngState) % NUM_PIECES);
+    bitSpawnNextPiece(game);
+}
+
+static int bitLockCurrentPiece(BitGame *game)
+{
+    standardLock(&game->board, currentMask(game), game->pieceX, game->pieceY);
+    game->piecesPlaced++;
+
+    game->lastClearMask = 0;
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        if (game->board.rows[row] == (StandardRow)BOARD_FULL_ROW(GRID_WIDTH))
+            game->lastClearMask |= 1u << row;
+    }
+
+    int linesCleared = standardClearLines(&game->board);
+    game->totalLinesCleared += linesCleared;
+    game->score += linesCleared * linesCleared * POINTS_MULTIPLIER;
+
+    if (!bitSpawnNextPiece(game))
+        game->gameOver = true;
+    return linesCleared;
+}
+
+static bool bitRotateWithKicks(BitGame *game)
+{
+    const PieceMask *rotated = getPieceMask(game->currentType, game->rotation + 1);
+    if (!standardCollides(&game->board, rotated, game->pieceX, game->pieceY))
+        return true;
+
+    // Con --inject-bug el último kick (2 a la derecha, para la I) no se prueba
+    int kicks = injectBug ? NUM_WALL_KICKS - 1 : NUM_WALL_KICKS;
+    for (int i = 0; i < kicks; i++)
+    {
+        int x = game->pieceX + WALL_KICKS[i][0];
+        int y = game->pieceY + WALL_KICKS[i][1];
+        if (!standardCollides(&game->board, rotated, x, y))
+        {
+            game->pieceX = x;
+            game->pieceY = y;
+            return true;
+        }
+    }
+    return false;
+}
+
+static int bitStepGame(BitGame *game, unsigned inputs)
+{
+    if (game->gameOver)
+        return 0;
+
+    game->tick++;
+    int linesCleared = 0;
+
+    if (game->moveCooldown > 0)
+        game->moveCooldown--;
+    if (game->rotateCooldown > 0)
+        game->rotateCooldown--;
+    if (!(inputs & (INPUT_LEFT | INPUT_RIGHT | INPUT_DOWN)))
+        game->moveCooldown = 0;
+    if (!(inputs & INPUT_ROTATE))
+        game->rotateCooldown = 0;
+
+    if (game->moveCooldown == 0 && (inputs & (INPUT_LEFT | INPUT_RIGHT | INPUT_DOWN)))
+    {
+        const PieceMask *mask = currentMask(game);
+        if ((inputs & INPUT_LEFT) && !standardCollides(&game->board, mask, game->pieceX - 1, game->pieceY))
+            game->pieceX--;
+        if ((inputs & INPUT_RIGHT) && !standardCollides(&game->board, mask, game->pieceX + 1, game->pieceY))
+            game->pieceX++;
+        if ((inputs & INPUT_DOWN) && !standardCollides(&game->board, mask, game->pieceX, game->pieceY + 1))
+            game->pieceY++;
+        game->moveCooldown = MOVE_TICKS;
+    }
+
+    if (game->rotateCooldown == 0 && (inputs & INPUT_ROTATE))
+    {
+        if (bitRotateWithKicks(game))
+            game->rotation = (game->rotation + 1) % 4;
+        game->rotateCooldown = ROTATE_TICKS;
+    }
+
+    game->fallCounter++;
+    if (game->fallCounter >= GRAVITY_TICKS)
+    {
+        game->fallCounter = 0;
+        if (!standardCollides(&game->board, currentMask(game), game->pieceX, game->pieceY + 1))
+            game->pieceY++;
+        else
+            linesCleared = bitLockCurrentPiece(game);
+    }
+    return linesCleared;
+}
+
+// Estado equivalente en la forma de GameState, para compararlo
+static void bitToGameState(const BitGame *game, GameState *state)
+{
+    memset(state, 0, sizeof(*state));
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+            state->grid[row][col] = (game->board.rows[row] >> col) & 1;
+    }
+    const PieceMask *mask = currentMask(game);
+    for (int row = 0; row < 4; row++)
+    {
+        for (int col = 0; col < 4; col++)
+            state->currentPiece[row][col] = (mask->rows[row] >> col) & 1;
+    }
+    state->currentType = game->currentType;
+    state->rotation = game->rotation;
+    state->pieceX = game->pieceX;
+    state->pieceY = game->pieceY;
+    memcpy(state->nextQueue, game->nextQueue, sizeof(state->nextQueue));
+    state->score = game->score;
+    state->totalLinesCleared = game->totalLinesCleared;
+    state->piecesPlaced = game->piecesPlaced;
+    state->lastClearMask = game->lastClearMask;
+    state->gameOver = game->gameOver;
+    state->tick = game->tick;
+    state->rngState = game->rngState;
+    state->fallCounter = game->fallCounter;
+    state->moveCooldown = game->moveCooldown;
+    state->rotateCooldown = game->rotateCooldown;
+}
+
+// ============ MOTORES A PROBAR ============
+
+typedef union
+{
+    GameState game;
+    BitGame bits;
+} EngineState;
+
+typedef struct
+{
+    const char *name;
+    void (*init)(EngineState *engine, uint32_t seed);
+    int (*step)(EngineState *engine, unsigned inputs);
+    void (*view)(const EngineState *engine, GameState *state);
+} Engine;
+
+static void gameInit(EngineState *engine, uint32_t seed)
+{
+    initGame(&engine->game, seed);
+}
+
+static int gameStep(EngineState *engine, unsigned inputs)
+{
+    return stepGame(&engine->game, inputs);
+}
+
+static void gameView(const EngineState *engine, GameState *state)
+{
+    *state = engine->game;
+}
+
+static void bitInit(EngineState *engine, uint32_t seed)
+{
+    bitInitGame(&engine->bits, seed);
+}
+
+static int bitStep(EngineState *engine, unsigned inputs)
+{
+    return bitStepGame(&engine->bits, inputs);
+}
+
+static void bitView(const EngineState *engine, GameState *state)
+{
+    bitToGameState(&engine->bits, state);
+}
+
+static const Engine ENGINES[] = {
+    {"game.c", gameInit, gameStep, gameView},
+    {"bitboard", bitInit, bitStep, bitView},
+};
+#define NUM_ENGINES (int)(sizeof(ENGINES) / sizeof(ENGINES[0]))
+
+// ============ COMPARACIÓN ============
+
+// Describe en `what` el primer campo distinto; false si son iguales
+static bool diffStates(const GameState *a, const GameState *b, char *what, size_t size)
+{
+#define DIFF_FIELD(FIELD, NAME)                                                                        \
+    if (a->FIELD != b->FIELD)                                                                           \
+    {                                                                                                   \
+        snprintf(what, size, "%s: referencia %lld, motor %lld", NAME, (long long)a->FIELD,              \
+                 (long long)b->FIELD);                                                                  \
+        return true;                                                                                    \
+    }
+    char name[32];
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        for (int col = 0; col < GRID_WIDTH; col++)
+        {
+            snprintf(name, sizeof(name), "grid[%d][%d]", row, col);
+            DIFF_FIELD(grid[row][col], name)
+        }
+    }
+    for (int row = 0; row < 4; row++)
+    {
+        for (int col = 0; col < 4; col++)
+        {
+            snprintf(name, sizeof(name), "currentPiece[%d][%d]", row, col);
+            DIFF_FIELD(currentPiece[row][col], name)
+        }
+    }
+    DIFF_FIELD(currentType, "currentType")
+    DIFF_FIELD(rotation, "rotation")
+    DIFF_FIELD(pieceX, "pieceX")
+    DIFF_FIELD(pieceY, "pieceY")
+    for (int i = 0; i < NEXT_QUEUE_SIZE; i++)
+    {
+        snprintf(name, sizeof(name), "nextQueue[%d]", i);
+        DIFF_FIELD(nextQueue[i], name)
+    }
+    DIFF_FIELD(score, "score")
+    DIFF_FIELD(totalLinesCleared, "totalLinesCleared")
+    DIFF_FIELD(piecesPlaced, "piecesPlaced")
+    DIFF_FIELD(lastClearMask, "lastClearMask")
+    DIFF_FIELD(gameOver, "gameOver")
+    DIFF_FIELD(tick, "tick")
+    DIFF_FIELD(rngState, "rngState")
+    DIFF_FIELD(fallCounter, "fallCounter")
+    DIFF_FIELD(moveCooldown, "moveCooldown")
+    DIFF_FIELD(rotateCooldown, "rotateCooldown")
+#undef DIFF_FIELD
+    return false;
+}
+
+typedef struct
+{
+    int tick; // Índice del input después del cual difieren (-1 = nunca)
+    int engine;
+    char what[160];
+} Divergence;
+
+// Juega la misma partida en la referencia y en todos los motores.
+// Devuelve el primer tick con diferencias, o -1 si coinciden hasta el
+// final de los inputs o el Game Over de la referencia.
+static int runLockstep(uint32_t seed, const unsigned *inputs, int count, Divergence *divergence, int *ticksPlayed)
+{
+    GameState reference;
+    EngineState engines[NUM_ENGINES];
+    GameState view;
+    refInitGame(&reference, seed);
+    for (int e = 0; e < NUM_ENGINES; e++)
+        ENGINES[e].init(&engines[e], seed);
+
+    divergence->tick = -1;
+    int tick = -1;
+    for (;;)
+    {
+        for (int e = 0; e < NUM_ENGINES; e++)
+        {
+            ENGINES[e].view(&engines[e], &view);
+            if (memcmp(&reference, &view, sizeof(view)) != 0 &&
+                diffStates(&reference, &view, divergence->what, sizeof(divergence->what)))
+            {
+                divergence->tick = tick;
+                divergence->engine = e;
+                *ticksPlayed = tick + 1;
+                return tick;
+            }
+        }
+        if (reference.gameOver || tick + 1 >= count)
+            break;
+
+        tick++;
+        int expected = refStepGame(&reference, inputs[tick]);
+        for (int e = 0; e < NUM_ENGINES; e++)
+        {
+            int lines = ENGINES[e].step(&engines[e], inputs[tick]);
+            if (lines != expected)
+            {
+                snprintf(divergence->what, sizeof(divergence->what),
+                         "líneas devueltas: referencia %d, motor %d", expected, lines);
+                divergence->tick = tick;
+                divergence->engine = e;
+                *ticksPlayed = tick + 1;
+                return tick;
+            }
+        }
+    }
+    *ticksPlayed = tick + 1;
+    return -1;
+}
+
+// Teclas mantenidas por tramos de 1 a 40 ticks, como una persona: todas
+// las combinaciones posibles, con más peso a bajar para que avance
+static void generateHeldInputs(uint32_t *rng, unsigned *inputs, int count)
+{
+    int tick = 0;
+    while (tick < count)
+    {
+        uint32_t r = nextRandom(rng);
+        unsigned held = r & 0x0F;
+        if (((r >> 4) & 3) == 0)
+            held |= INPUT_DOWN;
+        int length = 1 + (int)((r >> 8) % 40);
+        for (int i = 0; i < length && tick < count; i++)
+            inputs[tick++] = held;
+    }
+}
+
+// Elige dónde poner la pieza actual: la colocación más baja que deje
+// menos huecos debajo, o una al azar de vez en cuando
+static void chooseTarget(const GameState *state, uint32_t r, int *targetX, int *targetRotation)
+{
+    *targetX = (int)(r % (GRID_WIDTH + 3)) - 2;
+    *targetRotation = (int)((r >> 8) & 3);
+    if (((r >> 10) & 7) == 0)
+        return;
+
+    int grid[GRID_HEIGHT][GRID_WIDTH];
+    memcpy(grid, state->grid, sizeof(grid));
+    int bestScore = -1000000;
+    int shape[4][4];
+    copyPiece(shape, PIECES[state->currentType]);
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        for (int x = -2; x <= GRID_WIDTH; x++)
+        {
+            if (checkCollision(grid, shape, x, state->pieceY))
+                continue;
+            int y = state->pieceY;
+            while (!checkCollision(grid, shape, x, y + 1))
+                y++;
+
+            int score = 0;
+            for (int col = 0; col < 4; col++)
+            {
+                int bottom = -1;
+                for (int row = 0; row < 4; row++)
+                {
+                    if (shape[row][col] == 1)
+                        bottom = row;
+                }
+                if (bottom < 0)
+                    continue;
+                score += (y + bottom) * 4;
+                for (int gridRow = y + bottom + 1; gridRow < GRID_HEIGHT && grid[gridRow][x + col] == 0; gridRow++)
+                    score -= 10;
+            }
+            score += (int)((r >> (12 + (x + rotation) % 16)) & 1);
+            if (score > bestScore)
+            {
+                bestScore = score;
+                *targetX = x;
+                *targetRotation = rotation;
+            }
+        }
+        rotatePiece(shape);
+    }
+}
+
+// Con las teclas al azar casi no se completan líneas: acá cada pieza va a
+// una colocación elegida mirando la referencia y baja, con algo de ruido,
+// así se ejercitan la limpieza de líneas y las partidas largas
+static void generateAimedInputs(uint32_t seed, uint32_t *rng, unsigned *inputs, int count)
+{
+    GameState state;
+    refInitGame(&state, seed);
+    int lastPiece = -1;
+    int targetX = 0;
+    int targetRotation = 0;
+    for (int tick = 0; tick < count; tick++)
+    {
+        uint32_t r = nextRandom(rng);
+        if (state.piecesPlaced != lastPiece)
+        {
+            lastPiece = state.piecesPlaced;
+            chooseTarget(&state, r, &targetX, &targetRotation);
+            r = nextRandom(rng);
+        }
+
+        unsigned keys = 0;
+        if (state.rotation != targetRotation && (r & 1))
+            keys |= INPUT_ROTATE;
+        if (state.pieceX < targetX)
+            keys |= INPUT_RIGHT;
+        else if (state.pieceX > targetX)
+            keys |= INPUT_LEFT;
+        else if (state.rotation == targetRotation || ((r >> 1) & 3) == 0)
+            keys |= INPUT_DOWN;
+        if (((r >> 3) & 31) == 0)
+            keys ^= 1u << ((r >> 8) & 3);
+
+        inputs[tick] = keys;
+        refStepGame(&state, keys);
+    }
+}
+
+// Partidas pares con teclas sostenidas al azar, impares apuntando piezas
+static void generateInputs(uint32_t seed, unsigned *inputs, int count)
+{
+    uint32_t rng = seed * 2654435761u + 0x5bd1e995u;
+    if (rng == 0)
+        rng = 1;
+    if (seed & 1)
+        generateAimedInputs(seed, &rng, inputs, count);
+    else
+        generateHeldInputs(&rng, inputs, count);
+}
+
+// ============ ACHICAR ============
+
+static bool stillDiverges(uint32_t seed, const unsigned *inputs, int count, Divergence *divergence)
+{
+    int played;
+    return runLockstep(seed, inputs, count, divergence, &played) >= 0;
+}
+
+// Quita tramos de inputs (de a la mitad, después de a cuartos, ... hasta de
+// a uno) y apaga teclas sueltas mientras la diferencia siga apareciendo.
+// Cada vez que algo sirve, la secuencia se corta en el nuevo tick de la
+// diferencia. Devuelve el largo final.
+static int shrinkInputs(uint32_t seed, unsigned *inputs, int count, Divergence *divergence)
+{
+    unsigned *candidate = malloc(sizeof(unsigned) * (size_t)(count > 0 ? count : 1));
+    Divergence trial;
+    bool progress = true;
+    while (progress)
+    {
+        progress = false;
+
+        for (int chunk = count / 2; chunk >= 1; chunk /= 2)
+        {
+            for (int start = 0; start + chunk <= count;)
+            {
+                int length = count - chunk;
+                memcpy(candidate, inputs, sizeof(unsigned) * (size_t)start);
+                memcpy(candidate + start, inputs + start + chunk, sizeof(unsigned) * (size_t)(length - start));
+                if (stillDiverges(seed, candidate, length, &trial))
+                {
+                    count = trial.tick + 1;
+                    memcpy(inputs, candidate, sizeof(unsigned) * (size_t)count);
+                    *divergence = trial;
+                    progress = true;
+                }
+                else
+                {
+                    start += chunk;
+                }
+            }
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            for (unsigned bit = 1; bit <= INPUT_ROTATE; bit <<= 1)
+            {
+                if (!(inputs[i] & bit))
+                    continue;
+                inputs[i] &= ~bit;
+                if (stillDiverges(seed, inputs, count, &trial))
+                {
+                    count = trial.tick + 1;
+                    *divergence = trial;
+                    progress = true;
+                }
+                else
+                {
+                    inputs[i] |= bit;
+                }
+            }
+        }
+    }
+    free(candidate);
+    return count;
+}
+
+// ============ ARCHIVO DE REPRODUCCIÓN ============
+// Primera línea: la semilla. Después, tramos "TECLAS*TICKS" con las letras
+// L (izquierda), R (derecha), D (abajo) y U (rotar), o "-" sin teclas.
+
+static void formatKeys(unsigned keys, char *out)
+{
+    int n = 0;
+    if (keys & INPUT_LEFT)
+        out[n++] = 'L';
+    if (keys & INPUT_RIGHT)
+        out[n++] = 'R';
+    if (keys & INPUT_DOWN)
+        out[n++] = 'D';
+    if (keys & INPUT_ROTATE)
+        out[n++] = 'U';
+    if (n == 0)
+        out[n++] = '-';
+    out[n] = '\0';
+}
+
+static void writeRepro(FILE *file, uint32_t seed, const unsigned *inputs, int count)
+{
+    fprintf(file, "%u\n", seed);
+    int column = 0;
+    for (int i = 0; i < count;)
+    {
+        int run = 1;
+        while (i + run < count && inputs[i + run] == inputs[i])
+            run++;
+        char keys[8];
+        formatKeys(inputs[i], keys);
+        column += fprintf(file, "%s*%d ", keys, run);
+        if (column > 72)
+        {
+            fprintf(file, "\n");
+            column = 0;
+        }
+        i += run;
+    }
+    fprintf(file, "\n");
+}
+
+static unsigned *readRepro(const char *path, uint32_t *seed, int *count)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        printf("Error al abrir %s\n", path);
+        return NULL;
+    }
+    if (fscanf(file, "%u", seed) != 1)
+    {
+        printf("Error: %s no empieza con una semilla\n", path);
+        fclose(file);
+        return NULL;
+    }
+
+    int capacity = 1024;
+    unsigned *inputs = malloc(sizeof(unsigned) * (size_t)capacity);
+    *count = 0;
+    char token[32];
+    while (fscanf(file, "%31s", token) == 1)
+    {
+        char *star = strchr(token, '*');
+        int run = star != NULL ? atoi(star + 1) : 1;
+        unsigned keys = 0;
+        for (char *c = token; *c != '\0' && *c != '*'; c++)
+        {
+            if (*c == 'L')
+                keys |= INPUT_LEFT;
+            else if (*c == 'R')
+                keys |= INPUT_RIGHT;
+            else if (*c == 'D')
+                keys |= INPUT_DOWN;
+            else if (*c == 'U')
+                keys |= INPUT_ROTATE;
+        }
+        for (int i = 0; i < run; i++)
+        {
+            if (*count == capacity)
+            {
+                capacity *= 2;
+                inputs = realloc(inputs, sizeof(unsigned) * (size_t)capacity);
+            }
+            inputs[(*count)++] = keys;
+        }
+    }
+    fclose(file);
+    return inputs;
+}
+
+static void printBoards(uint32_t seed, const unsigned *inputs, int count, int engineIndex)
+{
+    GameState reference;
+    EngineState engine;
+    GameState view;
+    refInitGame(&reference, seed);
+    ENGINES[engineIndex].init(&engine, seed);
+    for (int i = 0; i < count; i++)
+    {
+        refStepGame(&reference, inputs[i]);
+        ENGINES[engineIndex].step(&engine, inputs[i]);
+    }
+    ENGINES[engineIndex].view(&engine, &view);
+
+    printf("\nReferencia  %s (# bloque fijo, @ pieza)\n", ENGINES[engineIndex].name);
+    for (int row = 0; row < GRID_HEIGHT; row++)
+    {
+        const GameState *states[2] = {&reference, &view};
+        for (int s = 0; s < 2; s++)
+        {
+            const GameState *state = states[s];
+            for (int col = 0; col < GRID_WIDTH; col++)
+            {
+                int pr = row - state->pieceY;
+                int pc = col - state->pieceX;
+                bool piece = pr >= 0 && pr < 4 && pc >= 0 && pc < 4 && state->currentPiece[pr][pc] == 1;
+                putchar(piece ? '@' : state->grid[row][col] ? '#' : '.');
+            }
+            printf("  ");
+        }
+        printf("\n");
+    }
+}
+
+static int replayFile(const char *path)
+{
+    uint32_t seed;
+    int count;
+    unsigned *inputs = readRepro(path, &seed, &count);
+    if (inputs == NULL)
+        return 1;
+
+    Divergence divergence;
+    int played;
+    int tick = runLockstep(seed, inputs, count, &divergence, &played);
+    if (tick < 0)
+    {
+        printf("Semilla %u, %d ticks: todos los motores coinciden con la referencia\n", seed, played);
+        free(inputs);
+        return 0;
+    }
+    printf("Semilla %u: %s difiere en el tick %d: %s\n", seed, ENGINES[divergence.engine].name, tick + 1,
+           divergence.what);
+    printBoards(seed, inputs, tick + 1, divergence.engine);
+    free(inputs);
+    return 1;
+}
+
+// ============ CORRIDA EN PARALELO ============
+
+typedef struct
+{
+    uint32_t baseSeed;
+    int games;
+    int maxTicks;
+    atomic_int nextGame;
+    atomic_bool failed;
+    pthread_mutex_t mutex;
+    int failedGame; // La de menor índice entre las que fallaron
+    Divergence failure;
+    atomic_llong ticks;
+    atomic_llong pieces;
+    atomic_llong lines;
+} DiffRun;
+
+static void *diffWorker(void *arg)
+{
+    DiffRun *run = arg;
+    unsigned *inputs = malloc(sizeof(unsigned) * (size_t)run->maxTicks);
+    long long ticks = 0;
+    long long pieces = 0;
+    long long lines = 0;
+
+    for (;;)
+    {
+        int game = atomic_fetch_add(&run->nextGame, 1);
+        if (game >= run->games || atomic_load(&run->failed))
+            break;
+        uint32_t seed = run->baseSeed + (uint32_t)game;
+        generateInputs(seed, inputs, run->maxTicks);
+
+        Divergence divergence;
+        int played;
+        if (runLockstep(seed, inputs, run->maxTicks, &divergence, &played) >= 0)
+        {
+            pthread_mutex_lock(&run->mutex);
+            if (run->failedGame < 0 || game < run->failedGame)
+            {
+                run->failedGame = game;
+                run->failure = divergence;
+            }
+            pthread_mutex_unlock(&run->mutex);
+            atomic_store(&run->failed, true);
+        }
+        ticks += played;
+
+        // Para el resumen: cuánto se jugó de verdad en cada partida
+        GameState reference;
+        refInitGame(&reference, seed);
+        for (int i = 0; i < played; i++)
+            refStepGame(&reference, inputs[i]);
+        pieces += reference.piecesPlaced;
+        lines += reference.totalLinesCleared;
+    }
+
+    atomic_fetch_add(&run->ticks, ticks);
+    atomic_fetch_add(&run->pieces, pieces);
+    atomic_fetch_add(&run->lines, lines);
+    free(inputs);
+    return NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    DiffRun run;
+    memset(&run, 0, sizeof(run));
+    run.baseSeed = 1;
+    run.games = 20000;
+    run.maxTicks = DEFAULT_MAX_TICKS;
+    run.failedGame = -1;
+    pthread_mutex_init(&run.mutex, NULL);
+    int numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *replayPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            run.games = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            numThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            run.baseSeed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc)
+            run.maxTicks = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--inject-bug") == 0)
+            injectBug = true;
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            replayPath = argv[++i];
+        else
+        {
+            printf("Uso: %s [--games N] [--threads N] [--seed S] [--max-ticks N] [--inject-bug]\n", argv[0]);
+            printf("     %s [--inject-bug] --replay %s\n", argv[0], FAIL_FILE);
+            return 1;
+        }
+    }
+    if (replayPath != NULL)
+        return replayFile(replayPath);
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > MAX_THREADS)
+        numThreads = MAX_THREADS;
+    if (run.maxTicks < 1)
+        run.maxTicks = 1;
+
+    printf("Comparando contra la referencia:");
+    for (int e = 0; e < NUM_ENGINES; e++)
+        printf(" %s", ENGINES[e].name);
+    printf(" (%d partidas, %d hilos%s)\n", run.games, numThreads, injectBug ? ", con bug inyectado" : "");
+
+    uint64_t start = nowNs();
+    pthread_t threads[MAX_THREADS];
+    int started = 0;
+    for (int t = 0; t < numThreads; t++)
+    {
+        if (pthread_create(&threads[started], NULL, diffWorker, &run) == 0)
+            started++;
+    }
+    if (started == 0)
+        diffWorker(&run);
+    for (int t = 0; t < started; t++)
+        pthread_join(threads[t], NULL);
+    double seconds = (double)(nowNs() - start) / 1e9;
+
+    long long ticks = atomic_load(&run.ticks);
+    printf("%lld ticks (%.1f min de juego), %lld piezas, %lld líneas en %.2f s: %.1f M ticks/s por los %d motores\n",
+           ticks, (double)ticks / TARGET_FPS / 60.0, atomic_load(&run.pieces), atomic_load(&run.lines), seconds,
+           (double)ticks / seconds / 1e6, NUM_ENGINES + 1);
+
+    if (run.failedGame < 0)
+    {
+        printf("Sin diferencias\n");
+        return 0;
+    }
+
+    uint32_t seed = run.baseSeed + (uint32_t)run.failedGame;
+    printf("\nSemilla %u: %s difiere en el tick %d: %s\n", seed, ENGINES[run.failure.engine].name,
+           run.failure.tick + 1, run.failure.what);
+
+    int count = run.failure.tick + 1;
+    unsigned *inputs = malloc(sizeof(unsigned) * (size_t)run.maxTicks);
+    generateInputs(seed, inputs, run.maxTicks);
+    start = nowNs();
+    Divergence divergence = run.failure;
+    count = shrinkInputs(seed, inputs, count, &divergence);
+    printf("Achicado a %d ticks en %.2f s: %s en el tick %d: %s\n", count, (double)(nowNs() - start) / 1e9,
+           ENGINES[divergence.engine].name, divergence.tick + 1, divergence.what);
+
+    FILE *file = fopen(FAIL_FILE, "w");
+    if (file != NULL)
+    {
+        writeRepro(file, seed, inputs, count);
+        fclose(file);
+        printf("Guardado en %s (./difftest%s --replay %s)\n", FAIL_FILE, injectBug ? " --inject-bug" : "", FAIL_FILE);
+    }
+    writeRepro(stdout, seed, inputs, count);
+    printBoards(seed, inputs, count, divergence.engine);
+    free(inputs);
+    return 1;
+}
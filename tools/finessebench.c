@@ -0,0 +1,193 @@
+// Tabla de finesse: verificación contra el motor y costo del BFS
+//
+// Juega cada camino de la tabla del tablero vacío con stepGame (un toque,
+// un tick suelto, como un jugador) y verifica que la pieza termine donde
+// la deja dropPiece. Después mide el BFS sobre tableros con obstáculos
+// contra la búsqueda en la tabla e imprime teclas promedio por pieza.
+//
+// Uso: ./finessebench [--boards N] [--seed S] [--table]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bot.h"
+#include "finesse.h"
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void setCurrentPiece(GameState *state, PieceType type)
+{
+    state->currentType = type;
+    copyPiece(state->currentPiece, PIECES[type]);
+    state->rotation = 0;
+    state->pieceX = SPAWN_X;
+    state->pieceY = SPAWN_Y;
+    state->fallCounter = 0;
+    state->moveCooldown = 0;
+    state->rotateCooldown = 0;
+}
+
+// Suelta todo un tick (la pieza anterior se fijó con abajo apretado),
+// toca cada tecla un tick y la suelta el siguiente, después mantiene abajo
+static void playPath(GameState *state, const FinessePath *path)
+{
+    int placed = state->piecesPlaced;
+    stepGame(state, 0);
+    for (int i = 0; i < path->length; i++)
+    {
+        stepGame(state, path->keys[i]);
+        stepGame(state, 0);
+    }
+    while (state->piecesPlaced == placed && !state->gameOver)
+    {
+        stepGame(state, INPUT_DOWN);
+    }
+}
+
+static bool verifyTable(bool print)
+{
+    const char *names = "IOTSZJL";
+    int placements = 0;
+    int totalKeys = 0;
+    int maxKeys = 0;
+
+    for (int type = 0; type < NUM_PIECES; type++)
+    {
+        for (int rotation = 0; rotation < 4; rotation++)
+        {
+            if (print)
+                printf("%c r%d:", names[type], rotation);
+            for (int x = -3; x < GRID_WIDTH; x++)
+            {
+                const FinessePath *path = getFinessePath((PieceType)type, rotation, x);
+                if (path == NULL)
+                    continue;
+
+                GameState played;
+                GameState expected;
+                initGame(&played, 1);
+                setCurrentPiece(&played, (PieceType)type);
+                expected = played;
+
+                playPath(&played, path);
+                if (dropPiece(&expected, rotation, x) < 0 || memcmp(played.grid, expected.grid, sizeof(played.grid)) != 0)
+                {
+                    printf("\nERROR: pieza %c rotación %d x %d no queda donde debe\n", names[type], rotation, x);
+                    return false;
+                }
+
+                if (print)
+                {
+                    printf(" %d:", x);
+                    for (int k = 0; k < path->length; k++)
+                    {
+                        putchar(path->keys[k] == INPUT_LEFT ? 'L' : path->keys[k] == INPUT_RIGHT ? 'R' : 'r');
+                    }
+                    if (path->length == 0)
+                        putchar('-');
+                }
+                placements++;
+                totalKeys += path->length;
+                if (path->length > maxKeys)
+                    maxKeys = path->length;
+            }
+            if (print)
+                putchar('\n');
+        }
+    }
+
+    printf("Tabla: %d colocaciones, %.2f teclas promedio, máximo %d; todas verificadas con stepGame\n",
+           placements, (double)totalKeys / placements, maxKeys);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int numBoards = 2000;
+    uint32_t seed = 1;
+    bool printTable = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--boards") == 0 && i + 1 < argc)
+            numBoards = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--table") == 0)
+            printTable = true;
+        else
+        {
+            printf("Uso: %s [--boards N] [--seed S] [--table]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (numBoards < 1)
+        numBoards = 1;
+
+    if (!verifyTable(printTable))
+        return 1;
+
+    // Tableros de partidas del bot: cada pieza se planifica con la tabla
+    // (si el camino sirve) o con BFS, y se juega tecla por tecla
+    GameState state;
+    initGame(&state, seed);
+    long planned = 0;
+    long fromBfs = 0;
+    long keys = 0;
+    long failures = 0;
+    uint64_t planNs = 0;
+    uint64_t bfsNs = 0;
+
+    for (int board = 0; board < numBoards; board++)
+    {
+        if (state.gameOver)
+            initGame(&state, seed + (uint32_t)board);
+
+        BotMove move;
+        if (!findBestMove(&state, &DEFAULT_BOT_WEIGHTS, &move))
+            break;
+
+        FinessePath path;
+        uint64_t start = nowNs();
+        bool found = planFinesse(&state, move.rotation, move.x, move.y, &path);
+        planNs += nowNs() - start;
+
+        FinessePath bfsPath;
+        start = nowNs();
+        findFinessePath(&state, move.rotation, move.x, move.y, &bfsPath);
+        bfsNs += nowNs() - start;
+
+        if (!found)
+        {
+            failures++;
+            dropPiece(&state, move.rotation, move.x);
+            continue;
+        }
+        const FinessePath *table = getFinessePath(state.currentType, move.rotation, move.x);
+        if (table == NULL || table->length != path.length || memcmp(table->keys, path.keys, (size_t)path.length) != 0)
+            fromBfs++;
+
+        GameState expected = state;
+        dropPiece(&expected, move.rotation, move.x);
+        playPath(&state, &path);
+        if (memcmp(state.grid, expected.grid, sizeof(state.grid)) != 0)
+        {
+            printf("ERROR: el camino de la pieza %d no llega a la jugada del bot\n", board);
+            return 1;
+        }
+        planned++;
+        keys += path.length;
+    }
+
+    printf("%ld piezas del bot jugadas tecla por tecla: %.2f teclas por pieza, %ld con BFS, %ld sin camino\n",
+           planned, planned > 0 ? (double)keys / planned : 0.0, fromBfs, failures);
+    printf("planFinesse: %.2f us por pieza | BFS siempre: %.2f us por pieza\n", (double)planNs / numBoards / 1000.0,
+           (double)bfsNs / numBoards / 1000.0);
+    return 0;
+}
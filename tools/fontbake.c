@@ -0,0 +1,147 @@
+// Genera fontatlas.c: rasteriza los glifos ASCII de una fuente TrueType
+// con FreeType y los empaqueta en un atlas de alfa de 4 bits
+//
+// Solo hace falta para regenerar la fuente embebida (`make font`); el
+// juego compila con el fontatlas.c ya generado y no depende de FreeType.
+//
+// Uso: ./fontbake FUENTE.ttf TAMAÑO_PX > fontatlas.c
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "fontatlas.h"
+
+#define ATLAS_WIDTH 256 // Los glifos se acomodan en estantes de este ancho
+#define PADDING 1       // Separación para que el filtrado no mezcle glifos
+
+typedef struct
+{
+    unsigned char *pixels;
+    int width;
+    int height;
+} GlyphBitmap;
+
+static const char *baseName(const char *path)
+{
+    const char *slash = strrchr(path, '/');
+    return slash != NULL ? slash + 1 : path;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Uso: %s FUENTE.ttf TAMAÑO_PX > fontatlas.c\n", argv[0]);
+        return 1;
+    }
+    int pixelSize = atoi(argv[2]);
+
+    FT_Library library;
+    FT_Face face;
+    if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, argv[1], 0, &face) != 0)
+    {
+        fprintf(stderr, "Error al abrir la fuente %s\n", argv[1]);
+        return 1;
+    }
+    if (pixelSize < 6 || FT_Set_Pixel_Sizes(face, 0, (FT_UInt)pixelSize) != 0)
+    {
+        fprintf(stderr, "Error al elegir tamaño %s\n", argv[2]);
+        return 1;
+    }
+
+    // Rasterizar y acomodar en estantes de izquierda a derecha
+    static FontAtlas atlas;
+    static GlyphBitmap bitmaps[FONT_ATLAS_COUNT];
+    int shelfX = 0;
+    int shelfY = 0;
+    int shelfHeight = 0;
+    for (int i = 0; i < FONT_ATLAS_COUNT; i++)
+    {
+        if (FT_Load_Char(face, (FT_ULong)(FONT_ATLAS_FIRST + i), FT_LOAD_RENDER) != 0)
+        {
+            fprintf(stderr, "Error al rasterizar el carácter %d\n", FONT_ATLAS_FIRST + i);
+            return 1;
+        }
+        FT_GlyphSlot slot = face->glyph;
+        GlyphBitmap *bitmap = &bitmaps[i];
+        bitmap->width = (int)slot->bitmap.width;
+        bitmap->height = (int)slot->bitmap.rows;
+        bitmap->pixels = malloc((size_t)(bitmap->width * bitmap->height) + 1);
+        for (int y = 0; y < bitmap->height; y++)
+        {
+            memcpy(bitmap->pixels + y * bitmap->width, slot->bitmap.buffer + y * slot->bitmap.pitch,
+                   (size_t)bitmap->width);
+        }
+
+        if (shelfX + bitmap->width > ATLAS_WIDTH)
+        {
+            shelfX = 0;
+            shelfY += shelfHeight + PADDING;
+            shelfHeight = 0;
+        }
+        FontGlyph *glyph = &atlas.glyphs[i];
+        glyph->x = (unsigned short)shelfX;
+        glyph->y = (unsigned short)shelfY;
+        glyph->width = (unsigned char)bitmap->width;
+        glyph->height = (unsigned char)bitmap->height;
+        glyph->left = (signed char)slot->bitmap_left;
+        glyph->top = (signed char)slot->bitmap_top;
+        glyph->advance = (unsigned char)(slot->advance.x >> 6);
+
+        shelfX += bitmap->width + PADDING;
+        if (bitmap->height > shelfHeight)
+            shelfHeight = bitmap->height;
+    }
+
+    atlas.width = ATLAS_WIDTH;
+    atlas.height = shelfY + shelfHeight;
+    atlas.ascent = (int)(face->size->metrics.ascender >> 6);
+    atlas.lineHeight = (int)((face->size->metrics.ascender - face->size->metrics.descender) >> 6);
+
+    // Alfa de 8 bits -> 4 bits, pixel par en el nibble bajo
+    size_t alphaSize = (size_t)(atlas.width * atlas.height) / 2;
+    unsigned char *alpha = calloc(alphaSize, 1);
+    for (int i = 0; i < FONT_ATLAS_COUNT; i++)
+    {
+        const FontGlyph *glyph = &atlas.glyphs[i];
+        for (int y = 0; y < glyph->height; y++)
+        {
+            for (int x = 0; x < glyph->width; x++)
+            {
+                int value = (bitmaps[i].pixels[y * glyph->width + x] * 15 + 127) / 255;
+                size_t pixel = (size_t)(glyph->y + y) * (size_t)atlas.width + glyph->x + x;
+                alpha[pixel / 2] |= (unsigned char)(value << (pixel % 2 * 4));
+            }
+        }
+        free(bitmaps[i].pixels);
+    }
+
+    printf("// Generado por tools/fontbake.c a partir de %s a %d px. No editar:\n", baseName(argv[1]), pixelSize);
+    printf("// regenerar con `make font`. La fuente DejaVu se distribuye bajo la\n");
+    printf("// licencia de Bitstream Vera, que permite embeberla.\n\n");
+    printf("#include \"fontatlas.h\"\n\n");
+    printf("static const unsigned char ALPHA[%zu] = {", alphaSize);
+    for (size_t i = 0; i < alphaSize; i++)
+    {
+        printf("%s0x%02x,", i % 16 == 0 ? "\n    " : " ", alpha[i]);
+    }
+    printf("\n};\n\n");
+
+    printf("const FontAtlas FONT_ATLAS = {\n");
+    printf("    %d, %d, %d, %d,\n    {\n", atlas.width, atlas.height, atlas.ascent, atlas.lineHeight);
+    for (int i = 0; i < FONT_ATLAS_COUNT; i++)
+    {
+        const FontGlyph *glyph = &atlas.glyphs[i];
+        int c = FONT_ATLAS_FIRST + i;
+        printf("        {%d, %d, %d, %d, %d, %d, %d}, // %s%c%s\n", glyph->x, glyph->y, glyph->width, glyph->height,
+               glyph->left, glyph->top, glyph->advance, c == '\'' || c == '\\' ? "'\\" : "'", (char)c, "'");
+    }
+    printf("    },\n    ALPHA,\n};\n");
+
+    free(alpha);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
@@ -0,0 +1,206 @@
+// Autoguardado de la partida: costo por tick y tiempo de reanudar
+//
+// Juega partidas con teclas al azar como lo haría el bucle del juego,
+// llamando a journalRecord después de cada stepGame, y mide cuánto tarda
+// cada llamada (promedio, p99 y peor caso, que son los ticks que escriben)
+// frente a los 16.7 ms de un frame. Cada tanto simula que el proceso
+// muere: reanuda desde lo que hay en disco y verifica que el estado sea
+// exactamente el del último tick escrito, también con el último registro
+// cortado a la mitad.
+//
+// Uso: ./journalbench [--ticks N] [--seed S] [--path ARCHIVO]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "journal.h"
+#include "metrics.h"
+
+#define CRASH_EVERY 997 // Ticks entre muertes simuladas (primo: cae en cualquier punto del ciclo)
+
+static int compareNs(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static long fileSize(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return -1;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+// Muere el proceso: reanuda desde el archivo y compara con el último
+// estado que llegó a disco. Con `tear`, además corta el archivo a mitad
+// del último registro: tiene que volver al estado de la tanda anterior.
+static bool checkResume(const char *path, const GameState *flushed, const GameState *beforeLast, bool tear,
+                        uint64_t *resumeNs, int *maxReplayed)
+{
+    char username[52];
+    GameState resumed;
+    int replayed;
+
+    if (tear)
+    {
+        long size = fileSize(path);
+        if (size < 0 || truncate(path, size - 3) != 0)
+        {
+            printf("Error al cortar %s\n", path);
+            return false;
+        }
+    }
+
+    uint64_t start = metricsNowNs();
+    bool ok = journalResume(path, username, sizeof(username), &resumed, &replayed);
+    uint64_t elapsed = metricsNowNs() - start;
+    if (elapsed > *resumeNs)
+        *resumeNs = elapsed;
+    if (replayed > *maxReplayed)
+        *maxReplayed = replayed;
+
+    const GameState *expected = tear ? beforeLast : flushed;
+    if (!ok || strcmp(username, "bench") != 0 || memcmp(&resumed, expected, sizeof(resumed)) != 0)
+    {
+        printf("Reanudar dio otro estado en el tick %u%s: score %d/%d, tick %u/%u\n", flushed->tick,
+               tear ? " (registro cortado)" : "", resumed.score, expected->score, resumed.tick, expected->tick);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    int totalTicks = 200000;
+    uint32_t seed = 1;
+    const char *path = "journalbench.journal";
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+            totalTicks = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--path") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else
+        {
+            printf("Uso: %s [--ticks N] [--seed S] [--path ARCHIVO]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (totalTicks < 1)
+    {
+        printf("Los valores tienen que ser positivos\n");
+        return 1;
+    }
+
+    uint32_t *recordNs = malloc((size_t)totalTicks * sizeof(uint32_t));
+    if (recordNs == NULL)
+    {
+        printf("Error al reservar memoria\n");
+        return 1;
+    }
+
+    Journal journal;
+    GameState state, flushed, beforeLast;
+    uint32_t rng = seed;
+    initGame(&state, seed);
+    if (!journalBegin(&journal, path, "bench", &state))
+        return 1;
+    flushed = beforeLast = state;
+
+    uint64_t stepTotal = 0;
+    uint64_t resumeNs = 0;
+    int maxReplayed = 0;
+    int games = 1;
+    int crashes = 0;
+    uint64_t bytes = 0;
+    unsigned held = 0;
+    bool lastWasInputs = false; // Lo último escrito fue una tanda de inputs (y no un snapshot)
+    bool ok = true;
+
+    for (int t = 0; t < totalTicks && ok; t++)
+    {
+        // Teclas sostenidas unos ticks, como un jugador
+        rng = rng * 1103515245u + 12345u;
+        if ((rng >> 16) % 8 == 0)
+            held = (rng >> 24) & (INPUT_LEFT | INPUT_RIGHT | INPUT_DOWN | INPUT_ROTATE);
+
+        int snapshots = journal.snapshots;
+        uint64_t start = metricsNowNs();
+        stepGame(&state, held);
+        uint64_t stepped = metricsNowNs();
+        journalRecord(&journal, held, &state);
+        uint64_t recorded = metricsNowNs();
+        stepTotal += stepped - start;
+        recordNs[t] = (uint32_t)(recorded - stepped);
+
+        if (journal.pendingCount == 0)
+        {
+            beforeLast = flushed;
+            flushed = state;
+            lastWasInputs = journal.snapshots == snapshots;
+        }
+
+        if (t % CRASH_EVERY == CRASH_EVERY - 1)
+        {
+            ok = checkResume(path, &flushed, &beforeLast, false, &resumeNs, &maxReplayed);
+            crashes++;
+        }
+
+        if (state.gameOver)
+        {
+            bytes += journal.bytesWritten;
+            journalDiscard(&journal);
+            initGame(&state, rng);
+            if (!journalBegin(&journal, path, "bench", &state))
+                return 1;
+            flushed = beforeLast = state;
+            lastWasInputs = false;
+            games++;
+        }
+    }
+    bytes += journal.bytesWritten;
+
+    // La última tanda cortada a la mitad, como si muriera escribiéndola
+    if (journal.pendingCount > 0)
+    {
+        journalFlush(&journal);
+        beforeLast = flushed;
+        flushed = state;
+        lastWasInputs = true;
+    }
+    if (ok && lastWasInputs)
+    {
+        ok = checkResume(path, &flushed, &beforeLast, true, &resumeNs, &maxReplayed);
+        crashes++;
+    }
+    journalDiscard(&journal);
+
+    qsort(recordNs, (size_t)totalTicks, sizeof(uint32_t), compareNs);
+    uint64_t recordTotal = 0;
+    for (int t = 0; t < totalTicks; t++)
+        recordTotal += recordNs[t];
+    double average = (double)recordTotal / totalTicks;
+    double frameNs = 1e9 / TARGET_FPS;
+    uint32_t worst = recordNs[totalTicks - 1];
+
+    printf("%d ticks en %d partidas, snapshot cada %d ticks, fflush cada %d\n", totalTicks, games,
+           JOURNAL_SNAPSHOT_TICKS, JOURNAL_FLUSH_TICKS);
+    printf("stepGame:      %.0f ns/tick\n", (double)stepTotal / totalTicks);
+    printf("journalRecord: %.0f ns/tick (%.4f%% del frame), p99 %u ns, peor %u ns (%.3f%% del frame)\n", average,
+           average / frameNs * 100.0, recordNs[(size_t)totalTicks * 99 / 100], worst, worst / frameNs * 100.0);
+    printf("Escrito:       %.1f bytes por segundo de partida\n", (double)bytes / totalTicks * TARGET_FPS);
+    printf("Reanudar:      %d muertes simuladas, peor %.3f ms (%d ticks re-simulados): %s\n", crashes,
+           (double)resumeNs / 1e6, maxReplayed, ok ? "OK" : "DISTINTO");
+
+    free(recordNs);
+    return ok ? 0 : 1;
+}
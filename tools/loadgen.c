@@ -0,0 +1,385 @@
+// Generador de carga para el servidor headless (tetrisd)
+//
+// Abre muchas sesiones contra el servidor local, les manda inputs
+// aleatorios y mide el tiempo de respuesta: desde que sale un input hasta
+// que llega el primer MSG_STATE que lo incluye.
+//
+// Uso: ./loadgen [--sessions N] [--seconds S] [--rate HZ] [--port P | --unix RUTA]
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include "game.h"
+#include "protocol.h"
+
+#define READ_BUF_SIZE 8192
+#define MAX_EPOLL_EVENTS 256
+
+typedef struct
+{
+    int fd;
+    uint32_t rng;
+    uint32_t seq;
+    uint32_t probeSeq;    // Input cuyo tiempo de respuesta se está midiendo
+    uint64_t probeSentNs; // 0 = ninguno pendiente
+    uint64_t nextSendNs;
+    uint8_t readBuf[READ_BUF_SIZE];
+    int readLen;
+} Client;
+
+typedef struct
+{
+    uint32_t *items;
+    size_t count;
+    size_t capacity;
+} Samples;
+
+typedef struct
+{
+    bool received;
+    uint32_t sessions;
+    uint64_t ticks;
+    uint32_t overruns;
+    uint32_t tickP50;
+    uint32_t tickP99;
+    uint32_t tickMax;
+    uint64_t dropped;
+} ServerStats;
+
+static uint64_t statesReceived = 0;
+static uint64_t gamesFinished = 0;
+static ServerStats serverStats;
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void addSample(Samples *samples, uint32_t value)
+{
+    if (samples->count == samples->capacity)
+    {
+        samples->capacity = samples->capacity ? samples->capacity * 2 : 4096;
+        samples->items = realloc(samples->items, sizeof(uint32_t) * samples->capacity);
+    }
+    samples->items[samples->count++] = value;
+}
+
+static int compareU32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentileMs(const Samples *samples, int percent)
+{
+    if (samples->count == 0)
+        return 0.0;
+    size_t index = samples->count * (size_t)percent / 100;
+    if (index >= samples->count)
+        index = samples->count - 1;
+    return samples->items[index] / 1000.0;
+}
+
+static int connectTo(int port, const char *socketPath)
+{
+    int fd;
+    if (socketPath != NULL)
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        struct sockaddr_un addr = {0};
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, socketPath, sizeof(addr.sun_path) - 1);
+        if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+        {
+            close(fd);
+            return -1;
+        }
+    }
+    else
+    {
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        struct sockaddr_in addr = {0};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons((uint16_t)port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+        {
+            close(fd);
+            return -1;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+static void sendMessage(Client *client, const uint8_t *msg, int size)
+{
+    // Los mensajes son chicos: si el socket está lleno se pierden
+    if (send(client->fd, msg, (size_t)size, MSG_NOSIGNAL | MSG_DONTWAIT) < 0 && errno != EAGAIN)
+    {
+        close(client->fd);
+        client->fd = -1;
+    }
+}
+
+static void sendHello(Client *client)
+{
+    uint8_t msg[MSG_HEADER_SIZE + 4];
+    putHeader(msg, MSG_HELLO, 4);
+    putU32(msg + MSG_HEADER_SIZE, nextRandom(&client->rng));
+    sendMessage(client, msg, sizeof(msg));
+}
+
+static void sendInput(Client *client, uint64_t now)
+{
+    uint32_t r = nextRandom(&client->rng);
+    unsigned inputs = INPUT_DOWN;
+    if ((r & 3) == 0)
+        inputs |= INPUT_LEFT;
+    else if ((r & 3) == 1)
+        inputs |= INPUT_RIGHT;
+    if (((r >> 2) & 3) == 0)
+        inputs |= INPUT_ROTATE;
+
+    client->seq++;
+    uint8_t msg[MSG_HEADER_SIZE + 5];
+    putHeader(msg, MSG_INPUT, 5);
+    msg[MSG_HEADER_SIZE] = (uint8_t)inputs;
+    putU32(msg + MSG_HEADER_SIZE + 1, client->seq);
+    sendMessage(client, msg, sizeof(msg));
+
+    if (client->probeSentNs == 0)
+    {
+        client->probeSeq = client->seq;
+        client->probeSentNs = now;
+    }
+}
+
+static void handleMessage(Client *client, MessageType type, const uint8_t *payload, Samples *latencies)
+{
+    if (type == MSG_STATE)
+    {
+        statesReceived++;
+        uint32_t ackSeq = getU32(payload + 4);
+        if (client->probeSentNs != 0 && ackSeq >= client->probeSeq)
+        {
+            addSample(latencies, (uint32_t)((nowNs() - client->probeSentNs) / 1000));
+            client->probeSentNs = 0;
+        }
+    }
+    else if (type == MSG_GAME_OVER)
+    {
+        gamesFinished++;
+        sendHello(client); // Empezar otra partida en la misma sesión
+    }
+    else if (type == MSG_STATS)
+    {
+        serverStats.received = true;
+        serverStats.sessions = getU32(payload);
+        serverStats.ticks = getU64(payload + 4);
+        serverStats.overruns = getU32(payload + 12);
+        serverStats.tickP50 = getU32(payload + 16);
+        serverStats.tickP99 = getU32(payload + 20);
+        serverStats.tickMax = getU32(payload + 24);
+        serverStats.dropped = getU64(payload + 28);
+    }
+}
+
+static void readClient(Client *client, Samples *latencies)
+{
+    while (client->fd >= 0)
+    {
+        ssize_t n = recv(client->fd, client->readBuf + client->readLen,
+                         (size_t)(READ_BUF_SIZE - client->readLen), MSG_DONTWAIT);
+        if (n <= 0)
+        {
+            if (n == 0 || (errno != EAGAIN && errno != EINTR))
+            {
+                close(client->fd);
+                client->fd = -1;
+            }
+            return;
+        }
+        client->readLen += (int)n;
+
+        int offset = 0;
+        while (client->readLen - offset >= MSG_HEADER_SIZE)
+        {
+            uint16_t size = getU16(client->readBuf + offset);
+            if (client->readLen - offset < MSG_HEADER_SIZE + size)
+                break;
+            handleMessage(client, (MessageType)client->readBuf[offset + 2],
+                          client->readBuf + offset + MSG_HEADER_SIZE, latencies);
+            offset += MSG_HEADER_SIZE + size;
+        }
+        memmove(client->readBuf, client->readBuf + offset, (size_t)(client->readLen - offset));
+        client->readLen -= offset;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int numSessions = 1000;
+    int seconds = 10;
+    int rate = 10; // Inputs por segundo por sesión
+    int port = SERVER_DEFAULT_PORT;
+    const char *socketPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--sessions") == 0 && i + 1 < argc)
+            numSessions = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+            seconds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--rate") == 0 && i + 1 < argc)
+            rate = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+            port = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--unix") == 0 && i + 1 < argc)
+            socketPath = argv[++i];
+        else
+        {
+            printf("Uso: %s [--sessions N] [--seconds S] [--rate HZ] [--port P | --unix RUTA]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (rate < 1)
+        rate = 1;
+
+    Client *clients = calloc((size_t)numSessions, sizeof(Client));
+    Samples latencies = {0};
+    int epollFd = epoll_create1(0);
+    uint64_t period = 1000000000ULL / (uint64_t)rate;
+    uint64_t start = nowNs();
+    int connected = 0;
+
+    for (int i = 0; i < numSessions; i++)
+    {
+        Client *client = &clients[i];
+        client->rng = (uint32_t)i * 2654435761u + 1;
+        client->fd = connectTo(port, socketPath);
+        if (client->fd < 0)
+            continue;
+
+        connected++;
+        // Repartir los envíos a lo largo del período para no sincronizarlos
+        client->nextSendNs = start + period * (uint64_t)i / (uint64_t)numSessions;
+
+        struct epoll_event ev = {0};
+        ev.events = EPOLLIN;
+        ev.data.ptr = client;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, client->fd, &ev);
+        sendHello(client);
+    }
+
+    printf("Sesiones conectadas: %d de %d\n", connected, numSessions);
+    if (connected == 0)
+        return 1;
+
+    start = nowNs();
+    uint64_t end = start + (uint64_t)seconds * 1000000000ULL;
+    struct epoll_event events[MAX_EPOLL_EVENTS];
+    bool statsRequested = false;
+    uint64_t statsDeadline = 0;
+
+    while (true)
+    {
+        uint64_t now = nowNs();
+
+        // Al terminar el tiempo, pedir estadísticas por la primera sesión viva
+        if (now >= end && !statsRequested)
+        {
+            for (int i = 0; i < numSessions; i++)
+            {
+                if (clients[i].fd >= 0)
+                {
+                    uint8_t msg[MSG_HEADER_SIZE];
+                    putHeader(msg, MSG_STATS_REQUEST, 0);
+                    sendMessage(&clients[i], msg, sizeof(msg));
+                    break;
+                }
+            }
+            statsRequested = true;
+            statsDeadline = now + 1000000000ULL;
+        }
+        if (statsRequested && (serverStats.received || now >= statsDeadline))
+            break;
+
+        int n = epoll_wait(epollFd, events, MAX_EPOLL_EVENTS, 1);
+        for (int i = 0; i < n; i++)
+        {
+            readClient((Client *)events[i].data.ptr, &latencies);
+        }
+
+        if (statsRequested)
+            continue;
+
+        now = nowNs();
+        for (int i = 0; i < numSessions; i++)
+        {
+            Client *client = &clients[i];
+            if (client->fd >= 0 && now >= client->nextSendNs)
+            {
+                sendInput(client, now);
+                client->nextSendNs += period;
+            }
+        }
+    }
+
+    double elapsed = (double)(nowNs() - start) / 1e9;
+    int alive = 0;
+    for (int i = 0; i < numSessions; i++)
+    {
+        if (clients[i].fd >= 0)
+        {
+            alive++;
+            close(clients[i].fd);
+        }
+    }
+
+    qsort(latencies.items, latencies.count, sizeof(uint32_t), compareU32);
+
+    printf("Sesiones activas al final: %d\n", alive);
+    printf("Estados recibidos: %llu (%.0f/s), partidas terminadas: %llu\n",
+           (unsigned long long)statesReceived, statesReceived / elapsed,
+           (unsigned long long)gamesFinished);
+    printf("Respuesta input->estado: p50 %.2f ms, p99 %.2f ms, máx %.2f ms (%zu muestras)\n",
+           percentileMs(&latencies, 50), percentileMs(&latencies, 99),
+           latencies.count ? latencies.items[latencies.count - 1] / 1000.0 : 0.0, latencies.count);
+
+    if (serverStats.received)
+    {
+        printf("Servidor: %u sesiones, %llu ticks (%u atrasados), tick p50 %u us, p99 %u us, máx %u us, "
+               "estados descartados %llu\n",
+               serverStats.sessions, (unsigned long long)serverStats.ticks, serverStats.overruns,
+               serverStats.tickP50, serverStats.tickP99, serverStats.tickMax,
+               (unsigned long long)serverStats.dropped);
+    }
+    else
+    {
+        printf("El servidor no respondió las estadísticas\n");
+    }
+
+    free(latencies.items);
+    free(clients);
+    close(epollFd);
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Métricas: costo de registrar con shards por hilo
+//
+// N hilos suman a un contador y observan un histograma M veces cada uno,
+// primero con metricsAdd/metricsObserve (un shard por hilo) y después con
+// un fetch_add sobre un contador compartido, que es lo que se evita.
+// Verifica que la suma exportada sea exacta.
+//
+// Uso: ./metricsbench [--threads N] [--ops M] [--print]
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "metrics.h"
+
+static uint64_t opsPerThread = 20000000;
+static _Atomic uint64_t sharedCounter;
+
+static void *shardedWorker(void *arg)
+{
+    (void)arg;
+    for (uint64_t i = 0; i < opsPerThread; i++)
+    {
+        metricsAdd(METRIC_PIECES_PLACED, 1);
+    }
+    for (uint64_t i = 0; i < opsPerThread / 10; i++)
+    {
+        metricsObserve(METRIC_FRAME_TIME, (i & 31) * 1000000ULL);
+    }
+    return NULL;
+}
+
+static void *sharedWorker(void *arg)
+{
+    (void)arg;
+    for (uint64_t i = 0; i < opsPerThread; i++)
+    {
+        atomic_fetch_add_explicit(&sharedCounter, 1, memory_order_relaxed);
+    }
+    return NULL;
+}
+
+static double runThreads(int numThreads, void *(*worker)(void *))
+{
+    pthread_t threads[64];
+    uint64_t start = metricsNowNs();
+    for (int i = 0; i < numThreads; i++)
+    {
+        pthread_create(&threads[i], NULL, worker, NULL);
+    }
+    for (int i = 0; i < numThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    return (double)(metricsNowNs() - start);
+}
+
+int main(int argc, char *argv[])
+{
+    int numThreads = 4;
+    bool print = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            numThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--ops") == 0 && i + 1 < argc)
+            opsPerThread = strtoull(argv[++i], NULL, 10);
+        else if (strcmp(argv[i], "--print") == 0)
+            print = true;
+        else
+        {
+            printf("Uso: %s [--threads N] [--ops M] [--print]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > 64)
+        numThreads = 64;
+
+    uint64_t total = opsPerThread * (uint64_t)numThreads;
+    double shardedNs = runThreads(numThreads, shardedWorker);
+    double sharedNs = runThreads(numThreads, sharedWorker);
+
+    // Hilos que corren a la vez de verdad (con menos núcleos se turnan)
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int parallel = cores > 0 && cores < numThreads ? (int)cores : numThreads;
+
+    uint64_t counted = metricsCounterValue(METRIC_PIECES_PLACED);
+    printf("%d hilos, %llu sumas por hilo\n", numThreads, (unsigned long long)opsPerThread);
+    printf("shards por hilo:     %6.2f ns por suma (%.0f M/s en total, incluye observaciones)\n",
+           shardedNs * parallel / (double)(total + total / 10), (double)(total + total / 10) / shardedNs * 1000.0);
+    printf("fetch_add compartido: %6.2f ns por suma (%.0f M/s en total)\n", sharedNs * parallel / (double)total,
+           (double)total / sharedNs * 1000.0);
+
+    if (counted != total)
+    {
+        printf("ERROR: el contador exportado da %llu, se esperaba %llu\n", (unsigned long long)counted,
+               (unsigned long long)total);
+        return 1;
+    }
+    printf("Suma exportada exacta: %llu\n", (unsigned long long)counted);
+
+    if (print)
+    {
+        static char text[16384];
+        metricsRender(text, sizeof(text));
+        fputs(text, stdout);
+    }
+    return 0;
+}
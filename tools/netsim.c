@@ -0,0 +1,185 @@
+// Simulador de red para el rollback del modo versus
+//
+// Corre los dos peers en el mismo proceso, conectados por UDP en loopback,
+// con demora, jitter y pérdida simulados. Los dos jugadores son bots con
+// pesos distintos, así hay líneas, basura que cruza de un tablero al otro
+// y rollbacks sobre esos intercambios. Al final compara el estado de ambos
+// peers contra una simulación de referencia sin red; falla también si en
+// la partida no entró basura, porque entonces no se probó lo difícil.
+//
+// Uso: ./netsim [--frames N] [--delay MS] [--jitter MS] [--loss PCT] [--seed S]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bot.h"
+#include "netplay.h"
+#include "rollback.h"
+
+#define BASE_PORT 47000
+#define RESIM_BENCH_RUNS 1000
+
+// El rival del bot por defecto: más agresivo con las líneas, así los dos
+// no limpian siempre a la vez y la basura no se cancela entera
+static const BotWeights RIVAL_BOT_WEIGHTS = {{-0.30f, 1.20f, -0.30f, -0.10f}};
+
+// Referencia: los dos bots en la misma máquina, sin red. Sus teclas son
+// los inputs "verdaderos" que después manda cada peer. Devuelve cuántas
+// veces entró basura en algún tablero.
+static int playReference(VersusState *reference, uint8_t *inputs[2], uint32_t frames, uint32_t seed)
+{
+    Bot bots[2];
+    initBot(&bots[0], &DEFAULT_BOT_WEIGHTS);
+    initBot(&bots[1], &RIVAL_BOT_WEIGHTS);
+    initVersus(reference, seed);
+
+    int garbageInserted = 0;
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        for (int p = 0; p < 2; p++)
+            inputs[p][f] = (uint8_t)botInputs(&bots[p], &reference->players[p]);
+
+        uint32_t garbageRng = reference->garbageRng; // Avanza con cada tanda de basura
+        stepVersus(reference, inputs[0][f], inputs[1][f]);
+        if (reference->garbageRng != garbageRng)
+            garbageInserted++;
+    }
+    return garbageInserted;
+}
+
+// Peor caso pedido: corregir una predicción de hace ROLLBACK_WINDOW frames
+static void benchmarkResimulation(uint32_t seed)
+{
+    RollbackSession *session = malloc(sizeof(RollbackSession));
+    uint64_t totalNs = 0;
+    uint64_t worstNs = 0;
+
+    for (int run = 0; run < RESIM_BENCH_RUNS; run++)
+    {
+        initRollback(session, seed + (uint32_t)run, 0);
+        for (int f = 0; f < ROLLBACK_WINDOW - 1; f++)
+            rollbackAdvance(session, INPUT_DOWN);
+
+        // El rival en realidad apretaba otra cosa desde el frame 0
+        rollbackAddRemoteInput(session, 0, INPUT_LEFT | INPUT_ROTATE);
+        rollbackResolve(session);
+        totalNs += session->stats.resimulateNs;
+        if (session->stats.maxResimulateNs > worstNs)
+            worstNs = session->stats.maxResimulateNs;
+    }
+
+    printf("Rollback de %d frames: promedio %.1f us, peor %.1f us (presupuesto por frame: %d us)\n",
+           ROLLBACK_WINDOW - 1, totalNs / 1000.0 / RESIM_BENCH_RUNS, worstNs / 1000.0, 1000000 / TARGET_FPS);
+    free(session);
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t frames = 20000;
+    int delayMs = 40;
+    int jitterMs = 30;
+    int lossPercent = 5;
+    uint32_t seed = 1234;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            frames = (uint32_t)atoi(argv[++i]);
+        else if (strcmp(argv[i], "--delay") == 0 && i + 1 < argc)
+            delayMs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--jitter") == 0 && i + 1 < argc)
+            jitterMs = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--loss") == 0 && i + 1 < argc)
+            lossPercent = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = (uint32_t)atoi(argv[++i]);
+        else
+        {
+            printf("Uso: %s [--frames N] [--delay MS] [--jitter MS] [--loss PCT] [--seed S]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    uint8_t *trueInputs[2];
+    for (int p = 0; p < 2; p++)
+        trueInputs[p] = malloc(frames);
+
+    VersusState reference;
+    int garbageInserted = playReference(&reference, trueInputs, frames, seed);
+
+    RollbackSession *sessions = malloc(sizeof(RollbackSession) * 2);
+    NetPeer peers[2];
+    for (int p = 0; p < 2; p++)
+    {
+        initRollback(&sessions[p], seed, p);
+        if (!openNetPeer(&peers[p], BASE_PORT + p, "127.0.0.1", BASE_PORT + 1 - p))
+            return 1;
+        setNetSim(&peers[p], delayMs, jitterMs, lossPercent, seed + (uint32_t)p);
+    }
+
+    printf("Red simulada: demora %d ms, jitter %d ms, pérdida %d%%, %u frames\n",
+           delayMs, jitterMs, lossPercent, frames);
+
+    // Tiempo virtual: un tick de 1/60 s por iteración, sin dormir
+    uint64_t tick = 0;
+    uint64_t maxTicks = (uint64_t)frames * 4 + 1000;
+    for (; tick < maxTicks; tick++)
+    {
+        uint64_t now = tick * 1000 / TARGET_FPS;
+
+        for (int p = 0; p < 2; p++)
+            netPoll(&peers[p], now);
+        for (int p = 0; p < 2; p++)
+            netReceive(&peers[p], &sessions[p]);
+
+        bool done = true;
+        for (int p = 0; p < 2; p++)
+        {
+            RollbackSession *session = &sessions[p];
+            if (session->frame < frames)
+                rollbackAdvance(session, trueInputs[p][session->frame]);
+            else
+                rollbackResolve(session);
+
+            netSendInputs(&peers[p], session, now);
+            if (session->frame < frames || session->confirmedFrame < frames ||
+                session->rollbackFrom != ROLLBACK_NONE)
+                done = false;
+        }
+
+        if (done)
+            break;
+    }
+
+    uint32_t expected = versusChecksum(&reference);
+    bool ok = true;
+    for (int p = 0; p < 2; p++)
+    {
+        RollbackStats *stats = &sessions[p].stats;
+        uint32_t checksum = versusChecksum(&sessions[p].state);
+        ok = ok && checksum == expected;
+
+        printf("Peer %d: %u rollbacks, %u frames re-simulados (máx %u), %u esperas, "
+               "paquetes %llu enviados / %llu perdidos, checksum %08x\n",
+               p, stats->rollbacks, stats->framesResimulated, stats->maxRollbackFrames, stats->stalls,
+               (unsigned long long)peers[p].sim.sent, (unsigned long long)peers[p].sim.dropped, checksum);
+        closeNetPeer(&peers[p]);
+    }
+
+    printf("Referencia: checksum %08x, puntajes %d / %d, líneas %d / %d, basura entró %d veces -> %s\n", expected,
+           reference.players[0].score, reference.players[1].score, reference.players[0].totalLinesCleared,
+           reference.players[1].totalLinesCleared, garbageInserted, ok ? "OK" : "DESYNC");
+    if (garbageInserted == 0)
+    {
+        printf("Error: no entró basura en ningún tablero, no se probó el rollback sobre basura (más --frames)\n");
+        ok = false;
+    }
+    printf("Ticks de reloj usados: %llu para %u frames\n", (unsigned long long)tick, frames);
+
+    benchmarkResimulation(seed);
+
+    free(sessions);
+    free(trueInputs[0]);
+    free(trueInputs[1]);
+    return ok ? 0 : 1;
+}
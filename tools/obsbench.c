@@ -0,0 +1,213 @@
+// Benchmark y consumidor de prueba del ring de observaciones
+//
+// Uso:
+//   ./obsbench                       Productor + consumidor (fork) y reporte
+//   ./obsbench --produce [N]         Solo publicar N observaciones en /tetris_obs
+//   ./obsbench --consume [N]         Solo leer N observaciones de /tetris_obs
+//
+// Opciones: --games G (partidas simultáneas), --capacity C (potencia de 2)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "game.h"
+#include "obsring.h"
+
+#define RING_NAME "/tetris_obs"
+#define DEFAULT_RECORDS 5000000ULL
+#define DEFAULT_GAMES 64
+#define DEFAULT_CAPACITY 65536
+#define IDLE_TIMEOUT_NS 2000000000ULL
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Teclas aleatorias: mayormente caer, a veces mover o rotar
+static unsigned randomInputs(uint32_t *rng)
+{
+    uint32_t r = nextRandom(rng);
+    unsigned inputs = INPUT_DOWN;
+    if ((r & 7) == 0)
+        inputs |= INPUT_LEFT;
+    else if ((r & 7) == 1)
+        inputs |= INPUT_RIGHT;
+    if (((r >> 3) & 7) == 0)
+        inputs |= INPUT_ROTATE;
+    return inputs;
+}
+
+// Simula `numGames` partidas en round-robin y publica cada tick
+static int runProducer(ObsRing *ring, uint64_t records, int numGames)
+{
+    GameState *games = malloc(sizeof(GameState) * (size_t)numGames);
+    uint32_t rng = 12345;
+    for (int i = 0; i < numGames; i++)
+    {
+        initGame(&games[i], (uint32_t)i + 1);
+    }
+
+    uint64_t published = 0;
+    uint64_t attempts = 0;
+    uint32_t nextSeed = (uint32_t)numGames + 1;
+    uint64_t start = nowNs();
+
+    while (published < records)
+    {
+        for (int i = 0; i < numGames && published < records; i++)
+        {
+            stepGame(&games[i], randomInputs(&rng));
+            attempts++;
+            if (obsRingPublish(ring, &games[i], (uint32_t)i))
+                published++;
+
+            if (games[i].gameOver)
+                initGame(&games[i], nextSeed++);
+        }
+    }
+
+    double seconds = (double)(nowNs() - start) / 1e9;
+    printf("[productor] %llu publicadas, %llu descartadas en %.3f s (%.2f M obs/s, %.1f MB/s)\n",
+           (unsigned long long)published, (unsigned long long)(attempts - published), seconds,
+           (double)published / seconds / 1e6,
+           (double)published * sizeof(ObsRecord) / seconds / (1024.0 * 1024.0));
+
+    free(games);
+    return 0;
+}
+
+// Lee observaciones sin copiarlas y verifica que la secuencia sea continua
+static int runConsumer(uint64_t records)
+{
+    ObsRing ring;
+    if (!obsRingOpen(&ring, RING_NAME))
+        return 1;
+
+    uint64_t received = 0;
+    uint64_t expected = ring.cachedTail;
+    uint64_t errors = 0;
+    int64_t checksum = 0;
+    uint64_t start = 0;
+    uint64_t lastData = nowNs();
+
+    while (received < records)
+    {
+        uint32_t count;
+        const ObsRecord *batch = obsRingPeek(&ring, &count);
+
+        if (count == 0)
+        {
+            if (nowNs() - lastData > IDLE_TIMEOUT_NS)
+                break; // El productor terminó o murió
+            continue;
+        }
+
+        if (start == 0)
+            start = nowNs();
+        lastData = nowNs();
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (batch[i].sequence != expected)
+                errors++;
+            expected = batch[i].sequence + 1;
+            checksum += batch[i].score + batch[i].rows[GRID_HEIGHT - 1];
+        }
+
+        obsRingRelease(&ring, count);
+        received += count;
+    }
+
+    double seconds = start != 0 ? (double)(lastData - start) / 1e9 : 0.0;
+    if (seconds <= 0.0)
+        seconds = 1e-9;
+
+    printf("[consumidor] %llu leídas en %.3f s (%.2f M obs/s), errores de secuencia: %llu, "
+           "descartadas por el productor: %llu, checksum %lld\n",
+           (unsigned long long)received, seconds, (double)received / seconds / 1e6,
+           (unsigned long long)errors,
+           (unsigned long long)atomic_load(&ring.header->dropped), (long long)checksum);
+
+    obsRingClose(&ring);
+    return errors == 0 ? 0 : 1;
+}
+
+int main(int argc, char *argv[])
+{
+    enum { MODE_BENCH, MODE_PRODUCE, MODE_CONSUME } mode = MODE_BENCH;
+    uint64_t records = DEFAULT_RECORDS;
+    int numGames = DEFAULT_GAMES;
+    uint32_t capacity = DEFAULT_CAPACITY;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--produce") == 0 || strcmp(argv[i], "--consume") == 0)
+        {
+            mode = argv[i][2] == 'p' ? MODE_PRODUCE : MODE_CONSUME;
+            if (i + 1 < argc && argv[i + 1][0] != '-')
+                records = strtoull(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+        {
+            numGames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--capacity") == 0 && i + 1 < argc)
+        {
+            capacity = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else
+        {
+            printf("Uso: %s [--produce N | --consume N] [--games G] [--capacity C]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (numGames < 1)
+        numGames = 1;
+
+    if (mode == MODE_CONSUME)
+        return runConsumer(records);
+
+    ObsRing ring;
+    if (!obsRingCreate(&ring, RING_NAME, capacity))
+        return 1;
+
+    if (mode == MODE_PRODUCE)
+    {
+        int result = runProducer(&ring, records, numGames);
+        obsRingClose(&ring);
+        return result;
+    }
+
+    // Benchmark: consumidor en un proceso hijo, productor en el padre.
+    // El segmento ya existe antes del fork, así el hijo lo encuentra listo.
+    printf("Ring: %u registros de %zu bytes, %d partidas, %llu observaciones\n",
+           capacity, sizeof(ObsRecord), numGames, (unsigned long long)records);
+
+    fflush(stdout);
+
+    pid_t child = fork();
+    if (child == 0)
+    {
+        int result = runConsumer(records);
+        fflush(stdout);
+        _exit(result);
+    }
+
+    int result = runProducer(&ring, records, numGames);
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    obsRingClose(&ring);
+    obsRingUnlink(RING_NAME);
+
+    if (result != 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        return 1;
+    return 0;
+}
@@ -0,0 +1,92 @@
+#!/bin/sh
+# Release guiado por perfil (make pgo)
+#
+# 1. Compila los benchmarks del motor en release (-O2 + LTO) y los mide.
+# 2. Los compila instrumentados (PGO=generate) y corre la misma carga: la
+#    batalla de 99 bots, el afinador genético, los kernels de bitboards y
+#    colocaciones, el stream de espectador y la comparación contra el motor
+#    de referencia. Los perfiles quedan en PGO_DIR, uno por archivo fuente.
+# 3. Recompila con los perfiles (PGO=use), vuelve a medir y compara.
+# 4. Deja compilado todo (PGO_TARGETS, por defecto "all") con los perfiles.
+#
+# Como los perfiles son por archivo fuente, el juego también usa los de
+# game.c, bot.c, battle.c, etc. aunque no se haya corrido.
+
+set -e
+
+MAKE=${MAKE:-make}
+PGO_DIR=${PGO_DIR:-$(pwd)/pgo-data}
+PGO_TARGETS=${PGO_TARGETS:-all}
+BENCHES="battlebench tuner streambench boardbench placebench difftest"
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+# Segundos con milésimas. El date de BSD/macOS no conoce %N (lo deja como
+# una N literal): ahí la resolución queda en un segundo
+now() {
+    ns=$(date +%s%N)
+    case $ns in
+    *N) ns="${ns%N}000000000" ;;
+    esac
+    echo "$ns" | awk '{ printf "%.3f\n", $1 / 1e9 }'
+}
+
+run_bench() {
+    case $1 in
+    battlebench)
+        # Con los bots la batalla se define antes de los 10 minutos: varias
+        # semillas para que dure lo suficiente como para medir
+        for seed in 1 2 3 4 5 6 7 8; do
+            ./battlebench --ticks 36000 --seed $seed
+        done
+        ;;
+    tuner) ./tuner --population 24 --games 8 --pieces 500 --generations 3 --checkpoint "$WORK/tuner.ckpt" ;;
+    streambench) ./streambench --games 3000 ;;
+    boardbench) ./boardbench --placements 600000 ;;
+    placebench) ./placebench --boards 5000 ;;
+    difftest) ./difftest --games 1000 ;;
+    esac
+}
+
+# Corre la carga y anota los segundos de cada benchmark en $1
+measure() {
+    : > "$1"
+    for bench in $BENCHES; do
+        rm -f "$WORK/tuner.ckpt"
+        start=$(now)
+        if ! run_bench "$bench" > "$WORK/$bench.log" 2>&1; then
+            echo "Error: $bench falló (ver la salida abajo)"
+            cat "$WORK/$bench.log"
+            exit 1
+        fi
+        end=$(now)
+        echo "$bench $start $end" | awk '{ printf "%s %.3f\n", $1, $3 - $2 }' >> "$1"
+    done
+}
+
+echo "== 1/4 release"
+$MAKE clean > /dev/null
+$MAKE $BENCHES
+measure "$WORK/release.txt"
+
+echo "== 2/4 instrumentado, corriendo la carga"
+rm -rf "$PGO_DIR"
+$MAKE clean > /dev/null
+$MAKE PGO=generate $BENCHES
+measure "$WORK/training.txt"
+
+echo "== 3/4 con perfiles"
+$MAKE clean > /dev/null
+$MAKE PGO=use $BENCHES
+measure "$WORK/pgo.txt"
+
+echo
+echo "Benchmark      release    PGO      mejora"
+paste "$WORK/release.txt" "$WORK/pgo.txt" | awk '
+    { printf "%-13s %7.2f s %7.2f s %+7.1f%%\n", $1, $2, $4, ($2 / $4 - 1) * 100; before += $2; after += $4 }
+    END { printf "%-13s %7.2f s %7.2f s %+7.1f%%\n", "total", before, after, (before / after - 1) * 100 }'
+
+echo
+echo "== 4/4 $PGO_TARGETS con perfiles"
+$MAKE clean > /dev/null
+$MAKE PGO=use $PGO_TARGETS
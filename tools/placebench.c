@@ -0,0 +1,256 @@
+// Benchmark de la evaluación de colocaciones (placement.h)
+//
+// Arma tableros al azar y, para cada pieza, calcula caída, altura y huecos
+// de todas las rotaciones y columnas con cada kernel (escalar, SSE2, AVX2).
+// Verifica que todos den exactamente lo mismo que el escalar y que la
+// pieza fijada a mano en el bitboard, y compara la velocidad contra bajar
+// la pieza con checkCollision y calcular los features sobre la grilla.
+//
+// Uso: ./placebench [--boards N] [--seed S]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bot.h"
+#include "placement.h"
+
+#define ROUNDS_PER_BOARD 20
+
+// Acumula resultados para que el compilador no descarte el trabajo medido
+static volatile float benchSink;
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Tablero de una partida al azar cortada en un momento al azar
+static void randomBoard(uint32_t *rng, StandardBoard *board)
+{
+    memset(board, 0, sizeof(*board));
+    int pieces = (int)(nextRandom(rng) % 60);
+    for (int i = 0; i < pieces; i++)
+    {
+        const PieceMask *piece = getPieceMask((PieceType)(nextRandom(rng) % NUM_PIECES), (int)(nextRandom(rng) % 4));
+        int x = (int)(nextRandom(rng) % (GRID_WIDTH + 3)) - 3;
+        if (standardCollides(board, piece, x, -4))
+            continue;
+        int y = standardDropY(board, piece, x, -4);
+        if (pieceMaskAboveTop(piece, y))
+            break;
+        standardLock(board, piece, x, y);
+        standardClearLines(board);
+    }
+}
+
+// Referencia: fijar la pieza en una copia y medir el tablero resultante
+static bool verifyAgainstBoard(const StandardBoard *board, const PlacementSet *set)
+{
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        const PieceMask *piece = getPieceMask(set->type, rotation);
+        const RotationPlacements *placements = &set->rotations[rotation];
+        int valid = 0;
+
+        for (int x = -3; x < GRID_WIDTH; x++)
+        {
+            if (standardCollides(board, piece, x, -4))
+                continue;
+            int lane = x - placements->firstX;
+            if (lane < 0 || lane >= placements->count)
+            {
+                printf("ERROR: columna %d fuera de los carriles (rotación %d)\n", x, rotation);
+                return false;
+            }
+            valid++;
+
+            int y = standardDropY(board, piece, x, -4);
+            StandardBoard locked = *board;
+            int heights[GRID_WIDTH];
+            standardLock(&locked, piece, x, y);
+            int holes = standardColumnHeights(&locked, heights);
+            int heightSum = 0;
+            for (int col = 0; col < GRID_WIDTH; col++)
+            {
+                heightSum += heights[col];
+            }
+
+            // Las piezas que asoman por arriba pierden bloques al fijarse
+            if (pieceMaskAboveTop(piece, y))
+                continue;
+            if (placements->landingY[lane] != y || placements->holes[lane] != holes ||
+                placements->heightSum[lane] != heightSum)
+            {
+                printf("ERROR: rotación %d, x %d: y %d/%d, huecos %d/%d, altura %d/%d\n", rotation, x,
+                       placements->landingY[lane], y, placements->holes[lane], holes, placements->heightSum[lane],
+                       heightSum);
+                return false;
+            }
+        }
+        if (valid != placements->count)
+        {
+            printf("ERROR: rotación %d tiene %d columnas válidas y %d carriles\n", rotation, valid,
+                   placements->count);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Lo que hacía el bot antes: bajar la pieza celda por celda y recorrer la grilla
+static int evaluateWithGrid(int grid[GRID_HEIGHT][GRID_WIDTH], PieceType type, float *checksum)
+{
+    int shape[4][4];
+    int scratch[GRID_HEIGHT][GRID_WIDTH];
+    float features[NUM_BOT_FEATURES];
+    int evaluated = 0;
+    copyPiece(shape, PIECES[type]);
+
+    for (int rotation = 0; rotation < 4; rotation++)
+    {
+        if (rotation > 0)
+            rotatePiece(shape);
+        for (int x = -3; x < GRID_WIDTH; x++)
+        {
+            if (checkCollision(grid, shape, x, SPAWN_Y))
+                continue;
+            int y = SPAWN_Y;
+            while (!checkCollision(grid, shape, x, y + 1))
+            {
+                y++;
+            }
+            memcpy(scratch, grid, sizeof(scratch));
+            lockPiece(scratch, shape, x, y);
+            computeBoardFeatures(scratch, 0, features);
+            *checksum += features[FEATURE_HEIGHT] + features[FEATURE_HOLES];
+            evaluated++;
+        }
+    }
+    return evaluated;
+}
+
+int main(int argc, char *argv[])
+{
+    int numBoards = 20000;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--boards") == 0 && i + 1 < argc)
+            numBoards = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else
+        {
+            printf("Uso: %s [--boards N] [--seed S]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (numBoards < 1)
+        numBoards = 1;
+    if (seed == 0)
+        seed = 1;
+
+    StandardBoard *boards = malloc(sizeof(StandardBoard) * (size_t)numBoards);
+    if (boards == NULL)
+    {
+        printf("Error al reservar %d tableros\n", numBoards);
+        return 1;
+    }
+    uint32_t rng = seed;
+    for (int i = 0; i < numBoards; i++)
+    {
+        randomBoard(&rng, &boards[i]);
+    }
+
+    printf("%d tableros al azar, semilla %u, kernel por defecto: %s\n", numBoards, seed,
+           getPlacementKernelName(getPlacementKernel()));
+
+    // Correctitud: todos los kernels contra el escalar y contra el bitboard
+    for (int i = 0; i < numBoards; i++)
+    {
+        for (int type = 0; type < NUM_PIECES; type++)
+        {
+            PlacementSet reference;
+            evaluatePlacementsWith(PLACEMENT_SCALAR, &boards[i], (PieceType)type, &reference);
+            if (!verifyAgainstBoard(&boards[i], &reference))
+                return 1;
+
+            for (int k = PLACEMENT_SSE2; k < NUM_PLACEMENT_KERNELS; k++)
+            {
+                PlacementSet set;
+                if (!placementKernelSupported((PlacementKernel)k))
+                    continue;
+                evaluatePlacementsWith((PlacementKernel)k, &boards[i], (PieceType)type, &set);
+                if (memcmp(set.rotations, reference.rotations, sizeof(set.rotations)) != 0)
+                {
+                    printf("ERROR: %s distinto del escalar (tablero %d, pieza %d)\n",
+                           getPlacementKernelName((PlacementKernel)k), i, type);
+                    return 1;
+                }
+            }
+        }
+    }
+    printf("Todos los kernels coinciden con el escalar y con el bitboard\n");
+
+    // Velocidad: colocaciones evaluadas por segundo
+    double scalarRate = 0.0;
+    for (int k = PLACEMENT_SCALAR; k < NUM_PLACEMENT_KERNELS; k++)
+    {
+        if (!placementKernelSupported((PlacementKernel)k))
+        {
+            printf("%-8s: no soportado por esta CPU\n", getPlacementKernelName((PlacementKernel)k));
+            continue;
+        }
+        long evaluated = 0;
+        int checksum = 0;
+        uint64_t start = nowNs();
+        for (int round = 0; round < ROUNDS_PER_BOARD; round++)
+        {
+            for (int i = 0; i < numBoards; i++)
+            {
+                PlacementSet set;
+                evaluatePlacementsWith((PlacementKernel)k, &boards[i], (PieceType)((i + round) % NUM_PIECES), &set);
+                for (int rotation = 0; rotation < 4; rotation++)
+                {
+                    evaluated += set.rotations[rotation].count;
+                    checksum += set.rotations[rotation].holes[0];
+                }
+            }
+        }
+        double rate = (double)evaluated / ((double)(nowNs() - start) / 1e9);
+        if (k == PLACEMENT_SCALAR)
+            scalarRate = rate;
+        benchSink += (float)checksum;
+        printf("%-8s: %11.0f colocaciones/s (%.2fx el escalar)\n", getPlacementKernelName((PlacementKernel)k), rate,
+               rate / scalarRate);
+    }
+
+    long evaluated = 0;
+    float checksum = 0.0f;
+    int grid[GRID_HEIGHT][GRID_WIDTH];
+    uint64_t start = nowNs();
+    for (int round = 0; round < ROUNDS_PER_BOARD; round++)
+    {
+        for (int i = 0; i < numBoards; i++)
+        {
+            for (int row = 0; row < GRID_HEIGHT; row++)
+            {
+                for (int col = 0; col < GRID_WIDTH; col++)
+                {
+                    grid[row][col] = (boards[i].rows[row] >> col) & 1;
+                }
+            }
+            evaluated += evaluateWithGrid(grid, (PieceType)((i + round) % NUM_PIECES), &checksum);
+        }
+    }
+    double gridRate = (double)evaluated / ((double)(nowNs() - start) / 1e9);
+    benchSink += checksum;
+    printf("%-8s: %11.0f colocaciones/s (%.2fx el escalar)\n", "grilla", gridRate, gridRate / scalarRate);
+
+    free(boards);
+    return 0;
+}
@@ -0,0 +1,496 @@
+// Archivo de replays (replayarchive.h): crear, consultar, compactar y medir
+//
+//   generate ARCHIVO N [--seed S]   agrega N partidas simuladas (inputs al azar)
+//   add ARCHIVO PARTIDA.tstr...     agrega streams grabados
+//   list ARCHIVO [--top N]          resumen y mejores puntajes
+//   get ARCHIVO ID SALIDA.tstr      extrae una partida (para --watch o replayvideo)
+//   merge SALIDA ENTRADA...         une y compacta: una copia por id (gana la de
+//                                   la última entrada), sin registros rotos,
+//                                   ordenado por id y con índice nuevo
+//   bench ARCHIVO [--lookups N] [--cold]
+//                                   lectura secuencial con MADV_SEQUENTIAL
+//                                   (checksum y decodificación de cada partida) y
+//                                   acceso aleatorio por id con MADV_RANDOM
+//
+// Uso: ./replaypack generate partidas.trpa 10000 && ./replaypack bench partidas.trpa --cold
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "replayarchive.h"
+#include "stream.h"
+
+#define MAX_TICKS_PER_GAME (TARGET_FPS * 60 * 10) // Cortar partidas a los 10 minutos
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} Buffer;
+
+static void appendBytes(Buffer *buffer, const void *bytes, size_t count)
+{
+    if (buffer->size + count > buffer->capacity)
+    {
+        buffer->capacity = (buffer->capacity + count) * 2;
+        buffer->data = realloc(buffer->data, buffer->capacity);
+    }
+    memcpy(buffer->data + buffer->size, bytes, count);
+    buffer->size += count;
+}
+
+// Las mismas teclas al azar que streambench: mayormente caer
+static unsigned randomInputs(uint32_t *rng)
+{
+    uint32_t r = nextRandom(rng);
+    unsigned inputs = 0;
+    if ((r & 3) != 0)
+        inputs |= INPUT_DOWN;
+    if (((r >> 2) & 7) == 0)
+        inputs |= INPUT_LEFT;
+    else if (((r >> 2) & 7) == 1)
+        inputs |= INPUT_RIGHT;
+    if (((r >> 5) & 7) == 0)
+        inputs |= INPUT_ROTATE;
+    return inputs;
+}
+
+static void playGame(uint32_t seed, Buffer *stream, ReplayInfo *info)
+{
+    GameState state;
+    StreamEncoder encoder;
+    uint8_t frame[STREAM_MAX_FRAME_SIZE];
+    uint32_t rng = seed * 2654435761u + 7;
+    initGame(&state, seed);
+    initStreamEncoder(&encoder);
+
+    stream->size = 0;
+    appendBytes(stream, STREAM_MAGIC, 4);
+    uint32_t ticks = 0;
+    while (!state.gameOver && ticks < MAX_TICKS_PER_GAME)
+    {
+        stepGame(&state, randomInputs(&rng));
+        ticks++;
+        int len = encodeStreamFrame(&encoder, &state, frame);
+        if (len > 0)
+            appendBytes(stream, frame, (size_t)len);
+    }
+
+    memset(info, 0, sizeof(*info));
+    info->seed = seed;
+    info->score = state.score;
+    info->lines = state.totalLinesCleared;
+    info->ticks = ticks;
+}
+
+static int commandGenerate(const char *path, int count, uint32_t seed)
+{
+    ReplayArchiveWriter writer;
+    if (!openReplayArchiveWriter(&writer, path))
+        return 1;
+
+    Buffer stream = {0};
+    uint64_t bytes = 0;
+    uint64_t start = nowNs();
+    bool ok = true;
+    for (int i = 0; i < count && ok; i++)
+    {
+        ReplayInfo info;
+        playGame(seed + (uint32_t)i, &stream, &info);
+        ok = appendReplay(&writer, &info, stream.data, (uint32_t)stream.size);
+        bytes += stream.size;
+    }
+    size_t total = writer.count;
+    ok = closeReplayArchiveWriter(&writer) && ok;
+    free(stream.data);
+
+    double seconds = (double)(nowNs() - start) / 1e9;
+    printf("%d partidas agregadas (%.1f KB de stream por partida) en %.2f s; el archivo tiene %zu\n", count,
+           count > 0 ? (double)bytes / count / 1024.0 : 0.0, seconds, total);
+    return ok ? 0 : 1;
+}
+
+// Recorre el stream para sacar puntaje, líneas y ticks
+static bool describeStream(const uint8_t *data, size_t size, ReplayInfo *info)
+{
+    if (size < 4 || memcmp(data, STREAM_MAGIC, 4) != 0)
+        return false;
+    StreamDecoder decoder;
+    initStreamDecoder(&decoder);
+    size_t offset = 4;
+    while (offset < size)
+    {
+        int used = decodeStreamFrame(&decoder, data + offset, (int)(size - offset));
+        if (used <= 0)
+            return false;
+        offset += (size_t)used;
+    }
+    memset(info, 0, sizeof(*info));
+    info->score = decoder.view.score;
+    info->lines = decoder.view.totalLinesCleared;
+    info->ticks = decoder.view.tick;
+    return decoder.hasKeyframe;
+}
+
+static int commandAdd(const char *path, int count, char *files[])
+{
+    ReplayArchiveWriter writer;
+    if (!openReplayArchiveWriter(&writer, path))
+        return 1;
+
+    Buffer stream = {0};
+    int added = 0;
+    for (int i = 0; i < count; i++)
+    {
+        FILE *file = fopen(files[i], "rb");
+        if (file == NULL)
+        {
+            printf("Error al abrir %s\n", files[i]);
+            continue;
+        }
+        stream.size = 0;
+        uint8_t chunk[65536];
+        size_t n;
+        while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+            appendBytes(&stream, chunk, n);
+        fclose(file);
+
+        ReplayInfo info;
+        if (!describeStream(stream.data, stream.size, &info))
+        {
+            printf("Error: %s no es un stream de Tetris válido\n", files[i]);
+            continue;
+        }
+        if (appendReplay(&writer, &info, stream.data, (uint32_t)stream.size))
+        {
+            printf("%s -> id %llu\n", files[i], (unsigned long long)writer.entries[writer.count - 1].gameId);
+            added++;
+        }
+    }
+    free(stream.data);
+    bool ok = closeReplayArchiveWriter(&writer);
+    return ok && added == count ? 0 : 1;
+}
+
+static int commandList(const char *path, int top)
+{
+    ReplayArchive archive;
+    if (!openReplayArchive(&archive, path))
+        return 1;
+
+    uint64_t payload = 0;
+    for (size_t i = 0; i < archive.count; i++)
+        payload += archive.entries[i].length;
+    printf("%s: %zu partidas, %.1f MB (%.1f MB de streams), índice %s\n", path, archive.count,
+           (double)archive.size / (1024.0 * 1024.0), (double)payload / (1024.0 * 1024.0),
+           archive.rebuilt ? "reconstruido (el escritor no cerró)" : "al final del archivo");
+    if (archive.count > 0)
+        printf("ids %llu a %llu\n", (unsigned long long)archive.entries[0].gameId,
+               (unsigned long long)archive.entries[archive.count - 1].gameId);
+
+    printf("\nPos  Id          Semilla     Puntos   Líneas  Duración\n");
+    for (int rank = 0; rank < top; rank++)
+    {
+        const ReplayIndexEntry *entry = getReplayByScoreRank(&archive, (size_t)rank);
+        if (entry == NULL)
+            break;
+        printf("%-4d %-11llu %-11u %-8d %-7d %.1f s\n", rank + 1, (unsigned long long)entry->gameId, entry->seed,
+               entry->score, entry->lines, (double)entry->ticks / TARGET_FPS);
+    }
+    closeReplayArchive(&archive);
+    return 0;
+}
+
+static int commandGet(const char *path, uint64_t gameId, const char *outPath)
+{
+    ReplayArchive archive;
+    if (!openReplayArchive(&archive, path))
+        return 1;
+
+    const ReplayIndexEntry *entry = findReplayById(&archive, gameId);
+    int result = 1;
+    if (entry == NULL)
+        printf("No hay una partida con id %llu\n", (unsigned long long)gameId);
+    else if (!verifyReplay(&archive, entry))
+        printf("Error: la partida %llu está dañada\n", (unsigned long long)gameId);
+    else
+    {
+        FILE *file = fopen(outPath, "wb");
+        if (file != NULL && fwrite(getReplayData(&archive, entry), 1, entry->length, file) == entry->length)
+        {
+            printf("Partida %llu (%d puntos) guardada en %s\n", (unsigned long long)gameId, entry->score, outPath);
+            result = 0;
+        }
+        else
+            printf("Error al escribir %s\n", outPath);
+        if (file != NULL)
+            fclose(file);
+    }
+    closeReplayArchive(&archive);
+    return result;
+}
+
+// ============ MERGE / COMPACTACIÓN ============
+
+typedef struct
+{
+    int input;
+    const ReplayIndexEntry *entry;
+} MergeItem;
+
+static int compareMergeItems(const void *a, const void *b)
+{
+    const MergeItem *x = a;
+    const MergeItem *y = b;
+    if (x->entry->gameId != y->entry->gameId)
+        return x->entry->gameId < y->entry->gameId ? -1 : 1;
+    if (x->input != y->input)
+        return x->input < y->input ? -1 : 1;
+    return x->entry->offset < y->entry->offset ? -1 : x->entry->offset > y->entry->offset;
+}
+
+static int commandMerge(const char *outPath, int count, char *inputs[])
+{
+    ReplayArchive *archives = calloc((size_t)count, sizeof(ReplayArchive));
+    size_t total = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (!openReplayArchive(&archives[i], inputs[i]))
+        {
+            for (int j = 0; j < i; j++)
+                closeReplayArchive(&archives[j]);
+            free(archives);
+            return 1;
+        }
+        adviseReplayArchive(&archives[i], false);
+        total += archives[i].count;
+    }
+
+    MergeItem *items = malloc(sizeof(MergeItem) * total + 1);
+    size_t itemCount = 0;
+    for (int i = 0; i < count; i++)
+    {
+        for (size_t e = 0; e < archives[i].count; e++)
+            items[itemCount++] = (MergeItem){i, &archives[i].entries[e]};
+    }
+    qsort(items, itemCount, sizeof(MergeItem), compareMergeItems);
+
+    // Se escribe a un temporal y se renombra al final: la salida puede ser
+    // una de las entradas (compactar en el lugar)
+    char tmpPath[1024];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", outPath);
+    remove(tmpPath);
+    ReplayArchiveWriter writer;
+    bool ok = openReplayArchiveWriter(&writer, tmpPath);
+
+    size_t duplicates = 0;
+    size_t damaged = 0;
+    uint64_t start = nowNs();
+    size_t groupEnd;
+    for (size_t i = 0; i < itemCount && ok; i = groupEnd)
+    {
+        groupEnd = i + 1;
+        while (groupEnd < itemCount && items[groupEnd].entry->gameId == items[i].entry->gameId)
+            groupEnd++;
+
+        // De cada id queda la última copia sana (la de la entrada más a la
+        // derecha); las dañadas ceden el lugar a la copia anterior
+        size_t chosen = groupEnd;
+        for (size_t k = groupEnd; k > i; k--)
+        {
+            if (verifyReplay(&archives[items[k - 1].input], items[k - 1].entry))
+            {
+                chosen = k - 1;
+                break;
+            }
+            damaged++;
+        }
+        duplicates += chosen == groupEnd ? 0 : chosen - i;
+        if (chosen == groupEnd)
+            continue;
+
+        const ReplayArchive *archive = &archives[items[chosen].input];
+        const ReplayIndexEntry *entry = items[chosen].entry;
+        ReplayInfo info = {entry->gameId, entry->seed, entry->score, entry->lines, entry->ticks};
+        ok = appendReplay(&writer, &info, getReplayData(archive, entry), entry->length);
+    }
+    size_t written = writer.count;
+    if (writer.file != NULL)
+        ok = closeReplayArchiveWriter(&writer) && ok;
+
+    for (int i = 0; i < count; i++)
+        closeReplayArchive(&archives[i]);
+    free(archives);
+    free(items);
+
+    if (!ok || rename(tmpPath, outPath) != 0)
+    {
+        printf("Error al escribir %s\n", outPath);
+        remove(tmpPath);
+        return 1;
+    }
+    printf("%zu partidas en %s (%zu duplicadas y %zu dañadas descartadas) en %.2f s\n", written, outPath, duplicates,
+           damaged, (double)(nowNs() - start) / 1e9);
+    return 0;
+}
+
+// ============ BENCHMARK ============
+
+// Saca el archivo del page cache (si lo permite el sistema) para medir disco
+static void dropCache(const char *path)
+{
+#ifdef POSIX_FADV_DONTNEED
+    int fd = open(path, O_RDONLY);
+    if (fd >= 0)
+    {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+static int commandBench(const char *path, int lookups, bool cold)
+{
+    ReplayArchive archive;
+    if (!openReplayArchive(&archive, path))
+        return 1;
+    if (archive.count == 0)
+    {
+        printf("El archivo está vacío\n");
+        closeReplayArchive(&archive);
+        return 1;
+    }
+    double megabytes = (double)archive.recordsEnd / (1024.0 * 1024.0);
+
+    // 1. Secuencial: checksum de cada payload directo desde el mapeo
+    if (cold)
+        dropCache(path);
+    adviseReplayArchive(&archive, true);
+    uint64_t start = nowNs();
+    uint64_t cursor = 0;
+    size_t records = 0;
+    size_t damaged = 0;
+    const ReplayRecordHeader *record;
+    while ((record = nextReplayRecord(&archive, &cursor)) != NULL)
+    {
+        if (replayChecksum((const uint8_t *)(record + 1), record->length) != record->checksum)
+            damaged++;
+        records++;
+    }
+    double seconds = (double)(nowNs() - start) / 1e9;
+    printf("Secuencial (checksum): %zu partidas, %.1f MB en %.3f s -> %.0f MB/s, %.0f partidas/s%s\n", records,
+           megabytes, seconds, megabytes / seconds, records / seconds, damaged > 0 ? " (con dañadas)" : "");
+
+    // 2. Secuencial decodificando cada partida hasta el estado final
+    start = nowNs();
+    cursor = 0;
+    uint64_t frames = 0;
+    long long scoreCheck = 0;
+    while ((record = nextReplayRecord(&archive, &cursor)) != NULL)
+    {
+        const uint8_t *data = (const uint8_t *)(record + 1);
+        StreamDecoder decoder;
+        initStreamDecoder(&decoder);
+        uint32_t offset = 4;
+        while (offset < record->length)
+        {
+            int used = decodeStreamFrame(&decoder, data + offset, (int)(record->length - offset));
+            if (used <= 0)
+                break;
+            offset += (uint32_t)used;
+            frames++;
+        }
+        scoreCheck += decoder.view.score - record->score;
+    }
+    seconds = (double)(nowNs() - start) / 1e9;
+    printf("Secuencial (decodificando): %.0f partidas/s, %.1f M frames/s%s\n", records / seconds,
+           (double)frames / seconds / 1e6, scoreCheck != 0 ? " (puntajes distintos al índice!)" : "");
+
+    // 3. Aleatorio: ids al azar por el índice, leyendo todo el payload
+    if (cold)
+        dropCache(path);
+    adviseReplayArchive(&archive, false);
+    uint64_t firstId = archive.entries[0].gameId;
+    uint64_t span = archive.entries[archive.count - 1].gameId - firstId + 1;
+    uint32_t rng = 12345;
+    int found = 0;
+    uint32_t sink = 0;
+    start = nowNs();
+    for (int i = 0; i < lookups; i++)
+    {
+        uint64_t gameId = firstId + ((uint64_t)nextRandom(&rng) << 16 ^ nextRandom(&rng)) % span;
+        const ReplayIndexEntry *entry = findReplayById(&archive, gameId);
+        if (entry == NULL)
+            continue;
+        sink ^= replayChecksum(getReplayData(&archive, entry), entry->length);
+        found++;
+    }
+    seconds = (double)(nowNs() - start) / 1e9;
+    printf("Aleatorio por id: %d lecturas (%d encontradas) -> %.0f partidas/s, %.1f us por partida [%08x]\n",
+           lookups, found, lookups / seconds, seconds * 1e6 / lookups, sink);
+
+    // 4. Consultas del índice: mejor puntaje y partidas de una semilla
+    const ReplayIndexEntry *best = getReplayByScoreRank(&archive, 0);
+    size_t first;
+    size_t sameSeed = findReplaysBySeed(&archive, best->seed, &first);
+    printf("Mejor partida: id %llu, %d puntos, semilla %u (%zu partidas con esa semilla)\n",
+           (unsigned long long)best->gameId, best->score, best->seed, sameSeed);
+
+    closeReplayArchive(&archive);
+    return damaged > 0 ? 1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *command = argc >= 3 ? argv[1] : "";
+
+    if (strcmp(command, "generate") == 0 && argc >= 4)
+    {
+        uint32_t seed = 1;
+        if (argc >= 6 && strcmp(argv[4], "--seed") == 0)
+            seed = (uint32_t)strtoul(argv[5], NULL, 10);
+        return commandGenerate(argv[2], atoi(argv[3]), seed);
+    }
+    if (strcmp(command, "add") == 0 && argc >= 4)
+        return commandAdd(argv[2], argc - 3, argv + 3);
+    if (strcmp(command, "list") == 0)
+        return commandList(argv[2], argc >= 5 && strcmp(argv[3], "--top") == 0 ? atoi(argv[4]) : 10);
+    if (strcmp(command, "get") == 0 && argc >= 5)
+        return commandGet(argv[2], strtoull(argv[3], NULL, 10), argv[4]);
+    if (strcmp(command, "merge") == 0 && argc >= 4)
+        return commandMerge(argv[2], argc - 3, argv + 3);
+    if (strcmp(command, "bench") == 0)
+    {
+        int lookups = 100000;
+        bool cold = false;
+        for (int i = 3; i < argc; i++)
+        {
+            if (strcmp(argv[i], "--lookups") == 0 && i + 1 < argc)
+                lookups = atoi(argv[++i]);
+            else if (strcmp(argv[i], "--cold") == 0)
+                cold = true;
+        }
+        return commandBench(argv[2], lookups > 0 ? lookups : 1, cold);
+    }
+
+    printf("Uso: %s generate ARCHIVO N [--seed S]\n", argv[0]);
+    printf("     %s add ARCHIVO PARTIDA.tstr...\n", argv[0]);
+    printf("     %s list ARCHIVO [--top N]\n", argv[0]);
+    printf("     %s get ARCHIVO ID SALIDA.tstr\n", argv[0]);
+    printf("     %s merge SALIDA ENTRADA...\n", argv[0]);
+    printf("     %s bench ARCHIVO [--lookups N] [--cold]\n", argv[0]);
+    return 1;
+}
@@ -0,0 +1,408 @@
+// Exporta una partida grabada (.tstr, ver stream.h) a video sin ventana
+//
+// Primero indexa los keyframes del stream. Después divide los ticks en
+// tramos de --chunk frames que los hilos toman de a uno: cada hilo decodifica
+// desde el keyframe anterior a su tramo, dibuja cada tick que cambió con
+// softrender.h en su propio framebuffer y lo convierte a Y4M (YUV 4:2:0) o
+// PPM; los ticks sin cambios copian el frame anterior. El hilo
+// principal escribe los tramos en orden a medida que se completan; como
+// mucho hay dos tramos por hilo en memoria. Un frame por tick: 60 FPS.
+//
+// Uso: ./replayvideo PARTIDA.tstr SALIDA.y4m|SALIDA.ppm|- [--ppm] [--threads N]
+//                    [--chunk F] [--hud]
+//      ./streambench --games 1 --out partida.tstr && ./replayvideo partida.tstr partida.y4m --hud
+//      ./replayvideo partida.tstr - | ffmpeg -i - partida.mp4
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "battle.h" // getCpuCount()
+#include "softrender.h"
+#include "stream.h"
+
+#define MAX_THREADS 64
+#define DEFAULT_CHUNK_FRAMES 60
+
+typedef struct
+{
+    long offset;
+    uint32_t tick;
+} Keyframe;
+
+typedef struct
+{
+    // Stream e índice (solo lectura una vez arrancados los hilos)
+    const uint8_t *data;
+    long size;
+    Keyframe *keyframes;
+    int keyframeCount;
+    uint32_t firstTick;
+    int frameCount;
+
+    bool ppm;
+    bool hud;
+    size_t frameBytes; // Encabezado "FRAME\n" de Y4M incluido
+    int chunkFrames;
+    int chunkCount;
+
+    // Tramos en vuelo: el tramo c usa el slot c % slotCount
+    uint8_t **slots;
+    int *slotChunk; // Tramo listo en cada slot (-1 = vacío)
+    int slotCount;
+    int nextChunk;    // Próximo tramo a dibujar
+    int writtenChunks; // Tramos ya escritos (todos los anteriores también)
+    bool failed;
+    pthread_mutex_t mutex;
+    pthread_cond_t slotFree;
+    pthread_cond_t chunkReady;
+} Exporter;
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static uint8_t *loadFile(const char *path, long *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        printf("Error al abrir %s\n", path);
+        return NULL;
+    }
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = malloc((size_t)*size + 1);
+    if (data == NULL || fread(data, 1, (size_t)*size, file) != (size_t)*size)
+    {
+        printf("Error al leer %s\n", path);
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+// Decodifica todo el stream una vez y anota dónde empieza cada keyframe
+static bool indexStream(Exporter *exporter)
+{
+    if (exporter->size < 4 || memcmp(exporter->data, STREAM_MAGIC, 4) != 0)
+    {
+        printf("Error: no es un stream de Tetris\n");
+        return false;
+    }
+
+    StreamDecoder decoder;
+    initStreamDecoder(&decoder);
+    int capacity = 64;
+    exporter->keyframes = malloc(sizeof(Keyframe) * (size_t)capacity);
+    exporter->keyframeCount = 0;
+
+    long offset = 4;
+    while (offset < exporter->size)
+    {
+        bool key = (exporter->data[offset] & FRAME_KEY) != 0;
+        int used = decodeStreamFrame(&decoder, exporter->data + offset, (int)(exporter->size - offset));
+        if (used <= 0)
+        {
+            printf("Stream corrupto en el byte %ld; se exporta hasta ahí\n", offset);
+            break;
+        }
+        if (key)
+        {
+            if (exporter->keyframeCount == capacity)
+            {
+                capacity *= 2;
+                exporter->keyframes = realloc(exporter->keyframes, sizeof(Keyframe) * (size_t)capacity);
+            }
+            exporter->keyframes[exporter->keyframeCount++] = (Keyframe){offset, decoder.view.tick};
+        }
+        offset += used;
+    }
+    exporter->size = offset;
+
+    if (exporter->keyframeCount == 0)
+    {
+        printf("Error: el stream no tiene keyframes\n");
+        return false;
+    }
+    exporter->firstTick = exporter->keyframes[0].tick;
+    exporter->frameCount = (int)(decoder.view.tick - exporter->firstTick) + 1;
+    return true;
+}
+
+// Último keyframe en o antes de `tick`
+static const Keyframe *findKeyframe(const Exporter *exporter, uint32_t tick)
+{
+    int low = 0;
+    int high = exporter->keyframeCount - 1;
+    while (low < high)
+    {
+        int middle = (low + high + 1) / 2;
+        if (exporter->keyframes[middle].tick <= tick)
+            low = middle;
+        else
+            high = middle - 1;
+    }
+    return &exporter->keyframes[low];
+}
+
+static void renderChunk(const Exporter *exporter, Framebuffer *framebuffer, int chunk, uint8_t *out)
+{
+    int first = chunk * exporter->chunkFrames;
+    int last = first + exporter->chunkFrames < exporter->frameCount ? first + exporter->chunkFrames
+                                                                    : exporter->frameCount;
+    uint32_t startTick = exporter->firstTick + (uint32_t)first;
+
+    StreamDecoder decoder;
+    initStreamDecoder(&decoder);
+    long offset = findKeyframe(exporter, startTick)->offset;
+
+    for (int frame = first; frame < last; frame++)
+    {
+        // Aplicar todos los frames del stream hasta este tick
+        uint32_t tick = exporter->firstTick + (uint32_t)frame;
+        uint32_t frameTick;
+        bool changed = false;
+        while (offset < exporter->size &&
+               peekStreamFrameTick(&decoder, exporter->data + offset, (int)(exporter->size - offset), &frameTick) &&
+               frameTick <= tick)
+        {
+            offset += decodeStreamFrame(&decoder, exporter->data + offset, (int)(exporter->size - offset));
+            changed = true;
+        }
+
+        // Un tick sin frames en el stream no cambió nada visible: se copia
+        // el frame ya convertido en vez de dibujarlo de nuevo
+        uint8_t *frameOut = out + (size_t)(frame - first) * exporter->frameBytes;
+        if (!changed && frame > first)
+        {
+            memcpy(frameOut, frameOut - exporter->frameBytes, exporter->frameBytes);
+            continue;
+        }
+
+        softRenderGame(framebuffer, &decoder.view, exporter->hud);
+        if (exporter->ppm)
+        {
+            int header = sprintf((char *)frameOut, "P6\n%d %d\n255\n", framebuffer->width, framebuffer->height);
+            framebufferToRgb(framebuffer, frameOut + header);
+        }
+        else
+        {
+            memcpy(frameOut, "FRAME\n", 6);
+            framebufferToYuv420(framebuffer, frameOut + 6);
+        }
+    }
+}
+
+static void *exportWorker(void *arg)
+{
+    Exporter *exporter = arg;
+    Framebuffer framebuffer;
+    if (!initFramebuffer(&framebuffer, WINDOW_WIDTH, WINDOW_HEIGHT))
+    {
+        pthread_mutex_lock(&exporter->mutex);
+        exporter->failed = true;
+        pthread_cond_broadcast(&exporter->chunkReady);
+        pthread_mutex_unlock(&exporter->mutex);
+        return NULL;
+    }
+
+    pthread_mutex_lock(&exporter->mutex);
+    while (exporter->nextChunk < exporter->chunkCount && !exporter->failed)
+    {
+        int chunk = exporter->nextChunk++;
+        // Esperar a que el escritor libere el slot de este tramo
+        while (chunk >= exporter->writtenChunks + exporter->slotCount && !exporter->failed)
+            pthread_cond_wait(&exporter->slotFree, &exporter->mutex);
+        if (exporter->failed)
+            break;
+        uint8_t *out = exporter->slots[chunk % exporter->slotCount];
+        pthread_mutex_unlock(&exporter->mutex);
+
+        renderChunk(exporter, &framebuffer, chunk, out);
+
+        pthread_mutex_lock(&exporter->mutex);
+        exporter->slotChunk[chunk % exporter->slotCount] = chunk;
+        pthread_cond_broadcast(&exporter->chunkReady);
+    }
+    pthread_mutex_unlock(&exporter->mutex);
+
+    freeFramebuffer(&framebuffer);
+    return NULL;
+}
+
+// Escribe los tramos en orden a medida que los terminan los hilos
+static bool writeChunks(Exporter *exporter, FILE *output)
+{
+    for (int chunk = 0; chunk < exporter->chunkCount; chunk++)
+    {
+        int slot = chunk % exporter->slotCount;
+        pthread_mutex_lock(&exporter->mutex);
+        while (exporter->slotChunk[slot] != chunk && !exporter->failed)
+            pthread_cond_wait(&exporter->chunkReady, &exporter->mutex);
+        bool failed = exporter->failed;
+        pthread_mutex_unlock(&exporter->mutex);
+        if (failed)
+            return false;
+
+        int frames = chunk == exporter->chunkCount - 1 ? exporter->frameCount - chunk * exporter->chunkFrames
+                                                       : exporter->chunkFrames;
+        size_t bytes = (size_t)frames * exporter->frameBytes;
+        bool ok = fwrite(exporter->slots[slot], 1, bytes, output) == bytes;
+
+        pthread_mutex_lock(&exporter->mutex);
+        exporter->slotChunk[slot] = -1;
+        exporter->writtenChunks = chunk + 1;
+        if (!ok)
+            exporter->failed = true;
+        pthread_cond_broadcast(&exporter->slotFree);
+        pthread_mutex_unlock(&exporter->mutex);
+        if (!ok)
+        {
+            printf("Error al escribir el video\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        printf("Uso: %s PARTIDA.tstr SALIDA.y4m|SALIDA.ppm|- [--ppm] [--threads N] [--chunk F] [--hud]\n", argv[0]);
+        return 1;
+    }
+
+    Exporter exporter;
+    memset(&exporter, 0, sizeof(exporter));
+    const char *inputPath = argv[1];
+    const char *outputPath = argv[2];
+    int numThreads = getCpuCount();
+    exporter.chunkFrames = DEFAULT_CHUNK_FRAMES;
+    size_t outputLength = strlen(outputPath);
+    exporter.ppm = outputLength > 4 && strcmp(outputPath + outputLength - 4, ".ppm") == 0;
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--ppm") == 0)
+            exporter.ppm = true;
+        else if (strcmp(argv[i], "--hud") == 0)
+            exporter.hud = true;
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            numThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--chunk") == 0 && i + 1 < argc)
+            exporter.chunkFrames = atoi(argv[++i]);
+        else
+        {
+            printf("Opción desconocida: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > MAX_THREADS)
+        numThreads = MAX_THREADS;
+    if (exporter.chunkFrames < 1)
+        exporter.chunkFrames = 1;
+
+    // Con la salida en stdout (para ffmpeg) el video se queda con el
+    // descriptor original y los printf pasan a stderr
+    bool toStdout = strcmp(outputPath, "-") == 0;
+    FILE *output = toStdout ? fdopen(dup(STDOUT_FILENO), "wb") : NULL;
+    if (toStdout)
+        dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    exporter.data = loadFile(inputPath, &exporter.size);
+    if (exporter.data == NULL || !indexStream(&exporter))
+        return 1;
+
+    char header[64];
+    int headerLength = 0;
+    if (exporter.ppm)
+    {
+        exporter.frameBytes = (size_t)snprintf(header, sizeof(header), "P6\n%d %d\n255\n", WINDOW_WIDTH, WINDOW_HEIGHT) +
+                              (size_t)WINDOW_WIDTH * WINDOW_HEIGHT * 3;
+    }
+    else
+    {
+        headerLength = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", WINDOW_WIDTH,
+                                WINDOW_HEIGHT, TARGET_FPS);
+        exporter.frameBytes = 6 + (size_t)WINDOW_WIDTH * WINDOW_HEIGHT * 3 / 2;
+    }
+    exporter.chunkCount = (exporter.frameCount + exporter.chunkFrames - 1) / exporter.chunkFrames;
+    if (numThreads > exporter.chunkCount)
+        numThreads = exporter.chunkCount;
+
+    if (!toStdout)
+        output = fopen(outputPath, "wb");
+    if (output == NULL)
+    {
+        printf("Error al crear %s\n", outputPath);
+        return 1;
+    }
+    if (headerLength > 0)
+        fwrite(header, 1, (size_t)headerLength, output);
+
+    exporter.slotCount = numThreads * 2;
+    exporter.slots = malloc(sizeof(uint8_t *) * (size_t)exporter.slotCount);
+    exporter.slotChunk = malloc(sizeof(int) * (size_t)exporter.slotCount);
+    for (int i = 0; i < exporter.slotCount; i++)
+    {
+        exporter.slots[i] = malloc(exporter.frameBytes * (size_t)exporter.chunkFrames);
+        exporter.slotChunk[i] = -1;
+        if (exporter.slots[i] == NULL)
+        {
+            printf("Error al reservar %zu bytes por tramo (probar con --chunk menor)\n",
+                   exporter.frameBytes * (size_t)exporter.chunkFrames);
+            return 1;
+        }
+    }
+    pthread_mutex_init(&exporter.mutex, NULL);
+    pthread_cond_init(&exporter.slotFree, NULL);
+    pthread_cond_init(&exporter.chunkReady, NULL);
+
+    printf("%d frames (%.1f s de partida, %d keyframes) -> %s %dx%d, %d hilos, tramos de %d frames\n",
+           exporter.frameCount, (double)exporter.frameCount / TARGET_FPS, exporter.keyframeCount,
+           exporter.ppm ? "PPM" : "Y4M", WINDOW_WIDTH, WINDOW_HEIGHT, numThreads, exporter.chunkFrames);
+
+    uint64_t start = nowNs();
+    pthread_t threads[MAX_THREADS];
+    int started = 0;
+    for (int i = 0; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[started], NULL, exportWorker, &exporter) == 0)
+            started++;
+    }
+    bool ok = started > 0 && writeChunks(&exporter, output);
+    if (started == 0)
+        printf("Error al crear los hilos\n");
+    for (int i = 0; i < started; i++)
+        pthread_join(threads[i], NULL);
+    if (fclose(output) != 0)
+        ok = false;
+    double seconds = (double)(nowNs() - start) / 1e9;
+
+    if (ok)
+    {
+        double fps = exporter.frameCount / seconds;
+        double megabytes = (double)exporter.frameBytes * exporter.frameCount / (1024.0 * 1024.0);
+        printf("%.0f frames/s (%.1fx tiempo real), %.1f MB en %.2f s (%.0f MB/s)\n", fps, fps / TARGET_FPS, megabytes,
+               seconds, megabytes / seconds);
+    }
+
+    for (int i = 0; i < exporter.slotCount; i++)
+        free(exporter.slots[i]);
+    free(exporter.slots);
+    free(exporter.slotChunk);
+    free(exporter.keyframes);
+    free((void *)exporter.data);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+// Retención de puntajes: cuánto achica y acelera resumir lo viejo
+//
+// Llena una base aparte (no toca tetris.db) con N puntajes repartidos en
+// los últimos D días entre U usuarios, mide el Top 10 y el tamaño del
+// archivo, corre rollUpScores y vuelve a medir. Verifica que no se pierdan
+// partidas, líneas ni el mejor puntaje, y que el Top 10 siga siendo el
+// mejor de cada usuario y día.
+//
+// Uso: ./scorebench [--scores N] [--days D] [--users U] [--keep K] [--db ARCHIVO]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include "database.h"
+#include "metrics.h"
+
+static long fileSize(const char *path)
+{
+    struct stat info;
+    return stat(path, &info) == 0 ? (long)info.st_size : 0;
+}
+
+static void queryTotals(sqlite3 *handle, long long *games, long long *lines, long long *best)
+{
+    const char *sql = "SELECT (SELECT COUNT(*) FROM scores) + (SELECT IFNULL(SUM(games), 0) FROM score_daily), "
+                      "(SELECT IFNULL(SUM(lines), 0) FROM scores) + (SELECT IFNULL(SUM(total_lines), 0) FROM score_daily), "
+                      "MAX((SELECT IFNULL(MAX(score), 0) FROM scores), (SELECT IFNULL(MAX(best_score), 0) FROM score_daily));";
+    sqlite3_stmt *stmt;
+    *games = *lines = *best = -1;
+    if (sqlite3_prepare_v2(handle, sql, -1, &stmt, NULL) == SQLITE_OK)
+    {
+        if (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            *games = sqlite3_column_int64(stmt, 0);
+            *lines = sqlite3_column_int64(stmt, 1);
+            *best = sqlite3_column_int64(stmt, 2);
+        }
+        sqlite3_finalize(stmt);
+    }
+}
+
+// Top 10 esperado: los mejores entre los recientes y el mejor de cada
+// usuario y día viejo, calculado directo sobre las filas sin resumir
+static int expectedTop(sqlite3 *handle, const char *cutoff, int *top)
+{
+    const char *sql = "SELECT score FROM scores WHERE date >= ?1 "
+                      "UNION ALL SELECT MAX(score) FROM scores WHERE date < ?1 GROUP BY username, substr(date, 1, 10) "
+                      "ORDER BY 1 DESC LIMIT 10;";
+    sqlite3_stmt *stmt;
+    int count = 0;
+    if (sqlite3_prepare_v2(handle, sql, -1, &stmt, NULL) == SQLITE_OK)
+    {
+        sqlite3_bind_text(stmt, 1, cutoff, -1, SQLITE_STATIC);
+        while (sqlite3_step(stmt) == SQLITE_ROW && count < 10)
+            top[count++] = sqlite3_column_int(stmt, 0);
+        sqlite3_finalize(stmt);
+    }
+    return count;
+}
+
+static double timeTopScores(Score *scores, int *count)
+{
+    const int rounds = 200;
+    uint64_t start = metricsNowNs();
+    for (int i = 0; i < rounds; i++)
+        *count = getTopScores(scores, 10);
+    return (double)(metricsNowNs() - start) / rounds / 1000.0;
+}
+
+int main(int argc, char *argv[])
+{
+    int totalScores = 200000;
+    int days = 365;
+    int users = 50;
+    int keepDays = SCORE_RETENTION_DAYS;
+    const char *path = "scorebench.db";
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--scores") == 0 && i + 1 < argc)
+            totalScores = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--days") == 0 && i + 1 < argc)
+            days = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--users") == 0 && i + 1 < argc)
+            users = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--keep") == 0 && i + 1 < argc)
+            keepDays = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--db") == 0 && i + 1 < argc)
+            path = argv[++i];
+        else
+        {
+            printf("Uso: %s [--scores N] [--days D] [--users U] [--keep K] [--db ARCHIVO]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (totalScores < 1 || days < 1 || users < 1 || keepDays < 0)
+    {
+        printf("Los valores tienen que ser positivos\n");
+        return 1;
+    }
+
+    remove(path);
+    setDatabasePath(path);
+    if (!initDatabase())
+        return 1;
+    closeDatabase();
+
+    // Se llena con una conexión propia: saveScore siempre usa la fecha de hoy
+    sqlite3 *handle;
+    if (sqlite3_open(path, &handle) != SQLITE_OK)
+    {
+        printf("Error al abrir %s: %s\n", path, sqlite3_errmsg(handle));
+        return 1;
+    }
+    sqlite3_exec(handle, "BEGIN;", NULL, NULL, NULL);
+    sqlite3_stmt *insert;
+    sqlite3_prepare_v2(handle, "INSERT INTO scores (username, score, lines, date) VALUES (?, ?, ?, ?);", -1, &insert,
+                       NULL);
+    uint32_t rng = 1;
+    time_t now = time(NULL);
+    for (int i = 0; i < totalScores; i++)
+    {
+        // En orden de fecha, como los inserta el juego
+        time_t when = now - (time_t)days * 86400 + (time_t)((double)i / totalScores * days * 86400);
+        char date[20];
+        strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&when));
+        char username[16];
+        rng = rng * 1103515245u + 12345u;
+        snprintf(username, sizeof(username), "jugador%d", (int)(rng >> 8) % users);
+        rng = rng * 1103515245u + 12345u;
+        int lines = (int)(rng >> 20) % 120;
+        rng = rng * 1103515245u + 12345u;
+        int score = (rng >> 28) == 0 ? 0 : lines * 100 + (int)(rng >> 16) % 1000 * 100;
+
+        sqlite3_bind_text(insert, 1, username, -1, SQLITE_TRANSIENT);
+        sqlite3_bind_int(insert, 2, score);
+        sqlite3_bind_int(insert, 3, lines);
+        sqlite3_bind_text(insert, 4, date, -1, SQLITE_TRANSIENT);
+        sqlite3_step(insert);
+        sqlite3_reset(insert);
+    }
+    sqlite3_finalize(insert);
+    sqlite3_exec(handle, "COMMIT;", NULL, NULL, NULL);
+
+    long long gamesBefore, linesBefore, bestBefore;
+    queryTotals(handle, &gamesBefore, &linesBefore, &bestBefore);
+    time_t cutoffTime = now - (time_t)keepDays * 86400;
+    char cutoff[20];
+    strftime(cutoff, sizeof(cutoff), "%Y-%m-%d 00:00:00", localtime(&cutoffTime));
+    int expected[10];
+    int expectedCount = expectedTop(handle, cutoff, expected);
+
+    setDatabasePath(path);
+    if (!initDatabase())
+        return 1;
+    Score scores[10];
+    int count;
+    long sizeBefore = fileSize(path);
+    double topBefore = timeTopScores(scores, &count);
+    printf("Antes:   %d puntajes en %d días, %.1f MB, Top 10 en %.1f us\n", totalScores, days,
+           (double)sizeBefore / (1024.0 * 1024.0), topBefore);
+
+    uint64_t start = metricsNowNs();
+    int rolled = rollUpScores(keepDays);
+    double seconds = (double)(metricsNowNs() - start) / 1e9;
+    long sizeAfter = fileSize(path);
+    double topAfter = timeTopScores(scores, &count);
+    printf("Después: %d resumidos en %.2f s (%.0f filas/s, transacciones de %d), %.1f MB, Top 10 en %.1f us\n",
+           rolled, seconds, rolled / (seconds > 0 ? seconds : 1e-9), SCORE_RETENTION_CHUNK,
+           (double)sizeAfter / (1024.0 * 1024.0), topAfter);
+    closeDatabase();
+
+    long long gamesAfter, linesAfter, bestAfter;
+    queryTotals(handle, &gamesAfter, &linesAfter, &bestAfter);
+    sqlite3_close(handle);
+
+    bool ok = rolled >= 0 && gamesAfter == gamesBefore && linesAfter == linesBefore && bestAfter == bestBefore &&
+              count == expectedCount;
+    for (int i = 0; ok && i < count; i++)
+        ok = scores[i].score == expected[i];
+    printf("Partidas %lld/%lld, líneas %lld/%lld, mejor %lld/%lld, Top 10: %s\n", gamesAfter, gamesBefore, linesAfter,
+           linesBefore, bestAfter, bestBefore, ok ? "OK" : "DISTINTO");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,195 @@
+// Benchmark del stream de espectador (keyframes + deltas)
+//
+// Simula partidas headless con inputs aleatorios, las codifica tick a tick,
+// verifica que el decoder reconstruya cada estado exacto y reporta bytes
+// por minuto de partida y throughput de encode/decode.
+//
+// Uso: ./streambench [--games N] [--out archivo.tstr]
+//      ./game --watch archivo.tstr   (reproduce la primera partida)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "game.h"
+#include "stream.h"
+
+#define MAX_TICKS_PER_GAME (TARGET_FPS * 60 * 10) // Cortar partidas a los 10 minutos
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Teclas aleatorias: mayormente caer, a veces mover o rotar
+static unsigned randomInputs(uint32_t *rng)
+{
+    uint32_t r = nextRandom(rng);
+    unsigned inputs = 0;
+    if ((r & 3) != 0)
+        inputs |= INPUT_DOWN;
+    if (((r >> 2) & 7) == 0)
+        inputs |= INPUT_LEFT;
+    else if (((r >> 2) & 7) == 1)
+        inputs |= INPUT_RIGHT;
+    if (((r >> 5) & 7) == 0)
+        inputs |= INPUT_ROTATE;
+    return inputs;
+}
+
+typedef struct
+{
+    uint8_t *data;
+    size_t size;
+    size_t capacity;
+} Buffer;
+
+static void appendBytes(Buffer *buffer, const uint8_t *bytes, size_t count)
+{
+    if (buffer->size + count > buffer->capacity)
+    {
+        buffer->capacity = (buffer->capacity + count) * 2;
+        buffer->data = realloc(buffer->data, buffer->capacity);
+    }
+    memcpy(buffer->data + buffer->size, bytes, count);
+    buffer->size += count;
+}
+
+// Simula una partida completa. Si `encoder` no es NULL, codifica cada tick
+// en `out`; si además `decoder` no es NULL, verifica en lockstep.
+static uint64_t playGame(uint32_t seed, StreamEncoder *encoder, Buffer *out,
+                         StreamDecoder *decoder, uint64_t *mismatches)
+{
+    GameState state;
+    initGame(&state, seed);
+    uint32_t rng = seed * 2654435761u + 7;
+    uint8_t frame[STREAM_MAX_FRAME_SIZE];
+
+    if (encoder != NULL)
+        initStreamEncoder(encoder);
+    if (decoder != NULL)
+        initStreamDecoder(decoder);
+
+    uint64_t ticks = 0;
+    while (!state.gameOver && ticks < MAX_TICKS_PER_GAME)
+    {
+        stepGame(&state, randomInputs(&rng));
+        ticks++;
+
+        if (encoder == NULL)
+            continue;
+
+        int len = encodeStreamFrame(encoder, &state, frame);
+        if (len > 0)
+        {
+            appendBytes(out, frame, (size_t)len);
+
+            if (decoder != NULL &&
+                (decodeStreamFrame(decoder, frame, len) != len || !sameVisibleState(&decoder->view, &state)))
+            {
+                (*mismatches)++;
+            }
+        }
+    }
+
+    return ticks;
+}
+
+int main(int argc, char *argv[])
+{
+    int numGames = 200;
+    const char *outPath = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            numGames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+            outPath = argv[++i];
+        else
+        {
+            printf("Uso: %s [--games N] [--out archivo.tstr]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    StreamEncoder encoder;
+    StreamDecoder decoder;
+    Buffer stream = {0};
+    uint64_t mismatches = 0;
+
+    // 1. Verificación: cada frame decodificado debe dar el estado exacto
+    uint64_t totalTicks = 0;
+    for (int i = 0; i < numGames; i++)
+    {
+        size_t before = stream.size;
+        totalTicks += playGame((uint32_t)i + 1, &encoder, &stream, &decoder, &mismatches);
+
+        if (i == 0 && outPath != NULL)
+        {
+            FILE *file = fopen(outPath, "wb");
+            if (file != NULL)
+            {
+                fwrite(STREAM_MAGIC, 1, 4, file);
+                fwrite(stream.data + before, 1, stream.size - before, file);
+                fclose(file);
+                printf("Primera partida guardada en %s (./game --watch %s)\n", outPath, outPath);
+            }
+        }
+    }
+
+    // 2. Tiempo de simulación sola vs simulación + encode
+    uint64_t start = nowNs();
+    for (int i = 0; i < numGames; i++)
+        playGame((uint32_t)i + 1, NULL, NULL, NULL, NULL);
+    uint64_t simulateNs = nowNs() - start;
+
+    Buffer scratch = {0};
+    start = nowNs();
+    for (int i = 0; i < numGames; i++)
+    {
+        scratch.size = 0;
+        playGame((uint32_t)i + 1, &encoder, &scratch, NULL, NULL);
+    }
+    uint64_t encodeNs = nowNs() - start;
+    encodeNs = encodeNs > simulateNs ? encodeNs - simulateNs : 1;
+
+    // 3. Decode de todo el stream (cada partida arranca con keyframe)
+    uint64_t frames = 0;
+    start = nowNs();
+    initStreamDecoder(&decoder);
+    for (size_t offset = 0; offset < stream.size;)
+    {
+        int used = decodeStreamFrame(&decoder, stream.data + offset, (int)(stream.size - offset));
+        if (used <= 0)
+        {
+            printf("Error de decode en el byte %zu\n", offset);
+            return 1;
+        }
+        offset += (size_t)used;
+        frames++;
+    }
+    uint64_t decodeNs = nowNs() - start;
+    if (decodeNs == 0)
+        decodeNs = 1;
+
+    double minutes = (double)totalTicks / (TARGET_FPS * 60.0);
+    double rawPerMinute = (double)GRID_WIDTH * GRID_HEIGHT * TARGET_FPS * 60.0;
+    double bytesPerMinute = (double)stream.size / minutes;
+
+    printf("Partidas: %d, ticks: %llu (%.1f minutos de juego), frames: %llu\n",
+           numGames, (unsigned long long)totalTicks, minutes, (unsigned long long)frames);
+    printf("Bytes por minuto de partida: %.0f (vs %.0f con 200 celdas por tick, %.0fx menos)\n",
+           bytesPerMinute, rawPerMinute, rawPerMinute / bytesPerMinute);
+    printf("Encode: %.2f M ticks/s | Decode: %.2f M frames/s (%.1f MB/s)\n",
+           (double)totalTicks / ((double)encodeNs / 1e9) / 1e6,
+           (double)frames / ((double)decodeNs / 1e9) / 1e6,
+           (double)stream.size / ((double)decodeNs / 1e9) / (1024.0 * 1024.0));
+    printf("Estados distintos al original: %llu\n", (unsigned long long)mismatches);
+
+    free(stream.data);
+    free(scratch.data);
+    return mismatches == 0 ? 0 : 1;
+}
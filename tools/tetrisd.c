@@ -0,0 +1,56 @@
+// Servidor headless de partidas (ver server.h)
+//
+// Uso: ./tetrisd [--port P] [--unix RUTA] [--workers N] [--max-sessions M]
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "protocol.h"
+#include "server.h"
+
+static void handleSignal(int signal)
+{
+    (void)signal;
+    stopServer();
+}
+
+int main(int argc, char *argv[])
+{
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    ServerConfig config;
+    config.port = SERVER_DEFAULT_PORT;
+    config.socketPath = SERVER_DEFAULT_SOCKET;
+    config.numWorkers = cores > 1 ? (int)cores - 1 : 1; // Un core queda para el I/O
+    config.maxSessions = 10000;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--port") == 0 && i + 1 < argc)
+            config.port = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--unix") == 0 && i + 1 < argc)
+            config.socketPath = argv[++i];
+        else if (strcmp(argv[i], "--no-unix") == 0)
+            config.socketPath = NULL;
+        else if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc)
+            config.numWorkers = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-sessions") == 0 && i + 1 < argc)
+            config.maxSessions = atoi(argv[++i]);
+        else
+        {
+            printf("Uso: %s [--port P] [--unix RUTA | --no-unix] [--workers N] [--max-sessions M]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Sin SA_RESTART: epoll_wait vuelve con EINTR y el loop ve el pedido de parada
+    struct sigaction action = {0};
+    action.sa_handler = handleSignal;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    return runServer(&config);
+}
@@ -0,0 +1,467 @@
+// Torneo bot contra bot en modo versus, con ratings Glicko
+//
+// Cada ronda arma los cruces (todos contra todos, o suizo: vecinos en el
+// ranking), juega `--games` partidas por cruce con semillas distintas
+// (la misma semilla para ambos lados: mismas piezas, misma basura) y las
+// reparte entre todos los núcleos. Después de cada ronda actualiza los
+// ratings e imprime el progreso. El torneo termina antes si los
+// intervalos de 95% de bots vecinos en el ranking ya no se solapan.
+// El resultado se guarda en tetris.db (tablas tournaments y bot_ratings).
+//
+// Uso: ./tournament [--swiss] [--rounds N] [--games N] [--threads N]
+//                   [--max-ticks N] [--bot nombre:w0,w1,w2,w3 ...] [--no-db]
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arena.h"
+#include "battle.h" // getCpuCount()
+#include "bot.h"
+#include "database.h"
+#include "rollback.h"
+
+#define MAX_BOTS 32
+#define MAX_MATCHES_PER_ROUND 8192
+#define MIN_ROUNDS 3
+#define GLICKO_INITIAL_RATING 1500.0
+#define GLICKO_INITIAL_RD 350.0
+#define GLICKO_MIN_RD 30.0
+#define CONFIDENCE_Z 1.96 // Intervalo de 95%
+
+#define RESULT_WIN_A 0
+#define RESULT_WIN_B 1
+#define RESULT_DRAW 2
+
+typedef struct
+{
+    char name[32];
+    BotWeights weights;
+    double rating;
+    double rd;
+    int wins;
+    int losses;
+    int draws;
+} TournamentBot;
+
+typedef struct
+{
+    int a;
+    int b;
+    uint32_t seed;
+    int result;
+    uint32_t ticks;
+} Match;
+
+typedef struct
+{
+    TournamentBot bots[MAX_BOTS];
+    int numBots;
+    Match matches[MAX_MATCHES_PER_ROUND];
+    int numMatches;
+    int maxTicks;
+    _Atomic int nextMatch;
+} Tournament;
+
+// Configuraciones de ejemplo si no se pasa ningún --bot
+static const struct
+{
+    const char *name;
+    BotWeights weights;
+} BUILTIN_BOTS[] = {
+    {"default", {{-0.510066f, 0.760666f, -0.35663f, -0.184483f}}},
+    {"agresivo", {{-0.30f, 1.20f, -0.30f, -0.10f}}},
+    {"plano", {{-0.40f, 0.50f, -0.40f, -0.60f}}},
+    {"sin-huecos", {{-0.20f, 0.40f, -1.00f, -0.10f}}},
+    {"ciego", {{-1.00f, 0.10f, 0.00f, 0.00f}}},
+};
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void addBot(Tournament *tournament, const char *name, const BotWeights *weights)
+{
+    if (tournament->numBots == MAX_BOTS)
+        return;
+    TournamentBot *bot = &tournament->bots[tournament->numBots++];
+    snprintf(bot->name, sizeof(bot->name), "%s", name);
+    bot->weights = *weights;
+    bot->rating = GLICKO_INITIAL_RATING;
+    bot->rd = GLICKO_INITIAL_RD;
+}
+
+// "nombre:w0,w1,w2,w3"
+static bool parseBot(Tournament *tournament, const char *spec)
+{
+    const char *colon = strchr(spec, ':');
+    BotWeights weights;
+    if (colon == NULL || colon == spec ||
+        sscanf(colon + 1, "%f,%f,%f,%f", &weights.weights[0], &weights.weights[1],
+               &weights.weights[2], &weights.weights[3]) != NUM_BOT_FEATURES)
+    {
+        printf("Error: bot inválido '%s' (formato nombre:w0,w1,w2,w3)\n", spec);
+        return false;
+    }
+
+    char name[32];
+    int length = (int)(colon - spec) < (int)sizeof(name) - 1 ? (int)(colon - spec) : (int)sizeof(name) - 1;
+    memcpy(name, spec, (size_t)length);
+    name[length] = '\0';
+    addBot(tournament, name, &weights);
+    return true;
+}
+
+// ============ PARTIDAS EN PARALELO ============
+
+// Versus con basura sembrada; si nadie pierde antes de maxTicks es empate
+static void playMatch(const Tournament *tournament, Match *match)
+{
+    VersusState versus;
+    Bot bots[2];
+    initVersus(&versus, match->seed);
+    initBot(&bots[0], &tournament->bots[match->a].weights);
+    initBot(&bots[1], &tournament->bots[match->b].weights);
+
+    while (versus.winner == VERSUS_NO_WINNER && versus.frame < (uint32_t)tournament->maxTicks)
+    {
+        stepVersus(&versus, botInputs(&bots[0], &versus.players[0]), botInputs(&bots[1], &versus.players[1]));
+    }
+
+    match->ticks = versus.frame;
+    if (versus.winner == 0)
+        match->result = RESULT_WIN_A;
+    else if (versus.winner == 1)
+        match->result = RESULT_WIN_B;
+    else
+        match->result = RESULT_DRAW;
+}
+
+static void *matchWorker(void *arg)
+{
+    Tournament *tournament = (Tournament *)arg;
+    while (true)
+    {
+        int index = atomic_fetch_add(&tournament->nextMatch, 1);
+        if (index >= tournament->numMatches)
+            break;
+        playMatch(tournament, &tournament->matches[index]);
+    }
+    return NULL;
+}
+
+static void playRound(Tournament *tournament, int numThreads)
+{
+    pthread_t threads[BATTLE_MAX_THREADS];
+    int started = 0;
+
+    atomic_store(&tournament->nextMatch, 0);
+    for (int i = 1; i < numThreads; i++)
+    {
+        if (pthread_create(&threads[started], NULL, matchWorker, tournament) == 0)
+            started++;
+    }
+    matchWorker(tournament);
+    for (int i = 0; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+// ============ CRUCES ============
+
+static void addMatches(Tournament *tournament, int a, int b, int games, uint32_t *seed)
+{
+    for (int g = 0; g < games && tournament->numMatches < MAX_MATCHES_PER_ROUND; g++)
+    {
+        Match *match = &tournament->matches[tournament->numMatches++];
+        // Alternar lados para que ninguno juegue siempre como jugador 0
+        match->a = g % 2 == 0 ? a : b;
+        match->b = g % 2 == 0 ? b : a;
+        match->seed = (*seed)++;
+    }
+}
+
+static int rankedOrder[MAX_BOTS];
+
+static void sortRanking(const Tournament *tournament)
+{
+    for (int i = 0; i < tournament->numBots; i++)
+    {
+        rankedOrder[i] = i;
+    }
+    // Inserción: pocos bots
+    for (int i = 1; i < tournament->numBots; i++)
+    {
+        int current = rankedOrder[i];
+        int j = i - 1;
+        while (j >= 0 && tournament->bots[rankedOrder[j]].rating < tournament->bots[current].rating)
+        {
+            rankedOrder[j + 1] = rankedOrder[j];
+            j--;
+        }
+        rankedOrder[j + 1] = current;
+    }
+}
+
+static void scheduleRound(Tournament *tournament, bool swiss, int round, int games, uint32_t *seed)
+{
+    tournament->numMatches = 0;
+
+    if (!swiss)
+    {
+        for (int a = 0; a < tournament->numBots; a++)
+        {
+            for (int b = a + 1; b < tournament->numBots; b++)
+            {
+                addMatches(tournament, a, b, games, seed);
+            }
+        }
+        return;
+    }
+
+    // Suizo: 1º contra 2º, 3º contra 4º... y en las rondas impares 2º contra
+    // 3º, 4º contra 5º..., así cada par de vecinos del ranking se enfrenta
+    // directamente (el que queda sin rival descansa)
+    sortRanking(tournament);
+    for (int i = round % 2; i + 1 < tournament->numBots; i += 2)
+    {
+        addMatches(tournament, rankedOrder[i], rankedOrder[i + 1], games, seed);
+    }
+}
+
+// ============ GLICKO ============
+// Cada ronda es un período de rating: todos los resultados de la ronda se
+// aplican juntos usando los ratings del comienzo de la ronda.
+
+static double glickoG(double rd)
+{
+    const double q = log(10.0) / 400.0;
+    return 1.0 / sqrt(1.0 + 3.0 * q * q * rd * rd / (M_PI * M_PI));
+}
+
+static double glickoExpected(double rating, double opponentRating, double opponentRd)
+{
+    return 1.0 / (1.0 + pow(10.0, -glickoG(opponentRd) * (rating - opponentRating) / 400.0));
+}
+
+static void updateRatings(Tournament *tournament)
+{
+    const double q = log(10.0) / 400.0;
+    double variance[MAX_BOTS] = {0}; // Σ g² E (1 - E)
+    double delta[MAX_BOTS] = {0};    // Σ g (s - E)
+
+    for (int m = 0; m < tournament->numMatches; m++)
+    {
+        const Match *match = &tournament->matches[m];
+        TournamentBot *a = &tournament->bots[match->a];
+        TournamentBot *b = &tournament->bots[match->b];
+        double scoreA = match->result == RESULT_WIN_A ? 1.0 : match->result == RESULT_WIN_B ? 0.0 : 0.5;
+
+        double gB = glickoG(b->rd);
+        double expectedA = glickoExpected(a->rating, b->rating, b->rd);
+        variance[match->a] += gB * gB * expectedA * (1.0 - expectedA);
+        delta[match->a] += gB * (scoreA - expectedA);
+
+        double gA = glickoG(a->rd);
+        double expectedB = glickoExpected(b->rating, a->rating, a->rd);
+        variance[match->b] += gA * gA * expectedB * (1.0 - expectedB);
+        delta[match->b] += gA * ((1.0 - scoreA) - expectedB);
+
+        if (match->result == RESULT_WIN_A)
+        {
+            a->wins++;
+            b->losses++;
+        }
+        else if (match->result == RESULT_WIN_B)
+        {
+            b->wins++;
+            a->losses++;
+        }
+        else
+        {
+            a->draws++;
+            b->draws++;
+        }
+    }
+
+    for (int i = 0; i < tournament->numBots; i++)
+    {
+        TournamentBot *bot = &tournament->bots[i];
+        if (variance[i] == 0.0)
+            continue;
+
+        double dSquaredInverse = q * q * variance[i];
+        double precision = 1.0 / (bot->rd * bot->rd) + dSquaredInverse;
+        bot->rating += q / precision * delta[i];
+        bot->rd = sqrt(1.0 / precision);
+        if (bot->rd < GLICKO_MIN_RD)
+            bot->rd = GLICKO_MIN_RD;
+    }
+}
+
+// Todos los vecinos del ranking tienen intervalos de 95% disjuntos
+static bool rankingSeparated(const Tournament *tournament)
+{
+    sortRanking(tournament);
+    for (int i = 0; i + 1 < tournament->numBots; i++)
+    {
+        const TournamentBot *upper = &tournament->bots[rankedOrder[i]];
+        const TournamentBot *lower = &tournament->bots[rankedOrder[i + 1]];
+        if (upper->rating - CONFIDENCE_Z * upper->rd <= lower->rating + CONFIDENCE_Z * lower->rd)
+            return false;
+    }
+    return true;
+}
+
+static void printRanking(const Tournament *tournament)
+{
+    sortRanking(tournament);
+    printf("  %-4s %-16s %-8s %-17s %s\n", "Pos", "Bot", "Rating", "IC 95%", "G-P-E");
+    for (int i = 0; i < tournament->numBots; i++)
+    {
+        const TournamentBot *bot = &tournament->bots[rankedOrder[i]];
+        printf("  %-4d %-16s %-8.0f [%6.0f, %6.0f]  %d-%d-%d\n", i + 1, bot->name, bot->rating,
+               bot->rating - CONFIDENCE_Z * bot->rd, bot->rating + CONFIDENCE_Z * bot->rd,
+               bot->wins, bot->losses, bot->draws);
+    }
+}
+
+// ============ MAIN ============
+
+int main(int argc, char *argv[])
+{
+    static Tournament tournament;
+    bool swiss = false;
+    bool useDatabase = true;
+    int maxRounds = 50;
+    int gamesPerPair = 8;
+    int numThreads = getCpuCount();
+    tournament.maxTicks = TARGET_FPS * 60 * 5; // Empate a los 5 minutos de partida
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--swiss") == 0)
+            swiss = true;
+        else if (strcmp(argv[i], "--no-db") == 0)
+            useDatabase = false;
+        else if (strcmp(argv[i], "--rounds") == 0 && i + 1 < argc)
+            maxRounds = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            gamesPerPair = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            numThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc)
+            tournament.maxTicks = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--bot") == 0 && i + 1 < argc)
+        {
+            if (!parseBot(&tournament, argv[++i]))
+                return 1;
+        }
+        else
+        {
+            printf("Uso: %s [--swiss] [--rounds N] [--games N] [--threads N]\n"
+                   "          [--max-ticks N] [--bot nombre:w0,w1,w2,w3 ...] [--no-db]\n",
+                   argv[0]);
+            return 1;
+        }
+    }
+
+    if (tournament.numBots == 0)
+    {
+        for (size_t i = 0; i < sizeof(BUILTIN_BOTS) / sizeof(BUILTIN_BOTS[0]); i++)
+        {
+            addBot(&tournament, BUILTIN_BOTS[i].name, &BUILTIN_BOTS[i].weights);
+        }
+    }
+    if (tournament.numBots < 2)
+    {
+        printf("Error: hacen falta al menos 2 bots\n");
+        return 1;
+    }
+    if (numThreads < 1)
+        numThreads = 1;
+    if (numThreads > BATTLE_MAX_THREADS)
+        numThreads = BATTLE_MAX_THREADS;
+    if (gamesPerPair < 1)
+        gamesPerPair = 1;
+
+    printf("Torneo %s: %d bots, %d partidas por cruce, hasta %d rondas, %d hilos\n",
+           swiss ? "suizo" : "todos contra todos", tournament.numBots, gamesPerPair, maxRounds, numThreads);
+
+    uint32_t seed = 1;
+    int totalMatches = 0;
+    int round = 0;
+    bool stoppedEarly = false;
+    uint64_t start = nowNs();
+
+    while (round < maxRounds)
+    {
+        scheduleRound(&tournament, swiss, round, gamesPerPair, &seed);
+        playRound(&tournament, numThreads);
+        updateRatings(&tournament);
+        round++;
+        totalMatches += tournament.numMatches;
+
+        uint64_t ticks = 0;
+        int draws = 0;
+        for (int m = 0; m < tournament.numMatches; m++)
+        {
+            ticks += tournament.matches[m].ticks;
+            draws += tournament.matches[m].result == RESULT_DRAW;
+        }
+
+        double seconds = (double)(nowNs() - start) / 1e9;
+        printf("Ronda %d: %d partidas (%d empates, %.0f s de juego promedio) | total %d, %.1f partidas/s\n",
+               round, tournament.numMatches, draws,
+               (double)ticks / tournament.numMatches / TARGET_FPS, totalMatches, totalMatches / seconds);
+        printRanking(&tournament);
+        fflush(stdout);
+
+        if (round >= MIN_ROUNDS && rankingSeparated(&tournament))
+        {
+            stoppedEarly = round < maxRounds;
+            printf("Ranking separado con 95%% de confianza: fin del torneo\n");
+            break;
+        }
+    }
+
+    printArenaStats("de búsqueda (hilo principal)", threadArena());
+
+    if (!useDatabase)
+        return 0;
+
+    if (!initDatabase())
+        return 1;
+
+    BotRating ratings[MAX_BOTS];
+    sortRanking(&tournament);
+    for (int i = 0; i < tournament.numBots; i++)
+    {
+        const TournamentBot *bot = &tournament.bots[rankedOrder[i]];
+        snprintf(ratings[i].name, sizeof(ratings[i].name), "%s", bot->name);
+        snprintf(ratings[i].weights, sizeof(ratings[i].weights), "%.6f,%.6f,%.6f,%.6f",
+                 bot->weights.weights[0], bot->weights.weights[1], bot->weights.weights[2],
+                 bot->weights.weights[3]);
+        ratings[i].rating = bot->rating;
+        ratings[i].deviation = bot->rd;
+        ratings[i].wins = bot->wins;
+        ratings[i].losses = bot->losses;
+        ratings[i].draws = bot->draws;
+    }
+
+    int id = saveTournament(swiss ? "swiss" : "round-robin", round, totalMatches, stoppedEarly,
+                            ratings, tournament.numBots);
+    closeDatabase();
+    if (id < 0)
+        return 1;
+
+    printf("Resultados guardados en tetris.db (torneo %d)\n", id);
+    return 0;
+}
@@ -0,0 +1,435 @@
+// Afinador de pesos del bot con un algoritmo genético
+//
+// Cada generación evalúa a toda la población con el mismo lote de semillas
+// (números aleatorios comunes: todos los candidatos ven las mismas piezas,
+// así la diferencia de fitness es del candidato y no de la suerte). Las
+// partidas se reparten entre todos los núcleos de a una por vez. Después
+// de cada generación se guarda un checkpoint para poder retomar.
+//
+// Uso: ./tuner [--population N] [--games N] [--pieces N] [--generations N]
+//              [--threads N] [--checkpoint archivo] [--seed S]
+
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "arena.h"
+#include "battle.h" // getCpuCount()
+#include "bot.h"
+
+#define MAX_POPULATION 256
+#define CHECKPOINT_MAGIC "TUNER1"
+#define REPLACE_FRACTION 0.3 // Parte de la población que se reemplaza por hijos
+#define TOURNAMENT_SIZE 3
+#define MUTATION_CHANCE 10 // % de hijos con una componente mutada
+#define MUTATION_SIZE 0.2f
+
+typedef struct
+{
+    BotWeights weights;
+    double fitness; // Líneas promedio por partida
+} Candidate;
+
+typedef struct
+{
+    int populationSize;
+    int gamesPerCandidate;
+    int maxPieces;
+    int numThreads;
+    const char *checkpointPath;
+
+    int generation;
+    uint32_t rng;
+    Candidate population[MAX_POPULATION];
+
+    // Trabajo de la generación actual: un job = (candidato, partida)
+    _Atomic int nextJob;
+    _Atomic long long linesTotal[MAX_POPULATION];
+    _Atomic long long busyNs;
+} Tuner;
+
+// Opciones pasadas por línea de comandos: al retomar tienen que coincidir
+// con las del checkpoint, si no el fitness mezclaría partidas distintas
+typedef struct
+{
+    bool population;
+    bool games;
+    bool pieces;
+} ExplicitOptions;
+
+typedef enum
+{
+    CHECKPOINT_NONE,    // No hay o es inválido: se empieza de cero
+    CHECKPOINT_LOADED,
+    CHECKPOINT_MISMATCH // Distinto de lo pedido: no se puede retomar
+} CheckpointStatus;
+
+static uint64_t nowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static float randomUnit(uint32_t *rng)
+{
+    return (float)(nextRandom(rng) >> 8) / (float)(1u << 24);
+}
+
+// La evaluación es lineal: solo importa la dirección del vector de pesos
+static void normalizeWeights(BotWeights *weights)
+{
+    float norm = 0.0f;
+    for (int i = 0; i < NUM_BOT_FEATURES; i++)
+    {
+        norm += weights->weights[i] * weights->weights[i];
+    }
+    norm = sqrtf(norm);
+    if (norm == 0.0f)
+        return;
+    for (int i = 0; i < NUM_BOT_FEATURES; i++)
+    {
+        weights->weights[i] /= norm;
+    }
+}
+
+// Semilla de la partida `game` en la generación `generation`: la misma
+// para todos los candidatos, distinta en cada generación
+static uint32_t gameSeed(int generation, int game)
+{
+    uint32_t seed = (uint32_t)generation * 2654435761u ^ ((uint32_t)game * 40503u + 1u);
+    return seed != 0 ? seed : 1;
+}
+
+// Juega una partida de a piezas (sin ticks) y devuelve las líneas eliminadas
+static int playTuningGame(const BotWeights *weights, uint32_t seed, int maxPieces)
+{
+    GameState state;
+    initGame(&state, seed);
+
+    for (int piece = 0; piece < maxPieces && !state.gameOver; piece++)
+    {
+        if (botDropPiece(weights, &state) < 0)
+            break;
+    }
+    return state.totalLinesCleared;
+}
+
+// ============ EVALUACIÓN EN PARALELO ============
+
+static void *tunerWorker(void *arg)
+{
+    Tuner *tuner = (Tuner *)arg;
+    int totalJobs = tuner->populationSize * tuner->gamesPerCandidate;
+    uint64_t start = nowNs();
+
+    while (true)
+    {
+        int job = atomic_fetch_add(&tuner->nextJob, 1);
+        if (job >= totalJobs)
+            break;
+
+        int candidate = job / tuner->gamesPerCandidate;
+        int game = job % tuner->gamesPerCandidate;
+        int lines = playTuningGame(&tuner->population[candidate].weights,
+                                   gameSeed(tuner->generation, game), tuner->maxPieces);
+        atomic_fetch_add(&tuner->linesTotal[candidate], lines);
+    }
+
+    atomic_fetch_add(&tuner->busyNs, (long long)(nowNs() - start));
+    return NULL;
+}
+
+static void evaluatePopulation(Tuner *tuner)
+{
+    pthread_t threads[BATTLE_MAX_THREADS];
+    int started = 0;
+
+    atomic_store(&tuner->nextJob, 0);
+    atomic_store(&tuner->busyNs, 0);
+    for (int i = 0; i < tuner->populationSize; i++)
+    {
+        atomic_store(&tuner->linesTotal[i], 0);
+    }
+
+    for (int i = 1; i < tuner->numThreads; i++)
+    {
+        if (pthread_create(&threads[started], NULL, tunerWorker, tuner) == 0)
+            started++;
+    }
+    tunerWorker(tuner); // El hilo principal también juega
+    for (int i = 0; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (int i = 0; i < tuner->populationSize; i++)
+    {
+        tuner->population[i].fitness =
+            (double)atomic_load(&tuner->linesTotal[i]) / tuner->gamesPerCandidate;
+    }
+}
+
+// ============ SELECCIÓN, CRUCE Y MUTACIÓN ============
+
+static int compareCandidates(const void *a, const void *b)
+{
+    double fa = ((const Candidate *)a)->fitness;
+    double fb = ((const Candidate *)b)->fitness;
+    return fa < fb ? 1 : fa > fb ? -1 : 0;
+}
+
+// Torneo entre TOURNAMENT_SIZE candidatos al azar (la población está ordenada)
+static int tournamentSelect(Tuner *tuner)
+{
+    int best = tuner->populationSize;
+    for (int i = 0; i < TOURNAMENT_SIZE; i++)
+    {
+        int index = (int)(nextRandom(&tuner->rng) % (uint32_t)tuner->populationSize);
+        if (index < best)
+            best = index;
+    }
+    return best;
+}
+
+static void breedNextGeneration(Tuner *tuner)
+{
+    qsort(tuner->population, (size_t)tuner->populationSize, sizeof(Candidate), compareCandidates);
+
+    int replaced = (int)(tuner->populationSize * REPLACE_FRACTION);
+    int firstChild = tuner->populationSize - replaced;
+    Candidate children[MAX_POPULATION];
+
+    for (int c = 0; c < replaced; c++)
+    {
+        const Candidate *a = &tuner->population[tournamentSelect(tuner)];
+        const Candidate *b = &tuner->population[tournamentSelect(tuner)];
+
+        // Promedio pesado por fitness: el padre más fuerte pesa más
+        double total = a->fitness + b->fitness;
+        float share = total > 0.0 ? (float)(a->fitness / total) : 0.5f;
+        Candidate *child = &children[c];
+        for (int i = 0; i < NUM_BOT_FEATURES; i++)
+        {
+            child->weights.weights[i] = a->weights.weights[i] * share + b->weights.weights[i] * (1.0f - share);
+        }
+
+        if ((int)(nextRandom(&tuner->rng) % 100) < MUTATION_CHANCE)
+        {
+            int feature = (int)(nextRandom(&tuner->rng) % NUM_BOT_FEATURES);
+            child->weights.weights[feature] += (randomUnit(&tuner->rng) * 2.0f - 1.0f) * MUTATION_SIZE;
+        }
+        normalizeWeights(&child->weights);
+        child->fitness = 0.0;
+    }
+
+    memcpy(&tuner->population[firstChild], children, sizeof(Candidate) * (size_t)replaced);
+}
+
+static void randomPopulation(Tuner *tuner)
+{
+    // Los pesos por defecto entran como punto de partida
+    tuner->population[0].weights = DEFAULT_BOT_WEIGHTS;
+    normalizeWeights(&tuner->population[0].weights);
+
+    for (int c = 1; c < tuner->populationSize; c++)
+    {
+        for (int i = 0; i < NUM_BOT_FEATURES; i++)
+        {
+            tuner->population[c].weights.weights[i] = randomUnit(&tuner->rng) * 2.0f - 1.0f;
+        }
+        normalizeWeights(&tuner->population[c].weights);
+    }
+}
+
+// ============ CHECKPOINT ============
+
+// Se escribe a un archivo temporal y se renombra: un corte a mitad de
+// escritura nunca deja un checkpoint roto
+static bool saveCheckpoint(const Tuner *tuner)
+{
+    char tmpPath[512];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", tuner->checkpointPath);
+
+    FILE *file = fopen(tmpPath, "w");
+    if (file == NULL)
+    {
+        printf("Error al guardar checkpoint %s\n", tmpPath);
+        return false;
+    }
+
+    fprintf(file, "%s\n%d %u %d %d %d\n", CHECKPOINT_MAGIC, tuner->generation, tuner->rng,
+            tuner->populationSize, tuner->gamesPerCandidate, tuner->maxPieces);
+    for (int c = 0; c < tuner->populationSize; c++)
+    {
+        for (int i = 0; i < NUM_BOT_FEATURES; i++)
+        {
+            fprintf(file, "%.9g ", tuner->population[c].weights.weights[i]);
+        }
+        fprintf(file, "%.6f\n", tuner->population[c].fitness);
+    }
+
+    bool ok = fclose(file) == 0 && rename(tmpPath, tuner->checkpointPath) == 0;
+    if (!ok)
+        printf("Error al guardar checkpoint %s\n", tuner->checkpointPath);
+    return ok;
+}
+
+static CheckpointStatus loadCheckpoint(Tuner *tuner, const ExplicitOptions *explicitOptions)
+{
+    FILE *file = fopen(tuner->checkpointPath, "r");
+    if (file == NULL)
+        return CHECKPOINT_NONE;
+
+    char magic[16];
+    int generation, population, games, pieces;
+    uint32_t rng;
+    bool ok = fscanf(file, "%15s %d %u %d %d %d", magic, &generation, &rng, &population, &games, &pieces) == 6 &&
+              strcmp(magic, CHECKPOINT_MAGIC) == 0 && generation >= 0 && rng != 0 && population > 1 &&
+              population <= MAX_POPULATION && games >= 1 && pieces >= 1;
+    if (ok && ((explicitOptions->population && population != tuner->populationSize) ||
+               (explicitOptions->games && games != tuner->gamesPerCandidate) ||
+               (explicitOptions->pieces && pieces != tuner->maxPieces)))
+    {
+        printf("Error: %s es de población %d, %d partidas y %d piezas; borralo o usá esos valores\n",
+               tuner->checkpointPath, population, games, pieces);
+        fclose(file);
+        return CHECKPOINT_MISMATCH;
+    }
+
+    for (int c = 0; ok && c < population; c++)
+    {
+        for (int i = 0; ok && i < NUM_BOT_FEATURES; i++)
+        {
+            ok = fscanf(file, "%f", &tuner->population[c].weights.weights[i]) == 1;
+        }
+        ok = ok && fscanf(file, "%lf", &tuner->population[c].fitness) == 1;
+    }
+    fclose(file);
+
+    if (!ok)
+    {
+        printf("Error: checkpoint %s inválido\n", tuner->checkpointPath);
+        return CHECKPOINT_NONE;
+    }
+    tuner->generation = generation;
+    tuner->rng = rng;
+    tuner->populationSize = population;
+    tuner->gamesPerCandidate = games;
+    tuner->maxPieces = pieces;
+    return CHECKPOINT_LOADED;
+}
+
+// ============ MAIN ============
+
+int main(int argc, char *argv[])
+{
+    static Tuner tuner;
+    tuner.populationSize = 32;
+    tuner.gamesPerCandidate = 16;
+    tuner.maxPieces = 500;
+    tuner.numThreads = getCpuCount();
+    tuner.checkpointPath = "tuner.ckpt";
+    tuner.rng = 12345;
+    int generations = 10;
+    ExplicitOptions explicitOptions = {false, false, false};
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--population") == 0 && i + 1 < argc)
+        {
+            tuner.populationSize = atoi(argv[++i]);
+            explicitOptions.population = true;
+        }
+        else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+        {
+            tuner.gamesPerCandidate = atoi(argv[++i]);
+            explicitOptions.games = true;
+        }
+        else if (strcmp(argv[i], "--pieces") == 0 && i + 1 < argc)
+        {
+            tuner.maxPieces = atoi(argv[++i]);
+            explicitOptions.pieces = true;
+        }
+        else if (strcmp(argv[i], "--generations") == 0 && i + 1 < argc)
+            generations = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            tuner.numThreads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--checkpoint") == 0 && i + 1 < argc)
+            tuner.checkpointPath = argv[++i];
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            tuner.rng = (uint32_t)strtoul(argv[++i], NULL, 10);
+        else
+        {
+            printf("Uso: %s [--population N] [--games N] [--pieces N] [--generations N]\n"
+                   "          [--threads N] [--checkpoint archivo] [--seed S]\n",
+                   argv[0]);
+            return 1;
+        }
+    }
+
+    if (tuner.populationSize < 2 || tuner.populationSize > MAX_POPULATION || tuner.gamesPerCandidate < 1)
+    {
+        printf("Error: población entre 2 y %d y al menos 1 partida por candidato\n", MAX_POPULATION);
+        return 1;
+    }
+    if (tuner.numThreads < 1)
+        tuner.numThreads = 1;
+    if (tuner.numThreads > BATTLE_MAX_THREADS)
+        tuner.numThreads = BATTLE_MAX_THREADS;
+    if (tuner.rng == 0)
+        tuner.rng = 1;
+
+    CheckpointStatus checkpoint = loadCheckpoint(&tuner, &explicitOptions);
+    if (checkpoint == CHECKPOINT_MISMATCH)
+        return 1;
+    if (checkpoint == CHECKPOINT_LOADED)
+    {
+        printf("Retomando %s desde la generación %d\n", tuner.checkpointPath, tuner.generation);
+        // El checkpoint se guarda ya evaluado: generar los hijos pendientes
+        breedNextGeneration(&tuner);
+    }
+    else
+    {
+        randomPopulation(&tuner);
+    }
+
+    printf("Población %d, %d partidas por candidato (hasta %d piezas), %d hilos\n",
+           tuner.populationSize, tuner.gamesPerCandidate, tuner.maxPieces, tuner.numThreads);
+
+    uint64_t runStart = nowNs();
+    for (int g = 0; g < generations; g++)
+    {
+        uint64_t start = nowNs();
+        evaluatePopulation(&tuner);
+        uint64_t elapsed = nowNs() - start;
+
+        qsort(tuner.population, (size_t)tuner.populationSize, sizeof(Candidate), compareCandidates);
+        tuner.generation++;
+        saveCheckpoint(&tuner);
+
+        double seconds = (double)elapsed / 1e9;
+        double utilization = (double)atomic_load(&tuner.busyNs) / ((double)elapsed * tuner.numThreads);
+        double totalHours = (double)(nowNs() - runStart) / 3.6e12;
+        const float *best = tuner.population[0].weights.weights;
+
+        printf("Generación %d: mejor %.1f líneas, mediana %.1f | %.1f s, %.0f partidas/s, "
+               "%.0f generaciones/hora, CPU %.0f%%\n",
+               tuner.generation, tuner.population[0].fitness,
+               tuner.population[tuner.populationSize / 2].fitness, seconds,
+               tuner.populationSize * tuner.gamesPerCandidate / seconds, (g + 1) / totalHours,
+               utilization * 100.0);
+        printf("  Pesos: {{%.6ff, %.6ff, %.6ff, %.6ff}} (altura, líneas, huecos, irregularidad)\n",
+               best[FEATURE_HEIGHT], best[FEATURE_LINES], best[FEATURE_HOLES], best[FEATURE_BUMPINESS]);
+
+        if (g + 1 < generations)
+            breedNextGeneration(&tuner);
+    }
+
+    printArenaStats("de búsqueda (hilo principal)", threadArena());
+
+    return 0;
+}
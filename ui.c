@@ -1,21 +1,57 @@
 #include "ui.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include "fontatlas.h"
+#include "game.h"
+
+// Fuente embebida (fontatlas.h): una textura por renderer, subida en el
+// primer renderText. Es la fuente por defecto; con make TTF=1 se intenta
+// primero una fuente del sistema con SDL_ttf.
+static SDL_Texture* atlasTexture = NULL;
+static SDL_Renderer* atlasRenderer = NULL;
+static Uint32* atlasPixels = NULL; // El atlas ya expandido a ARGB blanco
+
+// initUI prepara el texto en un hilo mientras main crea la ventana; lo
+// primero que dibuja o mide texto espera a que termine
+static SDL_Thread* prepareThread = NULL;
+
+#ifdef USE_SDL_TTF
+#include <SDL_ttf.h>
 
 static TTF_Font* font = NULL;
 
-bool initUI()
+// Cache de textos rasterizados: los menús dibujan los mismos textos en
+// cada redibujo y TTF_RenderText_Blended + subir la textura es lo caro
+#define TEXT_CACHE_SIZE 64
+#define TEXT_CACHE_MAX_LENGTH 127
+
+typedef struct {
+    char text[TEXT_CACHE_MAX_LENGTH + 1];
+    SDL_Color color;
+    SDL_Renderer* renderer;
+    SDL_Texture* texture;
+    int w;
+    int h;
+    Uint32 lastUsed;
+} CachedText;
+
+static CachedText textCache[TEXT_CACHE_SIZE];
+static Uint32 textCacheClock = 0;
+
+static void openSystemFont(void)
 {
     if (TTF_Init() == -1) {
         printf("Error al inicializar SDL_ttf: %s\n", TTF_GetError());
-        return false;
+        return;
     }
 
-    // Intentar cargar una fuente del sistema
-    // macOS tiene fuentes en /System/Library/Fonts/
+    // Fuentes de macOS (/System/Library/Fonts/) y de Linux
     const char* fontPaths[] = {
         "/System/Library/Fonts/Helvetica.ttc",
         "/System/Library/Fonts/SFNSText.ttf",
         "/Library/Fonts/Arial.ttf",
+        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
         NULL
     };
 
@@ -23,60 +59,235 @@ bool initUI()
         font = TTF_OpenFont(fontPaths[i], 24);
         if (font != NULL) {
             printf("Fuente cargada: %s\n", fontPaths[i]);
-            break;
+            return;
         }
     }
+    printf("Error al cargar fuente: %s\n", TTF_GetError());
+    printf("Usando la fuente embebida.\n");
+}
 
-    if (font == NULL) {
-        printf("Error al cargar fuente: %s\n", TTF_GetError());
-        printf("Intentando con fuente por defecto...\n");
-        return false;
+static void clearTextCache(void)
+{
+    for (int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        if (textCache[i].texture != NULL) {
+            SDL_DestroyTexture(textCache[i].texture);
+        }
+    }
+    memset(textCache, 0, sizeof(textCache));
+}
+
+static void renderTtfText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color)
+{
+    // Buscar en la cache; si no está, reemplazar la usada hace más tiempo
+    bool cacheable = strlen(text) <= TEXT_CACHE_MAX_LENGTH;
+    CachedText* slot = &textCache[0];
+    for (int i = 0; i < TEXT_CACHE_SIZE && cacheable; i++) {
+        CachedText* entry = &textCache[i];
+        if (entry->texture != NULL && entry->renderer == renderer && entry->color.r == color.r &&
+            entry->color.g == color.g && entry->color.b == color.b && entry->color.a == color.a &&
+            strcmp(entry->text, text) == 0) {
+            entry->lastUsed = ++textCacheClock;
+            SDL_Rect destRect = {x, y, entry->w, entry->h};
+            SDL_RenderCopy(renderer, entry->texture, NULL, &destRect);
+            return;
+        }
+        if (entry->texture == NULL || (slot->texture != NULL && entry->lastUsed < slot->lastUsed)) {
+            slot = entry;
+        }
+    }
+
+    SDL_Surface* surface = TTF_RenderText_Blended(font, text, color);
+    if (surface == NULL) {
+        return;
     }
 
+    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+    if (texture == NULL) {
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    SDL_Rect destRect = {x, y, surface->w, surface->h};
+    SDL_RenderCopy(renderer, texture, NULL, &destRect);
+
+    if (cacheable) {
+        if (slot->texture != NULL) {
+            SDL_DestroyTexture(slot->texture);
+        }
+        strcpy(slot->text, text);
+        slot->color = color;
+        slot->renderer = renderer;
+        slot->texture = texture;
+        slot->w = surface->w;
+        slot->h = surface->h;
+        slot->lastUsed = ++textCacheClock;
+    } else {
+        SDL_DestroyTexture(texture);
+    }
+    SDL_FreeSurface(surface);
+}
+#endif // USE_SDL_TTF
+
+// Expande el alfa de 4 bits a ARGB blanco; el color de cada texto va por
+// SDL_SetTextureColorMod. Con TTF=1 también abre la fuente del sistema.
+static int prepareText(void* data)
+{
+    (void)data;
+#ifdef USE_SDL_TTF
+    openSystemFont();
+#endif
+    int count = FONT_ATLAS.width * FONT_ATLAS.height;
+    Uint32* pixels = malloc(sizeof(Uint32) * (size_t)count);
+    if (pixels == NULL) {
+        return -1;
+    }
+    for (int i = 0; i < count; i++) {
+        Uint32 alpha = (FONT_ATLAS.alpha[i / 2] >> (i % 2 * 4)) & 0x0F;
+        pixels[i] = (alpha * 17) << 24 | 0x00FFFFFF;
+    }
+    atlasPixels = pixels;
+    return 0;
+}
+
+static void waitForText(void)
+{
+    if (prepareThread != NULL) {
+        SDL_WaitThread(prepareThread, NULL);
+        prepareThread = NULL;
+    }
+}
+
+bool initUI()
+{
+    prepareThread = SDL_CreateThread(prepareText, "ui-text", NULL);
+    if (prepareThread == NULL) {
+        prepareText(NULL);
+    }
     return true;
 }
 
 void closeUI()
 {
+    waitForText();
+    free(atlasPixels);
+    atlasPixels = NULL;
+    if (atlasTexture != NULL) {
+        SDL_DestroyTexture(atlasTexture);
+        atlasTexture = NULL;
+        atlasRenderer = NULL;
+    }
+#ifdef USE_SDL_TTF
+    clearTextCache();
     if (font != NULL) {
         TTF_CloseFont(font);
         font = NULL;
     }
     TTF_Quit();
+#endif
 }
 
-void renderText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color)
+// Sube el atlas ya expandido en una sola textura
+static SDL_Texture* getAtlasTexture(SDL_Renderer* renderer)
 {
-    if (font == NULL || text == NULL || strlen(text) == 0) {
-        return;
+    if (atlasTexture != NULL && atlasRenderer == renderer) {
+        return atlasTexture;
+    }
+    if (atlasTexture != NULL) {
+        SDL_DestroyTexture(atlasTexture);
+        atlasTexture = NULL;
+    }
+    if (atlasPixels == NULL) {
+        return NULL;
     }
 
-    SDL_Surface* surface = TTF_RenderText_Blended(font, text, color);
-    if (surface == NULL) {
-        return;
+    atlasTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC,
+                                     FONT_ATLAS.width, FONT_ATLAS.height);
+    if (atlasTexture == NULL) {
+        printf("Error al crear la textura de la fuente: %s\n", SDL_GetError());
+        return NULL;
     }
+    SDL_UpdateTexture(atlasTexture, NULL, atlasPixels, FONT_ATLAS.width * (int)sizeof(Uint32));
+    SDL_SetTextureBlendMode(atlasTexture, SDL_BLENDMODE_BLEND);
+    atlasRenderer = renderer;
+    return atlasTexture;
+}
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(renderer, surface);
+// Glifo de un byte del texto; lo que no es ASCII imprimible sale como '?'
+static const FontGlyph* getGlyph(unsigned char c)
+{
+    if (c < FONT_ATLAS_FIRST || c >= FONT_ATLAS_FIRST + FONT_ATLAS_COUNT) {
+        c = '?';
+    }
+    return &FONT_ATLAS.glyphs[c - FONT_ATLAS_FIRST];
+}
+
+static void renderAtlasText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color)
+{
+    SDL_Texture* texture = getAtlasTexture(renderer);
     if (texture == NULL) {
-        SDL_FreeSurface(surface);
         return;
     }
 
-    SDL_Rect destRect = {x, y, surface->w, surface->h};
-    SDL_RenderCopy(renderer, texture, NULL, &destRect);
+    SDL_SetTextureColorMod(texture, color.r, color.g, color.b);
+    SDL_SetTextureAlphaMod(texture, color.a);
+    int penX = x;
+    for (const unsigned char* c = (const unsigned char*)text; *c != '\0'; c++) {
+        const FontGlyph* glyph = getGlyph(*c);
+        if (glyph->width > 0) {
+            SDL_Rect srcRect = {glyph->x, glyph->y, glyph->width, glyph->height};
+            SDL_Rect destRect = {penX + glyph->left, y + FONT_ATLAS.ascent - glyph->top, glyph->width, glyph->height};
+            SDL_RenderCopy(renderer, texture, &srcRect, &destRect);
+        }
+        penX += glyph->advance;
+    }
+}
 
-    SDL_DestroyTexture(texture);
-    SDL_FreeSurface(surface);
+// Ancho y alto en pixels de un texto con la fuente activa
+static void measureText(const char* text, int* width, int* height)
+{
+    waitForText();
+#ifdef USE_SDL_TTF
+    if (font != NULL) {
+        TTF_SizeText(font, text, width, height);
+        return;
+    }
+#endif
+    int total = 0;
+    for (const unsigned char* c = (const unsigned char*)text; *c != '\0'; c++) {
+        total += getGlyph(*c)->advance;
+    }
+    if (width != NULL) {
+        *width = total;
+    }
+    if (height != NULL) {
+        *height = FONT_ATLAS.lineHeight;
+    }
+}
+
+void renderText(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color)
+{
+    if (text == NULL || strlen(text) == 0) {
+        return;
+    }
+    waitForText();
+
+#ifdef USE_SDL_TTF
+    if (font != NULL) {
+        renderTtfText(renderer, text, x, y, color);
+        return;
+    }
+#endif
+    renderAtlasText(renderer, text, x, y, color);
 }
 
 void renderTextCentered(SDL_Renderer* renderer, const char* text, int x, int y, SDL_Color color)
 {
-    if (font == NULL || text == NULL || strlen(text) == 0) {
+    if (text == NULL || strlen(text) == 0) {
         return;
     }
 
     int textWidth, textHeight;
-    TTF_SizeText(font, text, &textWidth, &textHeight);
+    measureText(text, &textWidth, &textHeight);
     renderText(renderer, text, x - textWidth / 2, y - textHeight / 2, color);
 }
 
@@ -112,8 +323,7 @@ void renderTextField(SDL_Renderer* renderer, TextField* field)
 
     // Cursor parpadeante (si está activo)
     if (field->isActive) {
-        Uint32 ticks = SDL_GetTicks();
-        if ((ticks / 500) % 2 == 0) {  // Parpadear cada 500ms
+        if (getCursorBlinkPhase() % 2 == 0) {  // Parpadear cada UI_CURSOR_BLINK_MS
             int cursorX = field->rect.x + 10;
             if (strlen(field->text) > 0) {
                 int textWidth;
@@ -124,9 +334,9 @@ void renderTextField(SDL_Renderer* renderer, TextField* field)
                         masked[i] = '*';
                     }
                     masked[len] = '\0';
-                    TTF_SizeText(font, masked, &textWidth, NULL);
+                    measureText(masked, &textWidth, NULL);
                 } else {
-                    TTF_SizeText(font, field->text, &textWidth, NULL);
+                    measureText(field->text, &textWidth, NULL);
                 }
                 cursorX += textWidth;
             }
@@ -158,22 +368,25 @@ void renderButton(SDL_Renderer* renderer, Button* button)
                       textColor);
 }
 
-void handleTextFieldInput(TextField* field, SDL_Event* event)
+bool handleTextFieldInput(TextField* field, SDL_Event* event)
 {
     if (!field->isActive) {
-        return;
+        return false;
     }
 
     if (event->type == SDL_TEXTINPUT) {
         int currentLen = strlen(field->text);
         if (currentLen < MAX_INPUT_LENGTH) {
             strcat(field->text, event->text.text);
+            return true;
         }
     } else if (event->type == SDL_KEYDOWN) {
         if (event->key.keysym.sym == SDLK_BACKSPACE && strlen(field->text) > 0) {
             field->text[strlen(field->text) - 1] = '\0';
+            return true;
         }
     }
+    return false;
 }
 
 bool isButtonClicked(Button* button, int mouseX, int mouseY)
@@ -182,9 +395,29 @@ bool isButtonClicked(Button* button, int mouseX, int mouseY)
            mouseY >= button->rect.y && mouseY <= button->rect.y + button->rect.h;
 }
 
-void updateButtonHover(Button* button, int mouseX, int mouseY)
+bool updateButtonHover(Button* button, int mouseX, int mouseY)
 {
-    button->isHovered = isButtonClicked(button, mouseX, mouseY);
+    bool hovered = isButtonClicked(button, mouseX, mouseY);
+    bool changed = hovered != button->isHovered;
+    button->isHovered = hovered;
+    return changed;
+}
+
+Uint32 getCursorBlinkPhase(void)
+{
+    return SDL_GetTicks() / UI_CURSOR_BLINK_MS;
+}
+
+bool waitForEvent(SDL_Event* event, Uint32 deadline)
+{
+    if (deadline == 0) {
+        return SDL_WaitEvent(event) == 1;
+    }
+    Uint32 now = SDL_GetTicks();
+    if (now >= deadline) {
+        return SDL_PollEvent(event) == 1;
+    }
+    return SDL_WaitEventTimeout(event, (int)(deadline - now)) == 1;
 }
 
 TextField createTextField(int x, int y, int width, int height, bool isPassword)
@@ -212,3 +445,37 @@ Button createButton(int x, int y, int width, int height, const char* text)
     button.isHovered = false;
     return button;
 }
+
+// Teclas mantenidas -> InputFlags del motor (flechas, arriba rota)
+unsigned readHeldInputs(void)
+{
+    const Uint8* keystate = SDL_GetKeyboardState(NULL);
+    unsigned inputs = 0;
+    if (keystate[SDL_SCANCODE_LEFT]) inputs |= INPUT_LEFT;
+    if (keystate[SDL_SCANCODE_RIGHT]) inputs |= INPUT_RIGHT;
+    if (keystate[SDL_SCANCODE_DOWN]) inputs |= INPUT_DOWN;
+    if (keystate[SDL_SCANCODE_UP]) inputs |= INPUT_ROTATE;
+    return inputs;
+}
+
+// Tecla del motor que corresponde a una flecha (0 si no es una flecha)
+unsigned keyToInput(SDL_Keycode key)
+{
+    switch (key)
+    {
+    case SDLK_LEFT: return INPUT_LEFT;
+    case SDLK_RIGHT: return INPUT_RIGHT;
+    case SDLK_DOWN: return INPUT_DOWN;
+    case SDLK_UP: return INPUT_ROTATE;
+    default: return 0;
+    }
+}
+
+// Igual que readHeldInputs pero siguiendo los eventos KEYDOWN/KEYUP, así
+// también ve los eventos sintéticos de SDL_PushEvent
+unsigned updateHeldInputs(unsigned held, const SDL_Event* event)
+{
+    if (event->type == SDL_KEYDOWN) held |= keyToInput(event->key.keysym.sym);
+    if (event->type == SDL_KEYUP) held &= ~keyToInput(event->key.keysym.sym);
+    return held;
+}
@@ -2,7 +2,6 @@
 #define UI_H
 
 #include <SDL.h>
-#include <SDL_ttf.h>
 #include <stdbool.h>
 
 // Colores para la UI
@@ -27,6 +26,7 @@
 #define UI_COLOR_BUTTON_HOVER_B 255
 
 #define MAX_INPUT_LENGTH 49
+#define UI_CURSOR_BLINK_MS 500
 
 // Estructuras
 typedef struct {
@@ -43,7 +43,9 @@ typedef struct {
     bool isHovered;
 } Button;
 
-// Funciones de inicialización
+// Funciones de inicialización (el texto usa la fuente embebida de
+// fontatlas.h; con make TTF=1, una fuente del sistema si hay alguna).
+// initUI vuelve enseguida: la fuente se prepara en un hilo aparte.
 bool initUI();
 void closeUI();
 
@@ -54,9 +56,18 @@ void renderTextField(SDL_Renderer* renderer, TextField* field);
 void renderButton(SDL_Renderer* renderer, Button* button);
 
 // Funciones de input
-void handleTextFieldInput(TextField* field, SDL_Event* event);
+bool handleTextFieldInput(TextField* field, SDL_Event* event); // true si cambió el texto
 bool isButtonClicked(Button* button, int mouseX, int mouseY);
-void updateButtonHover(Button* button, int mouseX, int mouseY);
+bool updateButtonHover(Button* button, int mouseX, int mouseY); // true si cambió el hover
+unsigned readHeldInputs(void);
+unsigned keyToInput(SDL_Keycode key);
+unsigned updateHeldInputs(unsigned held, const SDL_Event* event);
+
+// Redibujo por cambios: las pantallas quietas esperan acá en vez de
+// redibujar cada 16 ms. deadline en ms de SDL_GetTicks (0 = sin límite).
+// false si se llegó al deadline sin eventos.
+bool waitForEvent(SDL_Event* event, Uint32 deadline);
+Uint32 getCursorBlinkPhase(void); // Cambia cada UI_CURSOR_BLINK_MS
 
 // Funciones de creación
 TextField createTextField(int x, int y, int width, int height, bool isPassword);
@@ -0,0 +1,126 @@
+#include "versus.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "netplay.h"
+#include "render.h"
+#include "rollback.h"
+#include "ui.h"
+
+#define VERSUS_BOARD_LEFT_X 60
+#define VERSUS_BOARD_RIGHT_X (WINDOW_WIDTH - 60 - GRID_WIDTH * CELL_SIZE)
+
+static void renderVersus(SDL_Renderer *renderer, const RollbackSession *session)
+{
+    SDL_SetRenderDrawColor(renderer, COLOR_BACKGROUND_R, COLOR_BACKGROUND_G, COLOR_BACKGROUND_B, COLOR_BACKGROUND_A);
+    SDL_RenderClear(renderer);
+
+    SDL_Color white = {255, 255, 255, 255};
+    SDL_Color red = {255, 100, 100, 255};
+    const VersusState *versus = &session->state;
+    int originX[2] = {VERSUS_BOARD_LEFT_X, VERSUS_BOARD_RIGHT_X};
+
+    for (int p = 0; p < 2; p++)
+    {
+        GameState *game = (GameState *)&versus->players[p];
+        renderBoardAt(renderer, originX[p], BOARD_OFFSET_Y, game->grid, game->currentPiece,
+                      game->currentType, game->pieceX, game->pieceY);
+
+        // Basura pendiente: barra roja al costado del tablero
+        if (versus->pendingGarbage[p] > 0)
+        {
+            int height = versus->pendingGarbage[p] * CELL_SIZE;
+            SDL_Rect bar = {originX[p] + GRID_WIDTH * CELL_SIZE + 4,
+                            BOARD_OFFSET_Y + GRID_HEIGHT * CELL_SIZE - height, 8, height};
+            SDL_SetRenderDrawColor(renderer, 240, 0, 0, 255);
+            SDL_RenderFillRect(renderer, &bar);
+        }
+
+        char label[100];
+        snprintf(label, sizeof(label), "%s%d - %d pts", p == session->localPlayer ? "(vos) J" : "J",
+                 p + 1, game->score);
+        renderTextCentered(renderer, label, originX[p] + GRID_WIDTH * CELL_SIZE / 2, BOARD_OFFSET_Y / 2, white);
+    }
+
+    if (session->confirmedFrame == 0)
+    {
+        renderTextCentered(renderer, "Esperando rival...", WINDOW_WIDTH / 2, WINDOW_HEIGHT - 30, red);
+    }
+    else if (versus->winner != VERSUS_NO_WINNER)
+    {
+        const char *text = versus->winner == VERSUS_DRAW ? "EMPATE"
+                           : versus->winner == session->localPlayer ? "GANASTE"
+                                                                    : "PERDISTE";
+        renderTextCentered(renderer, text, WINDOW_WIDTH / 2, WINDOW_HEIGHT - 30, red);
+    }
+
+    SDL_RenderPresent(renderer);
+}
+
+// Loop del versus: la simulación avanza en ticks fijos de 1/60 s que se
+// acumulan a partir del reloj real, pero el estado solo depende de los
+// inputs de cada tick (nunca de SDL_GetTicks), así ambos procesos simulan
+// exactamente lo mismo.
+void runVersus(SDL_Renderer *renderer, const VersusConfig *config)
+{
+    RollbackSession *session = malloc(sizeof(RollbackSession));
+    NetPeer peer;
+
+    initRollback(session, config->seed, config->localPlayer);
+    if (!openNetPeer(&peer, config->localPort, config->remoteHost, config->remotePort))
+    {
+        free(session);
+        return;
+    }
+    setNetSim(&peer, config->delayMs, config->jitterMs, config->lossPercent, config->seed + 1);
+
+    printf("Versus: jugador %d, puerto %d -> %s:%d\n", config->localPlayer + 1,
+           config->localPort, config->remoteHost, config->remotePort);
+
+    bool running = true;
+    Uint32 lastTime = SDL_GetTicks();
+    Uint32 accumulator = 0; // En milésimas de tick
+    SDL_Event event;
+
+    while (running)
+    {
+        while (SDL_PollEvent(&event))
+        {
+            if (event.type == SDL_QUIT ||
+                (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE))
+            {
+                running = false;
+            }
+        }
+
+        Uint32 now = SDL_GetTicks();
+        accumulator += (now - lastTime) * TARGET_FPS;
+        lastTime = now;
+
+        netPoll(&peer, netNowMs());
+        netReceive(&peer, session);
+
+        uint8_t inputs = (uint8_t)readHeldInputs();
+        while (accumulator >= 1000)
+        {
+            if (!rollbackAdvance(session, inputs))
+            {
+                // El rival va atrasado: esperar sin acumular más ticks
+                accumulator = 1000;
+                break;
+            }
+            accumulator -= 1000;
+        }
+
+        rollbackResolve(session);
+        netSendInputs(&peer, session, netNowMs());
+        renderVersus(renderer, session);
+        SDL_Delay(1);
+    }
+
+    printf("Versus terminado: %u rollbacks, %u frames re-simulados (máx %u), %u esperas\n",
+           session->stats.rollbacks, session->stats.framesResimulated,
+           session->stats.maxRollbackFrames, session->stats.stalls);
+
+    closeNetPeer(&peer);
+    free(session);
+}
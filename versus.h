@@ -0,0 +1,22 @@
+#ifndef VERSUS_H
+#define VERSUS_H
+
+#include <SDL.h>
+#include <stdint.h>
+
+// Configuración de una partida versus en red (ver rollback.h y netplay.h)
+typedef struct
+{
+    int localPlayer; // 0 = tablero izquierdo, 1 = derecho
+    int localPort;
+    const char *remoteHost;
+    int remotePort;
+    uint32_t seed; // Debe ser la misma en los dos procesos
+    int delayMs;   // Simulador de red opcional (0 = desactivado)
+    int jitterMs;
+    int lossPercent;
+} VersusConfig;
+
+void runVersus(SDL_Renderer *renderer, const VersusConfig *config);
+
+#endif // VERSUS_H
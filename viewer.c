@@ -0,0 +1,119 @@
+#include "viewer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "render.h"
+#include "stream.h"
+#include "ui.h"
+
+// Lee el archivo completo en memoria ("-" = entrada estándar)
+static uint8_t *loadStreamFile(const char *path, long *size)
+{
+    FILE *file = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (file == NULL)
+    {
+        printf("Error al abrir stream %s\n", path);
+        return NULL;
+    }
+
+    long capacity = 1 << 16;
+    long used = 0;
+    uint8_t *data = malloc((size_t)capacity);
+    size_t n;
+    while ((n = fread(data + used, 1, (size_t)(capacity - used), file)) > 0)
+    {
+        used += (long)n;
+        if (used == capacity)
+        {
+            capacity *= 2;
+            data = realloc(data, (size_t)capacity);
+        }
+    }
+
+    if (file != stdin)
+        fclose(file);
+
+    if (used < 4 || memcmp(data, STREAM_MAGIC, 4) != 0)
+    {
+        printf("Error: %s no es un stream de Tetris\n", path);
+        free(data);
+        return NULL;
+    }
+
+    *size = used;
+    return data;
+}
+
+void watchStream(SDL_Renderer *renderer, const char *path)
+{
+    long size = 0;
+    uint8_t *data = loadStreamFile(path, &size);
+    if (data == NULL)
+        return;
+
+    StreamDecoder decoder;
+    initStreamDecoder(&decoder);
+
+    long offset = 4;
+    bool running = true;
+    bool started = false;
+    Uint32 startTime = 0;
+    uint32_t startTick = 0;
+    SDL_Event event;
+
+    while (running)
+    {
+        while (SDL_PollEvent(&event))
+        {
+            if (event.type == SDL_QUIT ||
+                (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE))
+            {
+                running = false;
+            }
+        }
+
+        // Aplicar todos los frames cuyo tick ya pasó (60 ticks por segundo)
+        uint32_t playTick = started ? startTick + (SDL_GetTicks() - startTime) * TARGET_FPS / 1000 : 0;
+        uint32_t frameTick;
+        while (offset < size &&
+               peekStreamFrameTick(&decoder, data + offset, (int)(size - offset), &frameTick) &&
+               (!started || frameTick <= playTick))
+        {
+            int used = decodeStreamFrame(&decoder, data + offset, (int)(size - offset));
+            if (used <= 0)
+            {
+                printf("Stream corrupto en el byte %ld\n", offset);
+                offset = size;
+                break;
+            }
+            offset += used;
+
+            if (!started)
+            {
+                // El reloj de reproducción arranca en el primer keyframe
+                started = true;
+                startTick = decoder.view.tick;
+                startTime = SDL_GetTicks();
+                playTick = startTick;
+            }
+        }
+
+        if (decoder.hasKeyframe)
+        {
+            GameState *view = &decoder.view;
+            renderBoard(renderer, view->grid, view->currentPiece, view->currentType,
+                        view->pieceX, view->pieceY);
+
+            SDL_Color white = {255, 255, 255, 255};
+            char info[100];
+            snprintf(info, sizeof(info), "Puntuacion: %d   Lineas: %d%s",
+                     view->score, view->totalLinesCleared, view->gameOver ? "   GAME OVER" : "");
+            renderTextCentered(renderer, info, WINDOW_WIDTH / 2, BOARD_OFFSET_Y / 2, white);
+        }
+
+        SDL_RenderPresent(renderer);
+        SDL_Delay(FRAME_DELAY);
+    }
+
+    free(data);
+}
@@ -0,0 +1,9 @@
+#ifndef VIEWER_H
+#define VIEWER_H
+
+#include <SDL.h>
+
+// Reproduce un stream de espectador (ver stream.h) en la ventana del juego
+void watchStream(SDL_Renderer *renderer, const char *path);
+
+#endif // VIEWER_H